@@ -0,0 +1,182 @@
+// bench/AccountBench.cpp
+// AccountManager 예약/정산 + OrderStore 조회/갱신
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "core/domain/Account.h"
+#include "core/domain/Order.h"
+#include "engine/OrderStore.h"
+#include "trading/allocation/AccountManager.h"
+
+namespace {
+
+    const std::vector<std::string> kMarkets = { "KRW-BTC", "KRW-ETH", "KRW-XRP", "KRW-ADA" };
+
+    core::Account makeAccount()
+    {
+        core::Account acc;
+        acc.krw_free = 4'000'000.0;
+        return acc;
+    }
+
+    void BM_AccountManager_ReserveRelease(benchmark::State& state)
+    {
+        trading::allocation::AccountManager am(makeAccount(), kMarkets);
+        for (auto _ : state)
+        {
+            auto token = am.reserve("KRW-BTC", 50'000.0);
+            benchmark::DoNotOptimize(token);
+            if (token) am.release(std::move(*token));
+        }
+    }
+    BENCHMARK(BM_AccountManager_ReserveRelease);
+
+    // 매수 1사이클: reserve → finalizeFillBuy → finalizeOrder, 이후 매도 정산으로 잔고 복원
+    void BM_AccountManager_BuyFillCycle(benchmark::State& state)
+    {
+        trading::allocation::AccountManager am(makeAccount(), kMarkets);
+        constexpr double kKrw = 50'000.0;
+        constexpr double kPrice = 100'000'000.0;
+        constexpr double kCoin = kKrw / kPrice;
+
+        for (auto _ : state)
+        {
+            auto token = am.reserve("KRW-BTC", kKrw);
+            if (!token)
+            {
+                state.SkipWithError("reserve failed");
+                break;
+            }
+            am.finalizeFillBuy(*token, kKrw, kCoin, kPrice);
+            am.finalizeOrder(std::move(*token));
+            am.finalizeFillSell("KRW-BTC", kCoin, kKrw);
+        }
+    }
+    BENCHMARK(BM_AccountManager_BuyFillCycle);
+
+    // 캔들마다 전략용 잔고 조회: MarketBudget 복사(slot 락) vs seqlock 발행값
+    void BM_AccountManager_GetBudget(benchmark::State& state)
+    {
+        trading::allocation::AccountManager am(makeAccount(), kMarkets);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(am.getBudget("KRW-BTC"));
+    }
+    BENCHMARK(BM_AccountManager_GetBudget);
+
+    void BM_AccountManager_PublishedBalances(benchmark::State& state)
+    {
+        trading::allocation::AccountManager am(makeAccount(), kMarkets);
+        const auto* balances = am.publishedBalances("KRW-BTC");
+        for (auto _ : state)
+            benchmark::DoNotOptimize(balances->load());
+    }
+    BENCHMARK(BM_AccountManager_PublishedBalances);
+
+    // 마켓 워커 여러 개가 각자 자기 마켓만 예약/해제 (마켓 간 락 경합 여부 확인용)
+    void BM_AccountManager_ReserveRelease_PerMarket(benchmark::State& state)
+    {
+        static trading::allocation::AccountManager* am = nullptr;
+        if (state.thread_index() == 0)
+            am = new trading::allocation::AccountManager(makeAccount(), kMarkets);
+
+        const std::string& market = kMarkets[static_cast<std::size_t>(state.thread_index()) % kMarkets.size()];
+        for (auto _ : state)
+        {
+            auto token = am->reserve(market, 50'000.0);
+            benchmark::DoNotOptimize(token);
+            if (token) am->release(std::move(*token));
+        }
+
+        if (state.thread_index() == 0)
+        {
+            delete am;
+            am = nullptr;
+        }
+    }
+    BENCHMARK(BM_AccountManager_ReserveRelease_PerMarket)->Threads(1)->Threads(4)->UseRealTime();
+
+    core::Order makeOrder(std::size_t i)
+    {
+        core::Order o;
+        o.market = kMarkets[i % kMarkets.size()];
+        o.id = "bench-order-" + std::to_string(i);
+        o.position = core::OrderPosition::BID;
+        o.type = core::OrderType::Limit;
+        o.price = 100'000.0;
+        o.volume = 0.5;
+        o.status = core::OrderStatus::Open;
+        return o;
+    }
+
+    // MarketEngine과 동일하게 마켓 shard 핸들(forMarket)을 통해 접근
+    void BM_OrderStore_Get(benchmark::State& state)
+    {
+        engine::OrderStore store;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        std::vector<core::Order> orders;
+        std::vector<engine::OrderStore::MarketOrders> handles;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            orders.push_back(makeOrder(i));
+            handles.push_back(store.forMarket(orders.back().market));
+            store.upsert(orders.back());
+        }
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(handles[i].get(orders[i].id));
+            if (++i == n) i = 0;
+        }
+    }
+    BENCHMARK(BM_OrderStore_Get)->Arg(16)->Arg(1024);
+
+    // 체결 경로: 마켓 shard 핸들로 복사 없이 필드만 읽기
+    void BM_OrderStore_Visit(benchmark::State& state)
+    {
+        engine::OrderStore store;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        std::vector<core::Order> orders;
+        std::vector<engine::OrderStore::MarketOrders> handles;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            orders.push_back(makeOrder(i));
+            handles.push_back(store.forMarket(orders.back().market));
+            store.upsert(orders.back());
+        }
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            double v = 0.0;
+            handles[i].visit(orders[i].id, [&](const core::Order& o) { v = o.executed_volume; });
+            benchmark::DoNotOptimize(v);
+            if (++i == n) i = 0;
+        }
+    }
+    BENCHMARK(BM_OrderStore_Visit)->Arg(16)->Arg(1024);
+
+    void BM_OrderStore_Upsert(benchmark::State& state)
+    {
+        engine::OrderStore store;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        std::vector<core::Order> orders;
+        std::vector<engine::OrderStore::MarketOrders> handles;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            orders.push_back(makeOrder(i));
+            handles.push_back(store.forMarket(orders.back().market));
+        }
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            handles[i].upsert(orders[i]);
+            if (++i == n) i = 0;
+        }
+    }
+    BENCHMARK(BM_OrderStore_Upsert)->Arg(16)->Arg(1024);
+
+} // namespace
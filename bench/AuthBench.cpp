@@ -0,0 +1,50 @@
+// bench/AuthBench.cpp
+// REST 호출마다 수행되는 JWT(HS512) 서명
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <string>
+
+#include "api/auth/UpbitJwtSigner.h"
+
+namespace {
+
+    const api::auth::UpbitJwtSigner& signer()
+    {
+        static const api::auth::UpbitJwtSigner s(
+            "bench-access-key-0123456789abcdefghijklmnop",
+            "bench-secret-key-0123456789abcdefghijklmnopqrstuvwxyz0123");
+        return s;
+    }
+
+    void BM_JwtSigner_NoQuery(benchmark::State& state)
+    {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(signer().makeBearerToken(std::nullopt));
+    }
+    BENCHMARK(BM_JwtSigner_NoQuery);
+
+    void BM_JwtSigner_WithQuery(benchmark::State& state)
+    {
+        const std::string query =
+            "market=KRW-BTC&side=bid&ord_type=price&price=50000&identifier=rsi_mean_reversion:KRW-BTC:1";
+        for (auto _ : state)
+            benchmark::DoNotOptimize(signer().makeBearerToken(query));
+    }
+    BENCHMARK(BM_JwtSigner_WithQuery);
+
+    // 호출자가 버퍼를 재사용하는 경로 (토큰 문자열 할당 없음)
+    void BM_JwtSigner_WithQuery_ReuseBuffer(benchmark::State& state)
+    {
+        const std::string query =
+            "market=KRW-BTC&side=bid&ord_type=price&price=50000&identifier=rsi_mean_reversion:KRW-BTC:1";
+        std::string out;
+        for (auto _ : state)
+        {
+            signer().writeBearerToken(out, query);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+    BENCHMARK(BM_JwtSigner_WithQuery_ReuseBuffer);
+
+} // namespace
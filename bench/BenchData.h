@@ -0,0 +1,62 @@
+// bench/BenchData.h
+// 벤치마크 공용 입력 데이터 (실제 Upbit WS 메시지 형태)
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace bench {
+
+    // 분봉 캔들 (candle.15m, SIMPLE 아닌 DEFAULT 포맷)
+    inline constexpr std::string_view kCandleJson =
+        R"({"type":"candle.15m","code":"KRW-BTC","candle_date_time_utc":"2026-01-05T03:15:00",)"
+        R"("candle_date_time_kst":"2026-01-05T12:15:00","opening_price":142350000.0,)"
+        R"("high_price":142480000.0,"low_price":142300000.0,"trade_price":142410000.0,)"
+        R"("candle_acc_trade_volume":3.21548712,"candle_acc_trade_price":457812345.1234,)"
+        R"("timestamp":1767582921000,"stream_type":"REALTIME"})";
+
+    // myOrder 체결(trade) 이벤트
+    inline constexpr std::string_view kMyOrderTradeJson =
+        R"({"type":"myOrder","code":"KRW-BTC","uuid":"ac2dc2a3-fce9-40a2-a4f6-5987c25c438f",)"
+        R"("ask_bid":"BID","order_type":"price","state":"trade",)"
+        R"("trade_uuid":"68315169-fba4-4175-ade3-aff14a616657","price":142410000.0,)"
+        R"("avg_price":142410000.0,"volume":0.00035108,"remaining_volume":0.0,)"
+        R"("executed_volume":0.00035108,"trades_count":1,"reserved_fee":25.0,)"
+        R"("remaining_fee":0.0,"paid_fee":24.99,"locked":0.0,"executed_funds":49997.31,)"
+        R"("trade_fee":24.99,"is_maker":false,"identifier":"rsi_mean_reversion:KRW-BTC:1",)"
+        R"("trade_timestamp":1767582921000,"order_timestamp":1767582920950,)"
+        R"("timestamp":1767582921012,"stream_type":"REALTIME"})";
+
+    // 체결(trade) 스트림 (DEFAULT 포맷)
+    inline constexpr std::string_view kTradeJson =
+        R"({"type":"trade","code":"KRW-BTC","timestamp":1767582921045,"trade_date":"2026-01-05",)"
+        R"("trade_time":"03:15:21","trade_timestamp":1767582921012,"trade_price":142410000.0,)"
+        R"("trade_volume":0.00035108,"ask_bid":"BID","prev_closing_price":141980000.0,)"
+        R"("change":"RISE","change_price":430000.0,"sequential_id":17675829210120000,)"
+        R"("best_ask_price":142420000.0,"best_ask_size":0.125,"best_bid_price":142410000.0,)"
+        R"("best_bid_size":0.0832,"stream_type":"REALTIME"})";
+
+    // 호가(orderbook) 스냅샷 15단 (DEFAULT 포맷, "KRW-BTC.15" 구독)
+    inline constexpr std::string_view kOrderbookJson =
+        R"({"type":"orderbook","code":"KRW-BTC","timestamp":1767582921045,)"
+        R"("total_ask_size":1.5,"total_bid_size":3.732,"orderbook_units":[)"
+        R"({"ask_price":142420000.0,"bid_price":142410000.0,"ask_size":0.01250000,"bid_size":0.03110000},)"
+        R"({"ask_price":142430000.0,"bid_price":142400000.0,"ask_size":0.02500000,"bid_size":0.06220000},)"
+        R"({"ask_price":142440000.0,"bid_price":142390000.0,"ask_size":0.03750000,"bid_size":0.09330000},)"
+        R"({"ask_price":142450000.0,"bid_price":142380000.0,"ask_size":0.05000000,"bid_size":0.12440000},)"
+        R"({"ask_price":142460000.0,"bid_price":142370000.0,"ask_size":0.06250000,"bid_size":0.15550000},)"
+        R"({"ask_price":142470000.0,"bid_price":142360000.0,"ask_size":0.07500000,"bid_size":0.18660000},)"
+        R"({"ask_price":142480000.0,"bid_price":142350000.0,"ask_size":0.08750000,"bid_size":0.21770000},)"
+        R"({"ask_price":142490000.0,"bid_price":142340000.0,"ask_size":0.10000000,"bid_size":0.24880000},)"
+        R"({"ask_price":142500000.0,"bid_price":142330000.0,"ask_size":0.11250000,"bid_size":0.27990000},)"
+        R"({"ask_price":142510000.0,"bid_price":142320000.0,"ask_size":0.12500000,"bid_size":0.31100000},)"
+        R"({"ask_price":142520000.0,"bid_price":142310000.0,"ask_size":0.13750000,"bid_size":0.34210000},)"
+        R"({"ask_price":142530000.0,"bid_price":142300000.0,"ask_size":0.15000000,"bid_size":0.37320000},)"
+        R"({"ask_price":142540000.0,"bid_price":142290000.0,"ask_size":0.16250000,"bid_size":0.40430000},)"
+        R"({"ask_price":142550000.0,"bid_price":142280000.0,"ask_size":0.17500000,"bid_size":0.43540000},)"
+        R"({"ask_price":142560000.0,"bid_price":142270000.0,"ask_size":0.18750000,"bid_size":0.46650000})"
+        R"(],"stream_type":"REALTIME","level":0})";
+
+    inline constexpr const char* kBenchMarket = "KRW-BTC";
+
+} // namespace bench
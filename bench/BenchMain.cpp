@@ -0,0 +1,20 @@
+// bench/BenchMain.cpp
+// coinbot_bench 진입점 - 측정 중 INFO 로그가 섞이지 않도록 WARN 이상만 출력
+#include <benchmark/benchmark.h>
+
+#include "util/Logger.h"
+
+int main(int argc, char** argv)
+{
+    util::Logger::instance().setLevel(util::LogLevel::WARN);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    util::Logger::instance().flush();
+    return 0;
+}
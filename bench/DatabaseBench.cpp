@@ -0,0 +1,76 @@
+// bench/DatabaseBench.cpp
+// SQLite insert (WAL, 동기 쓰기) - 임시 파일 DB 사용
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+#include "core/domain/Candle.h"
+#include "core/domain/Order.h"
+#include "database/Database.h"
+
+namespace {
+
+    std::string tempDbPath(const char* tag)
+    {
+        const auto dir = std::filesystem::temp_directory_path();
+        return (dir / (std::string("coinbot_bench_") + tag + ".db")).string();
+    }
+
+    void removeDb(const std::string& path)
+    {
+        for (const char* suffix : { "", "-wal", "-shm" })
+            std::filesystem::remove(path + suffix);
+    }
+
+    void BM_Database_InsertCandle(benchmark::State& state)
+    {
+        const auto path = tempDbPath("candle");
+        removeDb(path);
+        {
+            db::Database db;
+            db.open(path);
+
+            core::Candle c{ "KRW-BTC", 100.0, 110.0, 90.0, 105.0, 12.5, "" };
+            long long seq = 0;
+            for (auto _ : state)
+            {
+                c.start_timestamp = "2026-01-05T12:" + std::to_string(seq++);
+                benchmark::DoNotOptimize(db.insertCandle("KRW-BTC", c, 15));
+            }
+        }
+        removeDb(path);
+    }
+    BENCHMARK(BM_Database_InsertCandle);
+
+    void BM_Database_InsertOrder(benchmark::State& state)
+    {
+        const auto path = tempDbPath("order");
+        removeDb(path);
+        {
+            db::Database db;
+            db.open(path);
+
+            core::Order o;
+            o.market = "KRW-BTC";
+            o.position = core::OrderPosition::BID;
+            o.type = core::OrderType::Market;
+            o.requested_amount = 50'000.0;
+            o.executed_volume = 0.0005;
+            o.executed_funds = 49'990.0;
+            o.paid_fee = 25.0;
+            o.status = core::OrderStatus::Filled;
+            o.created_at = "1767582920950";
+
+            long long seq = 0;
+            for (auto _ : state)
+            {
+                o.id = "bench-" + std::to_string(seq++);
+                benchmark::DoNotOptimize(db.insertOrder(o));
+            }
+        }
+        removeDb(path);
+    }
+    BENCHMARK(BM_Database_InsertOrder);
+
+} // namespace
@@ -0,0 +1,121 @@
+// bench/DedupeBench.cpp
+// MarketEngine 체결 중복 방지 - 고정 용량 테이블 vs 기존 unordered_set + deque FIFO
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "engine/TradeDedupeTable.h"
+
+namespace {
+
+    constexpr std::size_t kCapacity = 20000;   // AppConfig engine.max_seen_trades 기본값
+
+    // Upbit trade_uuid 형식의 서로 다른 키 n개
+    std::vector<std::string> makeUuids(std::size_t n)
+    {
+        std::vector<std::string> out;
+        out.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            char buf[40];
+            const unsigned long long x = (i + 1) * 0x9E3779B97F4A7C15ULL;
+            std::snprintf(buf, sizeof(buf), "%08llx-%04llx-4%03llx-8%03llx-%012llx",
+                x >> 32, (x >> 16) & 0xFFFF, x & 0xFFF, (x >> 20) & 0xFFF, (x ^ i) & 0xFFFFFFFFFFFFULL);
+            out.emplace_back(buf);
+        }
+        return out;
+    }
+
+    const std::vector<std::string>& uuids()
+    {
+        static const auto v = makeUuids(kCapacity * 4);
+        return v;
+    }
+
+    // 새 체결 삽입 (정상 상태: 테이블 가득 참 → 매 삽입마다 가장 오래된 키 제거)
+    void BM_TradeDedupe_Table_Insert(benchmark::State& state)
+    {
+        const auto& keys = uuids();
+        engine::TradeDedupeTable table(kCapacity);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(table.insert(keys[i]));
+            if (++i == keys.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_TradeDedupe_Table_Insert);
+
+    // 재전송된 체결 (이미 본 키)
+    void BM_TradeDedupe_Table_Duplicate(benchmark::State& state)
+    {
+        const auto& keys = uuids();
+        engine::TradeDedupeTable table(kCapacity);
+        for (std::size_t k = 0; k < kCapacity; ++k) table.insert(keys[k]);
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(table.insert(keys[i]));
+            if (++i == kCapacity) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_TradeDedupe_Table_Duplicate);
+
+    // 기존 방식: unordered_set<string> + deque<string>
+    struct SetFifo
+    {
+        std::unordered_set<std::string> seen;
+        std::deque<std::string> fifo;
+
+        bool insert(const std::string& k)
+        {
+            auto [it, inserted] = seen.emplace(k);
+            if (!inserted) return false;
+            fifo.push_back(*it);
+            while (fifo.size() > kCapacity)
+            {
+                seen.erase(fifo.front());
+                fifo.pop_front();
+            }
+            return true;
+        }
+    };
+
+    void BM_TradeDedupe_SetFifo_Insert(benchmark::State& state)
+    {
+        const auto& keys = uuids();
+        SetFifo s;
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(s.insert(keys[i]));
+            if (++i == keys.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_TradeDedupe_SetFifo_Insert);
+
+    void BM_TradeDedupe_SetFifo_Duplicate(benchmark::State& state)
+    {
+        const auto& keys = uuids();
+        SetFifo s;
+        for (std::size_t k = 0; k < kCapacity; ++k) s.insert(keys[k]);
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(s.insert(keys[i]));
+            if (++i == kCapacity) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_TradeDedupe_SetFifo_Duplicate);
+
+} // namespace
@@ -0,0 +1,203 @@
+// bench/IndicatorBench.cpp
+// RingBuffer push + 지표별 update (윈도우 가득 찬 정상 상태 기준)
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "marketdata/PriceSeries.h"
+#include "trading/indicators/ChangeVolatilityIndicator.h"
+#include "trading/indicators/ClosePriceWindow.h"
+#include "trading/indicators/IndicatorSet.h"
+#include "trading/indicators/RingBuffer.h"
+#include "trading/indicators/RsiWilder.h"
+#include "trading/indicators/Sma.h"
+
+#ifdef COINBOT_ENABLE_AVX2
+#include "trading/indicators/CrossMarketIndicators.h"
+#endif
+
+namespace {
+
+    // 결정적 가격 시퀀스 (사인파 + 드리프트 근사, 난수 없음)
+    const std::vector<double>& prices()
+    {
+        static const std::vector<double> p = [] {
+            std::vector<double> v(4096);
+            double x = 100000.0;
+            for (std::size_t i = 0; i < v.size(); ++i)
+            {
+                x += static_cast<double>(static_cast<int>(i * 7919 % 201) - 100);
+                v[i] = x;
+            }
+            return v;
+        }();
+        return p;
+    }
+
+    template <typename Indicator>
+    void runUpdate(benchmark::State& state, Indicator& ind)
+    {
+        const auto& p = prices();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ind.update(p[i]));
+            i = (i + 1) & (p.size() - 1);
+        }
+    }
+
+    void BM_RingBuffer_Push(benchmark::State& state)
+    {
+        trading::indicators::RingBuffer<double> rb(static_cast<std::size_t>(state.range(0)));
+        double x = 0.0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(rb.push(x));
+            x += 1.0;
+        }
+    }
+    BENCHMARK(BM_RingBuffer_Push)->Arg(14)->Arg(200);
+
+    void BM_Sma_Update(benchmark::State& state)
+    {
+        trading::indicators::Sma ind(static_cast<std::size_t>(state.range(0)));
+        runUpdate(state, ind);
+    }
+    BENCHMARK(BM_Sma_Update)->Arg(20)->Arg(200);
+
+    void BM_RsiWilder_Update(benchmark::State& state)
+    {
+        trading::indicators::RsiWilder ind(14);
+        runUpdate(state, ind);
+    }
+    BENCHMARK(BM_RsiWilder_Update);
+
+    void BM_ChangeVolatility_Update(benchmark::State& state)
+    {
+        trading::indicators::ChangeVolatilityIndicator ind(20);
+        runUpdate(state, ind);
+    }
+    BENCHMARK(BM_ChangeVolatility_Update);
+
+    void BM_ClosePriceWindow_Update(benchmark::State& state)
+    {
+        trading::indicators::ClosePriceWindow ind(20);
+        runUpdate(state, ind);
+    }
+    BENCHMARK(BM_ClosePriceWindow_Update);
+
+    // 전략 1봉 갱신: 지표별 런타임 클래스 3개 vs PriceSeries push + 같은 구성의 IndicatorSet 1번
+    void BM_StrategyIndicators_Separate(benchmark::State& state)
+    {
+        trading::indicators::RsiWilder rsi(14);
+        trading::indicators::ClosePriceWindow closeN(30);
+        trading::indicators::ChangeVolatilityIndicator vol(20);
+        const auto& p = prices();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(rsi.update(p[i]));
+            benchmark::DoNotOptimize(closeN.update(p[i]));
+            benchmark::DoNotOptimize(vol.update(p[i]));
+            i = (i + 1) & (p.size() - 1);
+        }
+    }
+    BENCHMARK(BM_StrategyIndicators_Separate);
+
+    template <typename Set>
+    void runSetUpdate(benchmark::State& state)
+    {
+        Set set;
+        marketdata::PriceSeries series(Set::kLookback);
+        const auto& p = prices();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            series.push(static_cast<std::int64_t>(i), p[i], p[i], p[i], p[i], 1.0);
+            set.update(series);
+            benchmark::DoNotOptimize(set);
+            i = (i + 1) & (p.size() - 1);
+        }
+    }
+
+    void BM_IndicatorSet_Strategy(benchmark::State& state)
+    {
+        using namespace trading::indicators;
+        runSetUpdate<IndicatorSet<Rsi<14>, CloseN<30>, ReturnStdev<20>>>(state);
+    }
+    BENCHMARK(BM_IndicatorSet_Strategy);
+
+    void BM_IndicatorSet_Full(benchmark::State& state)
+    {
+        using namespace trading::indicators;
+        runSetUpdate<IndicatorSet<Rsi<14>, Ema<20>, Bollinger<20, 2>, Atr<14>, CloseN<30>, ReturnStdev<20>>>(state);
+    }
+    BENCHMARK(BM_IndicatorSet_Full);
+
+    // 봉 확정이 몰리는 시점: 마켓 N개가 한 봉씩 (전략 지표 구성 RSI14 / close[30] / 수익률 stdev20)
+    // 마켓별 PriceSeries + IndicatorSet 순회 vs CrossMarketIndicators AVX2 1패스 (COINBOT_ENABLE_AVX2 빌드만)
+    using StrategySet = trading::indicators::IndicatorSet<trading::indicators::Rsi<14>,
+        trading::indicators::CloseN<30>, trading::indicators::ReturnStdev<20>>;
+
+    double marketPrice(std::size_t market, std::size_t i)
+    {
+        const auto& p = prices();
+        return p[(i + market * 37) & (p.size() - 1)] + static_cast<double>(market);
+    }
+
+    void BM_CrossMarket_PerMarketSets(benchmark::State& state)
+    {
+        const auto markets = static_cast<std::size_t>(state.range(0));
+        std::vector<std::unique_ptr<marketdata::PriceSeries>> series;
+        std::vector<StrategySet> sets(markets);
+        for (std::size_t m = 0; m < markets; ++m)
+            series.push_back(std::make_unique<marketdata::PriceSeries>(StrategySet::kLookback));
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            for (std::size_t m = 0; m < markets; ++m)
+            {
+                const double c = marketPrice(m, i);
+                series[m]->push(static_cast<std::int64_t>(i), c, c, c, c, 1.0);
+                sets[m].update(*series[m]);
+
+                // 전략 buildSnapshot과 같은 조회 (값 계산이 지연되는 지표 포함)
+                const auto closeN = sets[m].get<1>().value();
+                const double trend = closeN.ready && closeN.v != 0.0 ? std::abs(c - closeN.v) / closeN.v : 0.0;
+                benchmark::DoNotOptimize(sets[m].get<0>().value());
+                benchmark::DoNotOptimize(sets[m].get<2>().value());
+                benchmark::DoNotOptimize(trend);
+            }
+            ++i;
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * markets));
+    }
+    BENCHMARK(BM_CrossMarket_PerMarketSets)->Arg(256);
+
+#ifdef COINBOT_ENABLE_AVX2
+    void BM_CrossMarket_Batch(benchmark::State& state)
+    {
+        const auto markets = static_cast<std::size_t>(state.range(0));
+        trading::indicators::CrossMarketIndicators engine(markets, 14, 30, 20);
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            for (std::size_t m = 0; m < markets; ++m)
+                engine.stage(m, marketPrice(m, i));
+            engine.evaluate([](std::size_t, const trading::indicators::CrossMarketIndicators::Row& r) {
+                benchmark::DoNotOptimize(r);
+            });
+            ++i;
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * markets));
+    }
+    BENCHMARK(BM_CrossMarket_Batch)->Arg(256);
+#endif
+
+} // namespace
@@ -0,0 +1,134 @@
+// bench/MarketDataBench.cpp
+// 1분봉 스트림 → 6개 상위 단위 리샘플 (분당 업데이트 수 = state.range(0), 마지막이 새 분봉)
+// 체결 스트림 → 로컬 1분봉 집계
+// 호가 스냅샷 반영 + 스프레드/깊이 조회 + 시장가 사전 슬리피지 추정
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "marketdata/CandleResampler.h"
+#include "marketdata/OrderBook.h"
+#include "marketdata/SlippageEstimator.h"
+#include "marketdata/TickAggregator.h"
+
+namespace {
+
+    void BM_CandleResampler_Update(benchmark::State& state)
+    {
+        using marketdata::CandleResampler;
+
+        const int updates_per_bar = static_cast<int>(state.range(0));
+        const std::int64_t t0 = *CandleResampler::parseMinutes("2026-01-05T09:00:00");
+
+        // 타임스탬프 문자열은 미리 생성 (WS 파싱 결과와 동일 조건)
+        std::vector<std::string> ts(4096);
+        for (std::size_t i = 0; i < ts.size(); ++i)
+            ts[i] = CandleResampler::formatMinutes(t0 + static_cast<std::int64_t>(i));
+
+        CandleResampler resampler(1, { 3, 5, 15, 30, 60, 240 });
+        std::vector<marketdata::ResampledBar> closed;
+        closed.reserve(8);
+
+        core::Candle bar;
+        bar.market = "KRW-BTC";
+        std::size_t minute = 0;
+        int k = 0;
+        for (auto _ : state)
+        {
+            bar.start_timestamp = ts[minute];
+            bar.open_price = 100000.0;
+            bar.high_price = 100000.0 + k;
+            bar.low_price = 99900.0 - k;
+            bar.close_price = 100000.0 + (k & 7);
+            bar.volume = 0.01 * (k + 1);
+
+            closed.clear();
+            benchmark::DoNotOptimize(resampler.update(bar, closed));
+
+            if (++k == updates_per_bar)
+            {
+                k = 0;
+                minute = (minute + 1) & (ts.size() - 1);
+                if (minute == 0) resampler = CandleResampler(1, { 3, 5, 15, 30, 60, 240 });
+            }
+        }
+    }
+    BENCHMARK(BM_CandleResampler_Update)->Arg(1)->Arg(20);
+
+    // 초당 수십 건 체결 가정: 체결 간격 7ms → 약 8,500건마다 봉 확정
+    void BM_TickAggregator_Update(benchmark::State& state)
+    {
+        marketdata::TickAggregator agg(60'000);
+        std::int64_t ts = 1767582900000;
+        std::int64_t seq = 1;
+        for (auto _ : state)
+        {
+            const double price = 142410000.0 + static_cast<double>(seq & 15) * 1000.0;
+            benchmark::DoNotOptimize(agg.update(price, 0.001, ts, seq));
+            ts += 7;
+            ++seq;
+        }
+        state.counters["bars"] = static_cast<double>(agg.stats().bars.load());
+    }
+    BENCHMARK(BM_TickAggregator_Update);
+
+    std::array<core::OrderbookLevel, 15> makeLevels()
+    {
+        std::array<core::OrderbookLevel, 15> lv{};
+        for (std::size_t i = 0; i < lv.size(); ++i)
+            lv[i] = core::OrderbookLevel{ 142420000.0 + i * 10000.0, 0.0125 * (i + 1),
+                                          142410000.0 - i * 10000.0, 0.0311 * (i + 1) };
+        return lv;
+    }
+
+    void BM_OrderBook_Update(benchmark::State& state)
+    {
+        const auto levels = makeLevels();
+        marketdata::OrderBook book;
+        std::int64_t ts = 1767582921045;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(book.update(++ts, 1.5, 3.732, levels));
+    }
+    BENCHMARK(BM_OrderBook_Update);
+
+    void BM_OrderBook_Query(benchmark::State& state)
+    {
+        using Side = marketdata::OrderBook::Side;
+        const auto levels = makeLevels();
+        marketdata::OrderBook book;
+        (void)book.update(1, 1.5, 3.732, levels);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(book.spreadBps());
+            benchmark::DoNotOptimize(book.depthNotional(Side::Bid));
+            benchmark::DoNotOptimize(book.notionalWithinBps(Side::Ask, 5.0));
+        }
+    }
+    BENCHMARK(BM_OrderBook_Query);
+
+    // 주문 금액 = state.range(0) KRW (15단 합계 약 3,700만 KRW → 큰 값은 여러 단 순회)
+    void BM_Slippage_EstimateBuy(benchmark::State& state)
+    {
+        const auto levels = makeLevels();
+        marketdata::OrderBook book;
+        (void)book.update(1, 1.5, 3.732, levels);
+        const double krw = static_cast<double>(state.range(0));
+        for (auto _ : state)
+            benchmark::DoNotOptimize(marketdata::estimateBuyByAmount(book, krw));
+    }
+    BENCHMARK(BM_Slippage_EstimateBuy)->Arg(100'000)->Arg(20'000'000);
+
+    void BM_Slippage_MaxBuyWithin(benchmark::State& state)
+    {
+        const auto levels = makeLevels();
+        marketdata::OrderBook book;
+        (void)book.update(1, 1.5, 3.732, levels);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(marketdata::maxBuyAmountWithin(book, 3.0));
+    }
+    BENCHMARK(BM_Slippage_MaxBuyWithin);
+
+} // namespace
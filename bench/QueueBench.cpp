@@ -0,0 +1,52 @@
+// bench/QueueBench.cpp
+// BlockingQueue push/pop - 단일 스레드 왕복 + 다중 생산자 경합
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+
+#include "core/BlockingQueue.h"
+#include "engine/input/EngineInput.h"
+
+namespace {
+
+    using Queue = core::BlockingQueue<engine::input::EngineInput>;
+
+    void BM_BlockingQueue_PushPop(benchmark::State& state)
+    {
+        Queue q(5000);
+        const std::string payload(256, 'x');
+        for (auto _ : state)
+        {
+            q.push(engine::input::MarketDataRaw{ payload });
+            benchmark::DoNotOptimize(q.try_pop());
+        }
+    }
+    BENCHMARK(BM_BlockingQueue_PushPop);
+
+    // 스레드 0 = 소비자(pop_for), 나머지 = 생산자(push). 모든 스레드가 같은 큐를 두고 경합
+    void BM_BlockingQueue_Contended(benchmark::State& state)
+    {
+        static Queue* q = nullptr;
+        if (state.thread_index() == 0)
+            q = new Queue(5000);
+
+        const std::string payload(256, 'x');
+        for (auto _ : state)
+        {
+            if (state.thread_index() == 0)
+                benchmark::DoNotOptimize(q->pop_for(std::chrono::microseconds(50)));
+            else
+                q->push(engine::input::MarketDataRaw{ payload });
+        }
+
+        if (state.thread_index() == 0)
+        {
+            state.counters["dropped"] = static_cast<double>(q->droppedCount());
+            delete q;
+            q = nullptr;
+        }
+    }
+    BENCHMARK(BM_BlockingQueue_Contended)->Threads(2)->Threads(4)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,53 @@
+// bench/RouterBench.cpp
+// EventRouter 라우팅 + WS 메시지 파서
+#include <benchmark/benchmark.h>
+
+#include "BenchData.h"
+#include "api/upbit/WsMessageParser.h"
+#include "app/EventRouter.h"
+
+namespace {
+
+    void BM_EventRouter_RouteMarketData(benchmark::State& state)
+    {
+        // 소비자 없이 push만 반복 → 작은 용량으로 drop-oldest 경로까지 포함
+        app::EventRouter::PrivateQueue queue(1024);
+        app::EventRouter router;
+        router.registerMarket(bench::kBenchMarket, queue);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(router.routeMarketData(bench::kCandleJson));
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bench::kCandleJson.size()));
+    }
+    BENCHMARK(BM_EventRouter_RouteMarketData);
+
+    void BM_Parser_ParseCandle(benchmark::State& state)
+    {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(api::upbit::ws::parseCandle(bench::kCandleJson, 15, bench::kBenchMarket));
+    }
+    BENCHMARK(BM_Parser_ParseCandle);
+
+    void BM_Parser_ParseMyOrder(benchmark::State& state)
+    {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(api::upbit::ws::parseMyOrder(bench::kMyOrderTradeJson, bench::kBenchMarket));
+    }
+    BENCHMARK(BM_Parser_ParseMyOrder);
+
+    void BM_Parser_ParseTrade(benchmark::State& state)
+    {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(api::upbit::ws::parseTrade(bench::kTradeJson, bench::kBenchMarket));
+    }
+    BENCHMARK(BM_Parser_ParseTrade);
+
+    void BM_Parser_ParseOrderbook(benchmark::State& state)
+    {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(api::upbit::ws::parseOrderbook(bench::kOrderbookJson, bench::kBenchMarket));
+    }
+    BENCHMARK(BM_Parser_ParseOrderbook);
+
+} // namespace
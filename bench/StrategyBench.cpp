@@ -0,0 +1,131 @@
+// bench/StrategyBench.cpp
+// 마켓 1개의 확정 봉 처리 (StrategySet 정적 디스패치 vs 가상 인터페이스 루프)
+// 계좌는 비워 둠 → 주문 생성(uuid) 없이 봉 반영 + 지표 + 판단 경로만 측정
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "marketdata/PriceSeries.h"
+#include "trading/strategies/BreakoutStrategy.h"
+#include "trading/strategies/RsiMeanReversionStrategy.h"
+#include "trading/strategies/StrategySet.h"
+
+namespace {
+
+    using trading::strategies::BreakoutStrategy;
+    using trading::strategies::RsiMeanReversionStrategy;
+    using trading::strategies::StrategySet;
+
+    // 운용 레지스트리(RSI 단독)와 별개로 2전략 조합 측정용
+    using RsiBreakoutSet = StrategySet<RsiMeanReversionStrategy, BreakoutStrategy>;
+
+    // 결정적 분봉 시퀀스 (ts는 모두 다름 → dedup에 걸리지 않음)
+    const std::vector<core::Candle>& candles()
+    {
+        static const std::vector<core::Candle> c = [] {
+            std::vector<core::Candle> v(4096);
+            double x = 100000.0;
+            for (std::size_t i = 0; i < v.size(); ++i)
+            {
+                const double open = x;
+                x += static_cast<double>(static_cast<int>(i * 7919 % 201) - 100);
+                v[i].market = "KRW-BTC";
+                v[i].open_price = open;
+                v[i].close_price = x;
+                v[i].high_price = (open > x ? open : x) + 50.0;
+                v[i].low_price = (open < x ? open : x) - 50.0;
+                v[i].volume = 1.0;
+
+                char ts[32];
+                std::snprintf(ts, sizeof(ts), "2026-01-%02uT%02u:%02u:00",
+                    static_cast<unsigned>(1 + i / 1440 % 28),
+                    static_cast<unsigned>((i / 60) % 24),
+                    static_cast<unsigned>(i % 60));
+                v[i].start_timestamp = ts;
+            }
+            return v;
+        }();
+        return c;
+    }
+
+    template <typename Set>
+    void runSet(benchmark::State& state)
+    {
+        const auto& c = candles();
+        marketdata::PriceSeries series(Set::kSeriesLookback);
+        Set set("KRW-BTC", typename Set::Params{}, series);
+        const trading::AccountSnapshot account{};
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(set.onCandle(c[i], account));
+            if (++i == c.size())
+            {
+                // 시퀀스를 다시 돌 때 ts가 되돌아가므로 상태를 비우고 재시작 (드묾)
+                i = 0;
+                set.reset();
+            }
+        }
+    }
+
+    void BM_StrategySet_Rsi(benchmark::State& state)
+    {
+        runSet<StrategySet<RsiMeanReversionStrategy>>(state);
+    }
+    BENCHMARK(BM_StrategySet_Rsi);
+
+    void BM_StrategySet_RsiBreakout(benchmark::State& state)
+    {
+        runSet<RsiBreakoutSet>(state);
+    }
+    BENCHMARK(BM_StrategySet_RsiBreakout);
+
+    // 비교용: 같은 두 전략을 가상 인터페이스 배열로 호출 (같은 dedup + push, 중재 없이 디스패치만)
+    struct IStrategy
+    {
+        virtual ~IStrategy() = default;
+        virtual trading::Decision onCandle(const core::Candle& c, const trading::AccountSnapshot& a) = 0;
+    };
+
+    template <typename S>
+    struct Boxed final : IStrategy
+    {
+        Boxed(const marketdata::PriceSeries& series) : s("KRW-BTC", typename S::Params{}, series) {}
+        trading::Decision onCandle(const core::Candle& c, const trading::AccountSnapshot& a) override
+        {
+            return s.onCandle(c, a);
+        }
+        S s;
+    };
+
+    void BM_StrategyVirtual_RsiBreakout(benchmark::State& state)
+    {
+        const auto& c = candles();
+        marketdata::PriceSeries series(RsiBreakoutSet::kSeriesLookback);
+        std::vector<std::unique_ptr<IStrategy>> strategies;
+        strategies.push_back(std::make_unique<Boxed<RsiMeanReversionStrategy>>(series));
+        strategies.push_back(std::make_unique<Boxed<BreakoutStrategy>>(series));
+        const trading::AccountSnapshot account{};
+        std::string last_ts;
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            if (c[i].start_timestamp != last_ts)
+            {
+                last_ts = c[i].start_timestamp;
+                series.push(c[i]);
+            }
+            for (auto& s : strategies)
+                benchmark::DoNotOptimize(s->onCandle(c[i], account));
+            if (++i == c.size()) i = 0;
+        }
+    }
+    BENCHMARK(BM_StrategyVirtual_RsiBreakout);
+
+} // namespace
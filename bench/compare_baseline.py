@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""coinbot_bench JSON 결과를 baseline.json과 비교한다.
+
+사용: compare_baseline.py <baseline.json> <current.json> [--threshold 0.10]
+- 벤치마크별 median cpu_time 비교 (repetitions 없이 돌린 결과면 단일 값 사용)
+- threshold(기본 10%) 이상 느려진 항목이 있으면 exit 1
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+
+    result = {}
+    for b in data.get("benchmarks", []):
+        agg = b.get("aggregate_name")
+        if agg not in (None, "median"):
+            continue
+        name = b.get("run_name", b["name"])
+        # median 집계가 있으면 단일 측정값보다 우선
+        if agg == "median" or name not in result:
+            result[name] = (b["cpu_time"], b.get("time_unit", "ns"))
+    return result
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("baseline")
+    ap.add_argument("current")
+    ap.add_argument("--threshold", type=float, default=0.10)
+    args = ap.parse_args()
+
+    base = load(args.baseline)
+    cur = load(args.current)
+
+    regressions = 0
+    print(f"{'benchmark':<48} {'baseline':>12} {'current':>12} {'delta':>8}")
+    for name in sorted(cur):
+        c, unit = cur[name]
+        if name not in base:
+            print(f"{name:<48} {'-':>12} {c:>10.1f}{unit:>2} {'new':>8}")
+            continue
+        b, _ = base[name]
+        delta = (c - b) / b if b > 0 else 0.0
+        mark = ""
+        if delta > args.threshold:
+            mark = "  REGRESSION"
+            regressions += 1
+        print(f"{name:<48} {b:>10.1f}{unit:>2} {c:>10.1f}{unit:>2} {delta:>+7.1%}{mark}")
+
+    for name in sorted(set(base) - set(cur)):
+        print(f"{name:<48} (removed)")
+
+    if regressions:
+        print(f"\n{regressions} benchmark(s) slower than baseline by more than {args.threshold:.0%}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
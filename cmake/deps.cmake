@@ -28,3 +28,4 @@ endif()
 
 find_package(Boost 1.80 REQUIRED COMPONENTS thread chrono)
 find_package(OpenSSL REQUIRED)
+find_package(Threads REQUIRED)
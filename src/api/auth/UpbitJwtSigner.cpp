@@ -1,130 +1,186 @@
-﻿#include "UpbitJwtSigner.h"
+#include "UpbitJwtSigner.h"
 
 #include <json.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
 
-#include <openssl/hmac.h>
+#include <openssl/evp.h>
 #include <openssl/sha.h>
 
 #include <array>
-#include <sstream>
-#include <iomanip>
-#include <vector>
+#include <cstring>
+#include <stdexcept>
 
 // Upbit 인증용 JWT(HS512) 토큰을 생성해서, HTTP 요청 헤더에 넣을 수 있게 해주는 역할
 
 namespace {
 
-    // 1) base64url 인코딩 함수
+    constexpr std::size_t kSha512BlockSize = 128;   // HMAC 키 패딩 단위
+    constexpr std::size_t kSha512DigestSize = SHA512_DIGEST_LENGTH;
+
+    constexpr char kHexDigits[] = "0123456789abcdef";
+
+    // 1) base64url 인코딩 (padding 없음) - out 뒤에 바로 이어 씀
     // JWT는 base64가 아니라 "base64url"을 쓴다
-    std::string base64UrlEncode(const unsigned char* data, std::size_t len) {
-        // 간단 구현(프로덕션에선 util로 분리 추천)
-        // OpenSSL EVP_EncodeBlock은 base64(+/ =) 형태라 URL-safe로 치환
-        static const char* b64 =
-            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-        std::string out;
-        out.reserve(((len + 2) / 3) * 4);
+    void appendBase64Url(std::string& out, const unsigned char* data, std::size_t len) {
+        static constexpr char b64[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+        const std::size_t base = out.size();
+        out.resize(base + (len * 4 + 2) / 3);
+        char* p = out.data() + base;
 
         // 3바이트씩 읽어서 4개의 base64 문자로 변환
         std::size_t i = 0;
         while (i + 3 <= len) {
-            const unsigned v = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
-            out.push_back(b64[(v >> 18) & 63]);
-            out.push_back(b64[(v >> 12) & 63]);
-            out.push_back(b64[(v >> 6) & 63]);
-            out.push_back(b64[v & 63]);
+            const unsigned v = (unsigned(data[i]) << 16) | (unsigned(data[i + 1]) << 8) | data[i + 2];
+            *p++ = b64[(v >> 18) & 63];
+            *p++ = b64[(v >> 12) & 63];
+            *p++ = b64[(v >> 6) & 63];
+            *p++ = b64[v & 63];
             i += 3;
         }
 
-        // 남은 바이트가 1~2개면 padding '=' 포함하여 마무리
+        // 남은 바이트가 1~2개면 padding 없이 마무리
         if (i < len) {
-            unsigned v = data[i] << 16;
-            out.push_back(b64[(v >> 18) & 63]);
-            if (i + 1 < len) {
-                v |= data[i + 1] << 8;
-                out.push_back(b64[(v >> 12) & 63]);
-                out.push_back(b64[(v >> 6) & 63]);
-                out.push_back('=');
-            }
-            else {
-                out.push_back(b64[(v >> 12) & 63]);
-                out.push_back('=');
-                out.push_back('=');
-            }
-        }
-
-        // URL-safe: + -> -, / -> _, padding 제거, URL-safe 치환
-        for (auto& c : out) {
-            if (c == '+') c = '-';
-            else if (c == '/') c = '_';
+            unsigned v = unsigned(data[i]) << 16;
+            if (i + 1 < len) v |= unsigned(data[i + 1]) << 8;
+            *p++ = b64[(v >> 18) & 63];
+            *p++ = b64[(v >> 12) & 63];
+            if (i + 1 < len) *p++ = b64[(v >> 6) & 63];
         }
+    }
 
-        // padding '=' 제거
-        while (!out.empty() && out.back() == '=') out.pop_back();
-        return out;
+    void appendBase64Url(std::string& out, std::string_view s) {
+        appendBase64Url(out, reinterpret_cast<const unsigned char*>(s.data()), s.size());
     }
 
-    // 2) sha512 해시를 hex 문자열로 변환
-    std::string sha512Hex(std::string_view s) {
-        std::array<unsigned char, SHA512_DIGEST_LENGTH> hash{};
+    // 2) sha512 해시를 hex 문자열로 이어 씀
+    void appendSha512Hex(std::string& out, std::string_view s) {
+        std::array<unsigned char, kSha512DigestSize> hash{};
         SHA512(reinterpret_cast<const unsigned char*>(s.data()), s.size(), hash.data());
 
-        std::ostringstream oss;
-        for (auto b : hash) oss << std::hex << std::setw(2) << std::setfill('0') << (int)b;
-        return oss.str();
+        for (const auto b : hash) {
+            out.push_back(kHexDigits[b >> 4]);
+            out.push_back(kHexDigits[b & 0x0F]);
+        }
     }
 
-    std::string hmacSha512(const std::string& key, std::string_view msg) {
-        unsigned int len = 0;
-        unsigned char out[EVP_MAX_MD_SIZE]{};
+    // 3) UUID v4 nonce (스레드별로 1회 시드된 mt19937 - 호출마다 OS 엔트로피 읽지 않음)
+    void appendUuidV4(std::string& out) {
+        thread_local boost::uuids::random_generator_mt19937 gen;
+        const boost::uuids::uuid u = gen();
 
-        HMAC(EVP_sha512(),
-            key.data(), (int)key.size(),
-            reinterpret_cast<const unsigned char*>(msg.data()), msg.size(),
-            out, &len);
+        std::size_t i = 0;
+        for (const auto b : u) {
+            if (i == 4 || i == 6 || i == 8 || i == 10) out.push_back('-');
+            out.push_back(kHexDigits[b >> 4]);
+            out.push_back(kHexDigits[b & 0x0F]);
+            ++i;
+        }
+    }
 
-        return std::string(reinterpret_cast<char*>(out), len);
+    void checkOk(int rc, const char* what) {
+        if (rc != 1) throw std::runtime_error(std::string("UpbitJwtSigner: ") + what + " failed");
     }
 
 } // namespace
 
 namespace api::auth {
 
-    UpbitJwtSigner::UpbitJwtSigner(std::string accessKey, std::string secretKey)
-        : access_(std::move(accessKey)), secret_(std::move(secretKey)) {
+    void UpbitJwtSigner::MdCtxDeleter::operator()(evp_md_ctx_st* p) const noexcept {
+        EVP_MD_CTX_free(p);
     }
 
-    std::string UpbitJwtSigner::makeBearerToken(std::optional<std::string> query_string) const {
-        using nlohmann::json;
+    UpbitJwtSigner::UpbitJwtSigner(std::string accessKey, std::string secretKey) {
+        // header는 상수 → 1회만 인코딩
+        bearer_prefix_ = "Bearer ";
+        appendBase64Url(bearer_prefix_, R"({"alg":"HS512","typ":"JWT"})");
+        bearer_prefix_.push_back('.');
+
+        // payload 키 순서는 기존 nlohmann::json(map) dump와 동일: access_key, nonce, query_hash, query_hash_alg
+        payload_prefix_ = "{\"access_key\":" + nlohmann::json(accessKey).dump() + ",\"nonce\":\"";
 
-        const json header = { {"alg","HS512"}, {"typ","JWT"} };
+        // HMAC-SHA512 키 준비: 블록보다 길면 해시, 이후 0 패딩 → ipad/opad 상태를 미리 흡수
+        std::array<unsigned char, kSha512BlockSize> key{};
+        if (secretKey.size() > kSha512BlockSize)
+            SHA512(reinterpret_cast<const unsigned char*>(secretKey.data()), secretKey.size(), key.data());
+        else
+            std::memcpy(key.data(), secretKey.data(), secretKey.size());
 
-        // nonce는 UUID v4
-        const auto nonce = boost::uuids::to_string(boost::uuids::random_generator()());
+        std::array<unsigned char, kSha512BlockSize> pad{};
 
-        json payload = {
-            {"access_key", access_},
-            {"nonce", nonce}
-        };
+        hmac_inner_.reset(EVP_MD_CTX_new());
+        hmac_outer_.reset(EVP_MD_CTX_new());
+        if (!hmac_inner_ || !hmac_outer_) throw std::bad_alloc();
 
-        if (query_string && !query_string->empty()) {
-            payload["query_hash"] = sha512Hex(*query_string);
-            payload["query_hash_alg"] = "SHA512";
+        for (std::size_t i = 0; i < kSha512BlockSize; ++i) pad[i] = key[i] ^ 0x36;
+        checkOk(EVP_DigestInit_ex(hmac_inner_.get(), EVP_sha512(), nullptr), "inner init");
+        checkOk(EVP_DigestUpdate(hmac_inner_.get(), pad.data(), pad.size()), "inner pad");
+
+        for (std::size_t i = 0; i < kSha512BlockSize; ++i) pad[i] = key[i] ^ 0x5c;
+        checkOk(EVP_DigestInit_ex(hmac_outer_.get(), EVP_sha512(), nullptr), "outer init");
+        checkOk(EVP_DigestUpdate(hmac_outer_.get(), pad.data(), pad.size()), "outer pad");
+
+        // 키 흔적 제거
+        OPENSSL_cleanse(key.data(), key.size());
+        OPENSSL_cleanse(pad.data(), pad.size());
+        OPENSSL_cleanse(secretKey.data(), secretKey.size());
+    }
+
+    UpbitJwtSigner::~UpbitJwtSigner() = default;
+    UpbitJwtSigner::UpbitJwtSigner(UpbitJwtSigner&&) noexcept = default;
+    UpbitJwtSigner& UpbitJwtSigner::operator=(UpbitJwtSigner&&) noexcept = default;
+
+    std::string UpbitJwtSigner::makeBearerToken(std::optional<std::string> query_string) const {
+        std::string out;
+        writeBearerToken(out, query_string ? std::string_view(*query_string) : std::string_view{});
+        return out;
+    }
+
+    void UpbitJwtSigner::writeBearerToken(std::string& out, std::string_view query_string) const {
+        // 호출별 작업 상태 (스레드당 1회 할당 후 재사용)
+        thread_local std::string payload;
+        thread_local MdCtxPtr work{ EVP_MD_CTX_new() };
+        if (!work) throw std::bad_alloc();
+
+        // payload JSON: 고정 앞부분 + nonce (+ query_hash)
+        payload.assign(payload_prefix_);
+        appendUuidV4(payload);
+        if (!query_string.empty()) {
+            payload.append("\",\"query_hash\":\"");
+            appendSha512Hex(payload, query_string);
+            payload.append("\",\"query_hash_alg\":\"SHA512\"}");
+        }
+        else {
+            payload.append("\"}");
         }
 
-        const auto headerDump = header.dump();
-        const auto payloadDump = payload.dump();
+        // "Bearer " + header. + payload → 서명 입력은 "Bearer " 뒤 전체
+        out.clear();
+        out.reserve(bearer_prefix_.size() + (payload.size() * 4 + 2) / 3 + 1 + 86);
+        out.append(bearer_prefix_);
+        appendBase64Url(out, payload);
+
+        constexpr std::size_t kBearerLen = 7;  // "Bearer "
+        const auto* signing = reinterpret_cast<const unsigned char*>(out.data() + kBearerLen);
+        const std::size_t signing_len = out.size() - kBearerLen;
+
+        // HMAC = H((K^opad) || H((K^ipad) || msg)) - 패드 흡수 상태를 복사해 이어서 계산
+        std::array<unsigned char, kSha512DigestSize> inner{};
+        std::array<unsigned char, kSha512DigestSize> sig{};
+        unsigned int len = 0;
 
-        const auto encHeader = base64UrlEncode(reinterpret_cast<const unsigned char*>(headerDump.data()), headerDump.size());
-        const auto encPayload = base64UrlEncode(reinterpret_cast<const unsigned char*>(payloadDump.data()), payloadDump.size());
+        checkOk(EVP_MD_CTX_copy_ex(work.get(), hmac_inner_.get()), "inner copy");
+        checkOk(EVP_DigestUpdate(work.get(), signing, signing_len), "inner update");
+        checkOk(EVP_DigestFinal_ex(work.get(), inner.data(), &len), "inner final");
 
-        const std::string signingInput = encHeader + "." + encPayload;
-        const auto sigBin = hmacSha512(secret_, signingInput);
-        const auto encSig = base64UrlEncode(reinterpret_cast<const unsigned char*>(sigBin.data()), sigBin.size());
+        checkOk(EVP_MD_CTX_copy_ex(work.get(), hmac_outer_.get()), "outer copy");
+        checkOk(EVP_DigestUpdate(work.get(), inner.data(), inner.size()), "outer update");
+        checkOk(EVP_DigestFinal_ex(work.get(), sig.data(), &len), "outer final");
 
-        return "Bearer " + signingInput + "." + encSig;
+        out.push_back('.');
+        appendBase64Url(out, sig.data(), sig.size());
     }
 
 } // namespace api::auth
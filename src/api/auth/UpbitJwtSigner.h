@@ -1,21 +1,45 @@
-﻿#pragma once
+#pragma once
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+
+// OpenSSL 타입 전방 선언 (openssl 헤더를 공개 헤더에 노출하지 않기 위함)
+struct evp_md_ctx_st;
 
 namespace api::auth {
 
     // Upbit REST 인증 토큰 생성기(HS512 JWT)
+    // - 생성 시 1회: 인코딩된 header, payload 앞부분, HMAC 키 패드(ipad/opad) 다이제스트 상태 준비
+    // - 호출마다: nonce(UUID v4) + query_hash만 새로 만들고 서명 → 힙 할당 최소화
+    // - const 메서드는 스레드 안전 (호출별 작업 상태는 thread_local)
     class UpbitJwtSigner {
     public:
         UpbitJwtSigner(std::string accessKey, std::string secretKey);
+        ~UpbitJwtSigner();
+
+        UpbitJwtSigner(UpbitJwtSigner&&) noexcept;
+        UpbitJwtSigner& operator=(UpbitJwtSigner&&) noexcept;
+        UpbitJwtSigner(const UpbitJwtSigner&) = delete;
+        UpbitJwtSigner& operator=(const UpbitJwtSigner&) = delete;
 
         // query_string: "market=KRW-BTC&state=wait" 같은 원문 (정확히 이 문자열로 sha512)
         // 없으면 query_hash 없이 토큰 생성
         std::string makeBearerToken(std::optional<std::string> query_string = std::nullopt) const;
 
+        // out에 "Bearer <jwt>"를 덮어씀 (out의 기존 capacity 재사용)
+        // query_string이 비어 있으면 query_hash 생략
+        void writeBearerToken(std::string& out, std::string_view query_string = {}) const;
+
     private:
-        std::string access_;
-        std::string secret_;
+        struct MdCtxDeleter { void operator()(evp_md_ctx_st* p) const noexcept; };
+        using MdCtxPtr = std::unique_ptr<evp_md_ctx_st, MdCtxDeleter>;
+
+        std::string bearer_prefix_;     // "Bearer " + base64url(header) + "."
+        std::string payload_prefix_;    // {"access_key":"...","nonce":"
+
+        MdCtxPtr hmac_inner_;           // SHA512 상태: (key ^ ipad) 흡수 완료
+        MdCtxPtr hmac_outer_;           // SHA512 상태: (key ^ opad) 흡수 완료
     };
 
 }
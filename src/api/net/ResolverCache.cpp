@@ -0,0 +1,128 @@
+// api/net/ResolverCache.cpp
+#include "api/net/ResolverCache.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "util/Logger.h"
+
+namespace api::net {
+
+    using tcp = boost::asio::ip::tcp;
+
+    ResolverCache::ResolverCache()
+        : ResolverCache(Options{})
+    {
+    }
+
+    ResolverCache::ResolverCache(Options opt)
+        : opt_(opt)
+    {
+        refresher_ = std::jthread([this](std::stop_token stoken) { refreshLoop_(stoken); });
+    }
+
+    ResolverCache::~ResolverCache()
+    {
+        refresher_.request_stop();  // condition_variable_any 대기도 stop_token으로 깨어남
+        if (refresher_.joinable())
+            refresher_.join();
+    }
+
+    // 실제 DNS 해석 (락 밖에서 호출)
+    ResolverCache::Results ResolverCache::lookup_(const std::string& host, const std::string& port,
+        boost::system::error_code& ec)
+    {
+        tcp::resolver resolver(ioc_);
+        return resolver.resolve(host, port, ec);
+    }
+
+    ResolverCache::Results ResolverCache::resolve(const std::string& host, const std::string& port,
+        boost::system::error_code& ec)
+    {
+        ec.clear();
+        const Key key{ host, port };
+
+        {
+            std::lock_guard lock(mtx_);
+            auto it = entries_.find(key);
+            if (it != entries_.end() && Clock::now() < it->second.expires_at)
+            {
+                stats_.hits.fetch_add(1, std::memory_order_relaxed);
+                return it->second.results;
+            }
+        }
+
+        // 미스/만료: 동기 해석 (같은 키 동시 미스는 드묾 → 중복 해석 허용)
+        stats_.misses.fetch_add(1, std::memory_order_relaxed);
+        boost::system::error_code lookup_ec;
+        Results results = lookup_(host, port, lookup_ec);
+
+        std::lock_guard lock(mtx_);
+        if (lookup_ec || results.empty())
+        {
+            auto it = entries_.find(key);
+            if (it != entries_.end() && !it->second.results.empty())
+            {
+                stats_.stale_served.fetch_add(1, std::memory_order_relaxed);
+                return it->second.results;
+            }
+            ec = lookup_ec ? lookup_ec : boost::asio::error::host_not_found;
+            return Results{};
+        }
+
+        entries_[key] = Entry{ results, Clock::now() + opt_.ttl };
+        return results;
+    }
+
+    void ResolverCache::invalidate(const std::string& host, const std::string& port)
+    {
+        std::lock_guard lock(mtx_);
+        entries_.erase(Key{ host, port });
+    }
+
+    // ========== refreshLoop_ ==========
+    // 1초마다 만료 임박(refresh_ahead 이내) 항목을 다시 해석
+    // 실패 시 기존 결과 유지 (만료 후에는 resolve()가 동기 해석 → 실패 시 stale 사용)
+    void ResolverCache::refreshLoop_(std::stop_token stoken)
+    {
+        std::unique_lock lock(mtx_);
+        while (!stoken.stop_requested())
+        {
+            cv_.wait_for(lock, stoken, std::chrono::seconds(1), [] { return false; });
+            if (stoken.stop_requested()) break;
+
+            const auto deadline = Clock::now() + opt_.refresh_ahead;
+            std::vector<Key> due;
+            for (const auto& [key, entry] : entries_)
+            {
+                if (entry.expires_at <= deadline)
+                    due.push_back(key);
+            }
+            if (due.empty()) continue;
+
+            lock.unlock();
+            for (const auto& key : due)
+            {
+                boost::system::error_code ec;
+                Results results = lookup_(key.first, key.second, ec);
+
+                std::lock_guard relock(mtx_);
+                auto it = entries_.find(key);
+                if (it == entries_.end()) continue;     // 그 사이 invalidate됨
+
+                if (ec || results.empty())
+                {
+                    stats_.refresh_failures.fetch_add(1, std::memory_order_relaxed);
+                    COINBOT_LOG_WARN("[ResolverCache] refresh failed", util::kv("host", key.first),
+                        util::kv("error", ec ? ec.message() : std::string("empty")));
+                    continue;
+                }
+
+                it->second = Entry{ std::move(results), Clock::now() + opt_.ttl };
+                stats_.refreshes.fetch_add(1, std::memory_order_relaxed);
+            }
+            lock.lock();
+        }
+    }
+
+} // namespace api::net
@@ -0,0 +1,90 @@
+// api/net/ResolverCache.h
+//
+// DNS 해석 결과 공유 캐시 (REST/WS 공용)
+// - (host, port) → 마지막 해석 결과를 TTL 동안 재사용 → 연결마다 resolve 왕복 제거
+// - 백그라운드 스레드가 만료 임박 항목을 미리 갱신 (요청 경로에서 DNS 대기 없음)
+// - 갱신/해석 실패 시 이전 결과를 계속 사용 (DNS 일시 장애가 연결 실패로 번지지 않도록)
+// - 연결 실패 시 invalidate()로 즉시 폐기 → 다음 호출에서 새로 해석
+//
+// 스레드 안전: 모든 public 메서드는 여러 스레드에서 동시 호출 가능
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace api::net {
+
+    class ResolverCache final {
+    public:
+        using Results = boost::asio::ip::tcp::resolver::results_type;
+
+        struct Options {
+            std::chrono::seconds ttl{ 60 };             // 해석 결과 유효 시간
+            std::chrono::seconds refresh_ahead{ 10 };   // 만료 이 시간 전에 백그라운드 갱신
+        };
+
+        ResolverCache();
+        explicit ResolverCache(Options opt);
+        ~ResolverCache();
+
+        ResolverCache(const ResolverCache&) = delete;
+        ResolverCache& operator=(const ResolverCache&) = delete;
+
+        // 캐시 적중 시 즉시 반환, 미스/만료 시 동기 해석 후 저장
+        // 해석 실패 + 이전 결과 존재 → 이전 결과 반환 (ec 비움)
+        Results resolve(const std::string& host, const std::string& port,
+                        boost::system::error_code& ec);
+
+        // 연결 실패 등으로 결과를 신뢰할 수 없을 때 폐기
+        void invalidate(const std::string& host, const std::string& port);
+
+        struct Stats {
+            std::atomic<std::uint64_t> hits{ 0 };
+            std::atomic<std::uint64_t> misses{ 0 };             // 동기 해석 수행
+            std::atomic<std::uint64_t> stale_served{ 0 };       // 해석 실패로 이전 결과 사용
+            std::atomic<std::uint64_t> refreshes{ 0 };          // 백그라운드 갱신 성공
+            std::atomic<std::uint64_t> refresh_failures{ 0 };
+        };
+
+        const Stats& stats() const noexcept { return stats_; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        using Key = std::pair<std::string, std::string>;    // (host, port)
+
+        struct Entry {
+            Results results;
+            Clock::time_point expires_at{};
+        };
+
+        Results lookup_(const std::string& host, const std::string& port,
+                        boost::system::error_code& ec);
+        void refreshLoop_(std::stop_token stoken);
+
+        Options opt_;
+
+        // 동기 resolve 전용 (run() 불필요, 호출마다 지역 resolver 생성)
+        boost::asio::io_context ioc_;
+
+        std::mutex mtx_;
+        std::condition_variable_any cv_;
+        std::map<Key, Entry> entries_;
+
+        Stats stats_;
+
+        std::jthread refresher_;
+    };
+
+} // namespace api::net
@@ -0,0 +1,107 @@
+// api/net/TlsSessionCache.cpp
+#include "api/net/TlsSessionCache.h"
+
+#include <utility>
+
+#include <openssl/ssl.h>
+
+namespace api::net {
+
+    // SSL_CTX ex_data 슬롯 (프로세스 전체 1회 할당)
+    int TlsSessionCache::exIndex_()
+    {
+        static const int idx = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+        return idx;
+    }
+
+    TlsSessionCache::TlsSessionCache(boost::asio::ssl::context& ctx)
+        : ctx_(ctx.native_handle())
+    {
+        // 클라이언트 세션 콜백 활성화, OpenSSL 내부 캐시는 사용하지 않음 (호스트별로 직접 관리)
+        SSL_CTX_set_ex_data(ctx_, exIndex_(), this);
+        SSL_CTX_set_session_cache_mode(ctx_, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        SSL_CTX_sess_set_new_cb(ctx_, &TlsSessionCache::onNewSession_);
+    }
+
+    TlsSessionCache::~TlsSessionCache()
+    {
+        SSL_CTX_sess_set_new_cb(ctx_, nullptr);
+        SSL_CTX_set_ex_data(ctx_, exIndex_(), nullptr);
+
+        std::lock_guard lock(mtx_);
+        for (auto& [host, session] : sessions_)
+            SSL_SESSION_free(session);
+        sessions_.clear();
+    }
+
+    // 서버가 세션을 발급할 때마다 호출 (TLS 1.3은 핸드셰이크 이후 티켓 수신 시점)
+    // 1 반환 = 세션 참조 소유권을 가져감
+    int TlsSessionCache::onNewSession_(SSL* ssl, SSL_SESSION* session)
+    {
+        auto* self = static_cast<TlsSessionCache*>(
+            SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), exIndex_()));
+        const char* host = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+        if (!self || !host)
+            return 0;
+
+        self->store_(host, session);
+        return 1;
+    }
+
+    void TlsSessionCache::store_(std::string host, SSL_SESSION* session)
+    {
+        SSL_SESSION* old = nullptr;
+        {
+            std::lock_guard lock(mtx_);
+            auto [it, inserted] = sessions_.try_emplace(std::move(host), session);
+            if (!inserted)
+            {
+                old = it->second;
+                it->second = session;
+            }
+        }
+        if (old) SSL_SESSION_free(old);
+        stats_.sessions_stored.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool TlsSessionCache::apply(SSL* ssl, const std::string& host)
+    {
+        std::lock_guard lock(mtx_);
+        auto it = sessions_.find(host);
+        if (it == sessions_.end())
+            return false;
+
+        // 비정상 종료된 TLS 1.2 연결의 세션 등은 재사용 불가로 표시됨 → 폐기
+        if (!SSL_SESSION_is_resumable(it->second))
+        {
+            SSL_SESSION_free(it->second);
+            sessions_.erase(it);
+            return false;
+        }
+
+        // SSL_set_session은 자체 참조를 추가 → 캐시 참조는 그대로 유지
+        if (SSL_set_session(ssl, it->second) != 1)
+            return false;
+
+        stats_.offered.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void TlsSessionCache::recordHandshake(SSL* ssl, std::int64_t elapsed_ns)
+    {
+        const bool resumed = SSL_session_reused(ssl) == 1;
+
+        std::lock_guard lock(stats_mtx_);
+        if (resumed)
+        {
+            stats_.resumed_handshakes.fetch_add(1, std::memory_order_relaxed);
+            stats_.resumed_latency.record(elapsed_ns);
+        }
+        else
+        {
+            stats_.full_handshakes.fetch_add(1, std::memory_order_relaxed);
+            stats_.full_latency.record(elapsed_ns);
+        }
+    }
+
+} // namespace api::net
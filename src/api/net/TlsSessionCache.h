@@ -0,0 +1,70 @@
+// api/net/TlsSessionCache.h
+//
+// TLS 클라이언트 세션 재사용 캐시 (REST/WS 공용 ssl::context에 설치)
+// - 서버가 보낸 세션(TLS 1.3 NewSessionTicket / TLS 1.2 세션)을 SNI 호스트별로 보관
+// - 새 연결의 핸드셰이크 전에 apply()로 세션을 지정 → 약식 핸드셰이크 (인증서 체인 검증/키 교환 생략)
+// - 핸드셰이크 소요 시간을 full/resumed로 나눠 기록 (재사용 효과를 메트릭으로 비교)
+//
+// OpenSSL 연동:
+// - SSL_CTX_set_session_cache_mode(CLIENT | NO_INTERNAL_STORE) + new_session_cb로 세션 수신
+// - 콜백에서 this는 SSL_CTX ex_data로 찾음 (ssl::context 1개당 캐시 1개)
+//
+// 수명: ssl::context보다 먼저 소멸해야 함 (소멸자에서 콜백 해제)
+// 스레드 안전: apply()/recordHandshake()는 여러 스레드에서 동시 호출 가능
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <boost/asio/ssl/context.hpp>
+
+#include "util/LatencyHistogram.h"
+
+namespace api::net {
+
+    class TlsSessionCache final {
+    public:
+        explicit TlsSessionCache(boost::asio::ssl::context& ctx);
+        ~TlsSessionCache();
+
+        TlsSessionCache(const TlsSessionCache&) = delete;
+        TlsSessionCache& operator=(const TlsSessionCache&) = delete;
+
+        // 핸드셰이크 전 호출 (SNI 설정 이후): 저장된 재사용 가능 세션이 있으면 지정
+        // @return 세션을 지정했으면 true
+        bool apply(SSL* ssl, const std::string& host);
+
+        // 핸드셰이크 성공 직후 호출: 재사용 여부에 따라 full/resumed 통계 기록
+        void recordHandshake(SSL* ssl, std::int64_t elapsed_ns);
+
+        struct Stats {
+            std::atomic<std::uint64_t> full_handshakes{ 0 };
+            std::atomic<std::uint64_t> resumed_handshakes{ 0 };
+            std::atomic<std::uint64_t> offered{ 0 };            // apply()로 세션 지정한 수
+            std::atomic<std::uint64_t> sessions_stored{ 0 };    // 서버로부터 받은 세션 수
+            util::LatencyHistogram full_latency;                // TLS 핸드셰이크 (TCP connect 제외)
+            util::LatencyHistogram resumed_latency;
+        };
+
+        const Stats& stats() const noexcept { return stats_; }
+
+    private:
+        static int onNewSession_(SSL* ssl, SSL_SESSION* session);
+        static int exIndex_();
+
+        void store_(std::string host, SSL_SESSION* session);
+
+        SSL_CTX* ctx_;
+
+        std::mutex mtx_;
+        std::unordered_map<std::string, SSL_SESSION*> sessions_;    // SNI host → 최신 세션 (참조 1개 보유)
+
+        std::mutex stats_mtx_;      // LatencyHistogram 단일 writer 전제 유지 (기록 구간만)
+        Stats stats_;
+    };
+
+} // namespace api::net
@@ -10,6 +10,10 @@
 #include <boost/beast/http.hpp>
 #include <boost/beast/ssl.hpp>
 
+#include "api/net/ResolverCache.h"
+#include "api/net/TlsSessionCache.h"
+#include "util/LatencyHistogram.h"
+
 namespace api::rest
 {
 	namespace beast = boost::beast;
@@ -50,8 +54,9 @@ namespace api::rest
 		return ec == net::error::eof || ec == ssl::error::stream_truncated;
 	}
 
-	RestClient::RestClient(net::io_context& ioc, ssl::context& ssl_ctx)
-		: ioc_(ioc), ssl_ctx_(ssl_ctx) {}
+	RestClient::RestClient(net::io_context& ioc, ssl::context& ssl_ctx,
+		api::net::ResolverCache* dns, api::net::TlsSessionCache* tls)
+		: ioc_(ioc), ssl_ctx_(ssl_ctx), dns_(dns), tls_(tls) {}
 
 	// HTTP status 기반 재시도는 서버가 응답한 경우에만 적용한다.
 	bool RestClient::shouldRetryStatus(int status, const RetryPolicy& p) noexcept
@@ -143,8 +148,17 @@ namespace api::rest
 		beast::error_code ec;
 
 		// Resolve를 먼저 수행해 DNS 실패와 connect 실패를 구분한다.
-		tcp::resolver resolver(ioc_);
-		auto results = resolver.resolve(req.host, req.port, ec);
+		// 공유 캐시가 있으면 TTL 동안 이전 결과를 재사용한다.
+		tcp::resolver::results_type results;
+		if (dns_)
+		{
+			results = dns_->resolve(req.host, req.port, ec);
+		}
+		else
+		{
+			tcp::resolver resolver(ioc_);
+			results = resolver.resolve(req.host, req.port, ec);
+		}
 		if (ec)
 		{
 			if (isTimeoutEc(ec))
@@ -168,13 +182,21 @@ namespace api::rest
 		beast::get_lowest_layer(stream).connect(results, ec);
 		if (ec)
 		{
+			// 캐시된 주소가 더 이상 유효하지 않을 수 있으므로 다음 시도에서 새로 해석
+			if (dns_) dns_->invalidate(req.host, req.port);
 			if (isTimeoutEc(ec))
 				return makeError(RestErrorCode::Timeout, ec);
 			return makeError(RestErrorCode::ConnectFailed, ec);
 		}
 
+		// 이전 연결에서 받은 세션이 있으면 약식 핸드셰이크 시도
+		if (tls_) tls_->apply(stream.native_handle(), req.host);
+
 		beast::get_lowest_layer(stream).expires_after(req.timeout);
+		const auto handshake_start = util::monoNowNs();
 		stream.handshake(ssl::stream_base::client, ec);
+		if (!ec && tls_)
+			tls_->recordHandshake(stream.native_handle(), util::monoNowNs() - handshake_start);
 		if (ec)
 		{
 			if (isTimeoutEc(ec))
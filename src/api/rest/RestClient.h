@@ -12,6 +12,8 @@
 // 동기 HTTPS 호출과 재시도 정책 적용을 캡슐화한다.
 // 호출자는 HttpRequest만 구성하고, 실패는 RestError로 일관되게 받는다.
 
+namespace api::net { class ResolverCache; class TlsSessionCache; }
+
 namespace api::rest
 {
 	// 예외 대신 성공/실패를 같은 반환 경로로 묶어 호출부 분기를 단순하게 한다.
@@ -21,8 +23,11 @@ namespace api::rest
 	{
 	public:
 		// io_context와 ssl_context는 외부가 수명을 관리하고 RestClient는 재사용만 한다.
+		// dns/tls 캐시도 외부 소유(WS와 공유), nullptr이면 매번 resolve + full handshake
 		RestClient(boost::asio::io_context& ioc,
-			boost::asio::ssl::context& ssl_ctx);
+			boost::asio::ssl::context& ssl_ctx,
+			api::net::ResolverCache* dns = nullptr,
+			api::net::TlsSessionCache* tls = nullptr);
 
 		// perform은 1회 호출과 재시도 정책 적용을 함께 처리한다.
 		Result perform(const HttpRequest& req, const RetryPolicy& retry = RetryPolicy{}) const;
@@ -38,5 +43,7 @@ namespace api::rest
 
 		boost::asio::io_context& ioc_;
 		boost::asio::ssl::context& ssl_ctx_;
+		api::net::ResolverCache* dns_;
+		api::net::TlsSessionCache* tls_;
 	};
 }
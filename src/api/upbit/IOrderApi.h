@@ -74,6 +74,15 @@ namespace api::upbit
         virtual std::variant<core::Order, api::rest::RestError>
             getOrder(std::string_view order_uuid) = 0;
 
+        /*
+         * GET /v1/orders/uuids?uuids[]=...&uuids[]=...
+         * 여러 주문 일괄 조회 (복구 코디네이터가 마켓 구분 없이 모아서 호출, 최대 100개)
+         * - 응답에 없는 uuid는 결과에서 빠짐 (호출자가 누락 판단)
+         * - trades 목록이 없으므로 executed_funds 누락 시 getOrder로 보강 필요
+         */
+        virtual std::variant<std::vector<core::Order>, api::rest::RestError>
+            getOrdersByUuids(const std::vector<std::string>& order_uuids) = 0;
+
         /*
          * POST /v1/orders
          * 주문 제출 (매수/매도)
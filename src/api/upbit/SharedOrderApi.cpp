@@ -1,6 +1,10 @@
 ﻿// src/api/upbit/SharedOrderApi.cpp
 
 #include "SharedOrderApi.h"
+
+#include <algorithm>
+#include <thread>
+
 #include "api/upbit/UpbitExchangeRestClient.h"
 
 namespace api::upbit {
@@ -25,9 +29,86 @@ namespace api::upbit {
         };
     } // namespace
 
+    // 진입 게이트 RAII: 슬롯 확보 + 요청 시작 간격 대기 → 소멸 시 슬롯 반환
+    // - is_order: 주문 생성/취소 경로 → 주문 그룹 간격(min_order_interval)도 함께 적용
+    class SharedOrderApi::Permit {
+    public:
+        explicit Permit(SharedOrderApi& api, bool is_order = false) : api_(api)
+        {
+            std::chrono::steady_clock::time_point start_at;
+            {
+                std::unique_lock lock(api_.gate_mtx_);
+                api_.gate_cv_.wait(lock, [&] { return api_.active_ < api_.opt_.max_in_flight; });
+                ++api_.active_;
+
+                // 시작 시각 예약 (대기는 락 밖에서 → 다른 호출이 다음 시각을 이어서 예약)
+                start_at = std::max(std::chrono::steady_clock::now(), api_.next_start_);
+                if (is_order) {
+                    start_at = std::max(start_at, api_.next_order_start_);
+                    api_.next_order_start_ = start_at + api_.opt_.min_order_interval;
+                }
+                api_.next_start_ = start_at + api_.opt_.min_request_interval;
+            }
+            if (start_at > std::chrono::steady_clock::now())
+                std::this_thread::sleep_until(start_at);
+        }
+
+        ~Permit()
+        {
+            {
+                std::lock_guard lock(api_.gate_mtx_);
+                --api_.active_;
+            }
+            api_.gate_cv_.notify_one();
+        }
+
+        Permit(const Permit&) = delete;
+        Permit& operator=(const Permit&) = delete;
+
+    private:
+        SharedOrderApi& api_;
+    };
+
+    const char* SharedOrderApi::toString(Endpoint e) noexcept
+    {
+        switch (e) {
+        case Endpoint::GetAccount:    return "get_account";
+        case Endpoint::GetOpenOrders: return "get_open_orders";
+        case Endpoint::CancelOrder:   return "cancel_order";
+        case Endpoint::GetOrder:      return "get_order";
+        case Endpoint::GetOrdersByUuids: return "get_orders_by_uuids";
+        case Endpoint::PostOrder:     return "post_order";
+        default:                      return "unknown";
+        }
+    }
+
+    template <typename F>
+    auto SharedOrderApi::timed_(Endpoint e, F&& call)
+    {
+        auto& st = endpoint_stats_[static_cast<std::size_t>(e)];
+        const auto start = util::monoNowNs();
+
+        auto result = call();
+
+        std::lock_guard lock(stats_mtx_);
+        st.latency.recordSince(start);
+        st.calls.fetch_add(1, std::memory_order_relaxed);
+        if (std::holds_alternative<api::rest::RestError>(result))
+            st.errors.fetch_add(1, std::memory_order_relaxed);
+        return result;
+    }
+
     SharedOrderApi::SharedOrderApi(std::unique_ptr<api::rest::UpbitExchangeRestClient> client)
+        : SharedOrderApi(std::move(client), Options{})
+    {
+    }
+
+    SharedOrderApi::SharedOrderApi(std::unique_ptr<api::rest::UpbitExchangeRestClient> client, Options opt)
         : client_(std::move(client))
+        , opt_(opt)
     {
+        opt_.max_in_flight = std::max<std::size_t>(1, opt_.max_in_flight);
+
         if (!client_) {
             throw std::invalid_argument("SharedOrderApi: client cannot be null");
         }
@@ -36,55 +117,64 @@ namespace api::upbit {
     std::variant<core::Account, api::rest::RestError>
     SharedOrderApi::getMyAccount()
     {
-        std::lock_guard<std::mutex> lock(mtx_);
+        Permit permit(*this);
 
-        // IMPORTANT: increment happens *after* lock acquired (this is the proof point)
+        // IMPORTANT: increment happens *after* permit acquired (this is the proof point)
         InFlightGuard g(in_flight_, max_in_flight_);
 
-        return client_->getMyAccount();
+        return timed_(Endpoint::GetAccount, [&] { return client_->getMyAccount(); });
     }
 
     std::variant<std::vector<core::Order>, api::rest::RestError>
     SharedOrderApi::getOpenOrders(std::string_view market)
     {
-        std::lock_guard<std::mutex> lock(mtx_);
+        Permit permit(*this);
 
-        // IMPORTANT: increment happens *after* lock acquired (this is the proof point)
+        // IMPORTANT: increment happens *after* permit acquired (this is the proof point)
         InFlightGuard g(in_flight_, max_in_flight_);
 
-        return client_->getOpenOrders(market);
+        return timed_(Endpoint::GetOpenOrders, [&] { return client_->getOpenOrders(market); });
     }
 
     std::variant<bool, api::rest::RestError>
     SharedOrderApi::cancelOrder(const std::optional<std::string>& order_uuid,
                                  const std::optional<std::string>& identifier)
     {
-        std::lock_guard<std::mutex> lock(mtx_);
+        Permit permit(*this, /*is_order=*/true);
 
-        // IMPORTANT: increment happens *after* lock acquired (this is the proof point)
+        // IMPORTANT: increment happens *after* permit acquired (this is the proof point)
         InFlightGuard g(in_flight_, max_in_flight_);
 
-        return client_->cancelOrder(order_uuid, identifier);
+        return timed_(Endpoint::CancelOrder, [&] { return client_->cancelOrder(order_uuid, identifier); });
     }
 
     // 단건 주문 조회
     std::variant<core::Order, api::rest::RestError>
     SharedOrderApi::getOrder(std::string_view order_uuid)
     {
-        std::lock_guard<std::mutex> lock(mtx_);
+        Permit permit(*this);
+        InFlightGuard g(in_flight_, max_in_flight_);
+        return timed_(Endpoint::GetOrder, [&] { return client_->getOrder(order_uuid); });
+    }
+
+    // 여러 주문 일괄 조회
+    std::variant<std::vector<core::Order>, api::rest::RestError>
+    SharedOrderApi::getOrdersByUuids(const std::vector<std::string>& order_uuids)
+    {
+        Permit permit(*this);
         InFlightGuard g(in_flight_, max_in_flight_);
-        return client_->getOrder(order_uuid);
+        return timed_(Endpoint::GetOrdersByUuids, [&] { return client_->getOrdersByUuids(order_uuids); });
     }
 
     std::variant<std::string, api::rest::RestError>
     SharedOrderApi::postOrder(const core::OrderRequest& req)
     {
-        std::lock_guard<std::mutex> lock(mtx_);
+        Permit permit(*this, /*is_order=*/true);
 
-        // IMPORTANT: increment happens *after* lock acquired (this is the proof point)
+        // IMPORTANT: increment happens *after* permit acquired (this is the proof point)
         InFlightGuard g(in_flight_, max_in_flight_);
 
-        return client_->postOrder(req);
+        return timed_(Endpoint::PostOrder, [&] { return client_->postOrder(req); });
     }
 
 } // namespace api::upbit
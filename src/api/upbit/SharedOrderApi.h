@@ -1,7 +1,12 @@
 // src/api/upbit/SharedOrderApi.h
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -15,6 +20,7 @@
 #include "core/domain/Order.h"
 #include "core/domain/OrderRequest.h"
 #include "api/rest/RestError.h"
+#include "util/LatencyHistogram.h"
 
 // Forward declaration
 namespace api::rest {
@@ -31,25 +37,34 @@ namespace api::upbit {
      * UpbitExchangeRestClient를 thread-safe하게 공유할 수 있도록 감싸는 래퍼
      *
      * [설계]
-     * - 내부에 UpbitExchangeRestClient를 보유하고 모든 호출을 mutex로 직렬화
-     * - 각 마켓 스레드는 이 객체를 shared_ptr로 공유
-     * - Upbit API는 초당 요청 제한(rate limit)이 있으므로, 직렬화가 필수
+     * - 내부에 UpbitExchangeRestClient를 보유하고 동시 호출 수를 Options::max_in_flight로 제한
+     *   (기본 1 = 모든 호출 직렬화, 시작 시 마켓별 복구 fan-out 등은 2 이상으로 병렬화)
+     * - Upbit API는 초당 요청 제한(rate limit)이 있으므로 요청 시작 간격을
+     *   Options::min_request_interval 이상으로 벌림 (0이면 간격 제한 없음)
+     * - 주문 생성/취소는 별도 그룹 제한(초당 8회)이 있어 Options::min_order_interval로
+     *   주문 경로끼리의 시작 간격을 추가로 벌림
+     * - 각 마켓 스레드는 이 객체를 공유
      * - IOrderApi 인터페이스 구현 (의존성 역전, 테스트 가능성)
      *
      * [확장 포인트]
-     * 1. Rate Limiting: 추후 요청 간 최소 시간 간격 적용 가능 (예: 100ms)
-     * 2. Request Queueing: 우선순위 큐로 긴급 주문(취소) 우선 처리
-     * 3. Metrics: 요청 수, 실패율, 평균 응답 시간 등 수집
-     * 4. Circuit Breaker: 연속 실패 시 일시 중단 및 복구
+     * 1. Request Queueing: 우선순위 큐로 긴급 주문(취소) 우선 처리
+     * 2. Circuit Breaker: 연속 실패 시 일시 중단 및 복구
      *
      * [Thread-Safety]
-     * - 모든 public 메서드는 std::lock_guard로 보호됨
-     * - 내부 UpbitExchangeRestClient는 단일 스레드에서만 호출됨
+     * - 모든 public 메서드는 진입 게이트(gate_mtx_)로 동시 실행 수를 제한
+     * - UpbitExchangeRestClient는 호출마다 독립 연결 + thread_local 서명 상태라 병렬 호출 안전
      */
     class SharedOrderApi : public IOrderApi {
     public:
+        struct Options {
+            std::size_t max_in_flight = 1;                      // 동시 REST 호출 상한 (1 = 직렬화)
+            std::chrono::milliseconds min_request_interval{0};  // 요청 시작 간 최소 간격
+            std::chrono::milliseconds min_order_interval{0};    // 주문 생성/취소 시작 간 최소 간격
+        };
+
         // UpbitExchangeRestClient의 unique ownership을 받음
         explicit SharedOrderApi(std::unique_ptr<api::rest::UpbitExchangeRestClient> client);
+        SharedOrderApi(std::unique_ptr<api::rest::UpbitExchangeRestClient> client, Options opt);
 
         // Copy 금지 (mutex는 복사 불가)
         SharedOrderApi(const SharedOrderApi&) = delete;
@@ -84,6 +99,11 @@ namespace api::upbit {
         std::variant<core::Order, api::rest::RestError>
             getOrder(std::string_view order_uuid) override;
 
+        // GET /v1/orders/uuids?uuids[]=...
+        // - 여러 주문 일괄 조회 (복구용)
+        std::variant<std::vector<core::Order>, api::rest::RestError>
+            getOrdersByUuids(const std::vector<std::string>& order_uuids) override;
+
         // POST /v1/orders
         // - 주문 제출 (매수/매도)
         // - 반환값: Upbit 주문 order_uuid (Order.id로 사용)
@@ -91,6 +111,32 @@ namespace api::upbit {
             postOrder(const core::OrderRequest& req) override;
 
 
+        // --- 엔드포인트별 메트릭 (호출 수/에러 수/지연) ---
+        enum class Endpoint : std::size_t {
+            GetAccount = 0,
+            GetOpenOrders,
+            CancelOrder,
+            GetOrder,
+            GetOrdersByUuids,
+            PostOrder,
+            Count
+        };
+
+        static constexpr std::size_t kEndpointCount = static_cast<std::size_t>(Endpoint::Count);
+
+        static const char* toString(Endpoint e) noexcept;
+
+        // 기록은 stats_mtx_ 안에서만 (직렬화된 단일 writer), 읽기는 락 없이
+        struct EndpointStats {
+            std::atomic<std::uint64_t> calls{0};
+            std::atomic<std::uint64_t> errors{0};       // RestError 반환 수 (재시도 후 최종 실패)
+            util::LatencyHistogram latency;             // mutex 대기 제외, REST 왕복(재시도 포함)
+        };
+
+        const EndpointStats& endpointStats(Endpoint e) const noexcept {
+            return endpoint_stats_[static_cast<std::size_t>(e)];
+        }
+
         // --- Test-only / Debug instrumentation ---
         int debugMaxInFlight() const noexcept { return max_in_flight_.load(); }
 
@@ -102,15 +148,30 @@ namespace api::upbit {
     private:
         std::unique_ptr<api::rest::UpbitExchangeRestClient> client_;
 
-        // 멀티스레드 동시 호출 직렬화용 뮤텍스
-        // 확장 포인트: 읽기 전용 API(getMyAccount, getOpenOrders)는
-        //               shared_mutex로 병렬화 가능 (추후 최적화)
-        mutable std::mutex mtx_;
+        Options opt_;
+
+        // 진입 게이트: 실행 중 호출 수 + 다음 요청 시작 가능 시각 (REST 호출 자체는 락 밖)
+        std::mutex gate_mtx_;
+        std::condition_variable gate_cv_;
+        std::size_t active_{ 0 };
+        std::chrono::steady_clock::time_point next_start_{};
+        std::chrono::steady_clock::time_point next_order_start_{};   // 주문 경로 전용
+
+        // 동시 호출 시 LatencyHistogram 단일 writer 전제 유지용 (기록 구간만 보호)
+        std::mutex stats_mtx_;
+
+        class Permit;
 
         // 테스트 용
         // Instrumentation counters (atomic so even if lock breaks, it still records concurrency)
-        std::atomic<int> in_flight_{ 0 };       // 현재 mutex 안에 들어와 실행 중인 호출 수
+        std::atomic<int> in_flight_{ 0 };       // 현재 Permit을 보유하고 실행 중인 호출 수
         std::atomic<int> max_in_flight_{ 0 };
+
+        // Permit 보유 상태에서 호출: client_ 호출 1회를 계측
+        template <typename F>
+        auto timed_(Endpoint e, F&& call);
+
+        std::array<EndpointStats, kEndpointCount> endpoint_stats_{};
     };
 
 } // namespace api::upbit
@@ -382,6 +382,59 @@ namespace api::rest {
         return api::upbit::mapper::toDomain(dto);
     }
 
+    // GET /v1/orders/uuids?uuids[]=...&uuids[]=...
+    // 여러 주문 일괄 조회 — 복구 코디네이터가 마켓별 pending 주문을 모아 1회로 조회
+    // 응답은 trades 없는 주문 목록(array) → 누락 필드를 "0"으로 정규화하는 WaitOrderResponseDto 재사용
+    std::variant<std::vector<core::Order>, api::rest::RestError>
+        UpbitExchangeRestClient::getOrdersByUuids(const std::vector<std::string>& order_uuids)
+    {
+        if (order_uuids.empty())
+            return std::vector<core::Order>{};
+        if (order_uuids.size() > kMaxOrdersByUuids)
+            return makeInvalidArgumentError("getOrdersByUuids: too many uuids (max 100)");
+
+        std::vector<std::pair<std::string, std::string>> params;
+        params.reserve(order_uuids.size());
+        for (const auto& order_uuid : order_uuids)
+            params.emplace_back("uuids[]", order_uuid);
+        const auto qs = makeQueryStrings(params);
+
+        api::rest::HttpRequest req;
+        req.host = "api.upbit.com";
+        req.port = "443";
+        req.method = api::rest::HttpMethod::Get;
+        req.target = std::string("/v1/orders/uuids?") + qs.encoded;
+
+        req.headers.emplace("Accept", "application/json");
+        req.headers.emplace("Authorization", signer_.makeBearerToken(qs.hash));
+
+        auto r = rest_.perform(req);
+        if (std::holds_alternative<api::rest::RestError>(r))
+            return std::get<api::rest::RestError>(r);
+
+        const auto& resp = std::get<api::rest::HttpResponse>(r);
+        if (!isSuccessStatus(resp.status))
+            return makeHttpStatusError(resp.status, "Upbit GET /v1/orders/uuids", resp.body);
+
+        nlohmann::json j;
+        try {
+            j = nlohmann::json::parse(resp.body);
+        }
+        catch (const std::exception& ex) {
+            return makeParseError(resp.status, "Upbit GET /v1/orders/uuids", ex.what(), resp.body);
+        }
+
+        api::upbit::dto::WaitOrdersResponseDto dtoList;
+        try {
+            dtoList = j.get<api::upbit::dto::WaitOrdersResponseDto>();
+        }
+        catch (const std::exception& ex) {
+            return makeParseError(resp.status, "Upbit GET /v1/orders/uuids (DTO)", ex.what(), resp.body);
+        }
+
+        return api::upbit::mapper::toDomain(dtoList);
+    }
+
     // DELETE /v1/order?uuid=... 또는 identifier=...
     std::variant<bool, api::rest::RestError>
         UpbitExchangeRestClient::cancelOrder(const std::optional<std::string>& order_uuid,
@@ -430,8 +483,8 @@ namespace api::rest {
         UpbitExchangeRestClient::postOrder(const core::OrderRequest& reqIn)
     {
         // 주문 파라미터를 먼저 남겨두면 실거래 실패 시 어떤 요청이 나갔는지 추적하기 쉽다.
-        util::Logger::instance().debug("[REST][postOrder] ENTER market=", reqIn.market,
-                                       " type=", static_cast<int>(reqIn.type));
+        COINBOT_LOG_DEBUG("[REST][postOrder] ENTER", util::kv("market", reqIn.market),
+                          util::kv("type", static_cast<int>(reqIn.type)));
 
         // 0) 입력 검증 (실거래에서 가장 취약한 부분이 입력 값 오류로 인한 BadRequest)
         if (reqIn.market.empty())
@@ -503,8 +556,8 @@ namespace api::rest {
         http.body = jsonBody.dump();
 
         // 요청이 어떤 ord_type/size로 만들어졌는지 확인
-        util::Logger::instance().debug("[REST][postOrder] REQ target=", http.target,
-                                       " body=", http.body);
+        COINBOT_LOG_DEBUG("[REST][postOrder] REQ", util::kv("target", http.target),
+                          util::kv("body", http.body));
 
         auto r = rest_.perform(http);
 
@@ -37,6 +37,13 @@ namespace api::rest {
         std::variant<core::Order, api::rest::RestError>
             getOrder(std::string_view order_uuid);
 
+        // GET /v1/orders/uuids?uuids[]=...&uuids[]=...
+        // - 여러 주문 일괄 조회 (복구용, 최대 kMaxOrdersByUuids개)
+        // - 빈 목록이면 요청 없이 빈 결과
+        static constexpr std::size_t kMaxOrdersByUuids = 100;
+        std::variant<std::vector<core::Order>, api::rest::RestError>
+            getOrdersByUuids(const std::vector<std::string>& order_uuids);
+
         // POST /v1/orders
         // - core::OrderRequest -> Upbit order create
         // - 반환 core::Order.id 는 Upbit order_uuid
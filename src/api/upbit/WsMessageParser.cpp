@@ -32,6 +32,41 @@ namespace {
         return unit;
     }
 
+    // key("\"name\":" 형태) 뒤 값 토큰 (문자열은 따옴표 제외), 없으면 nullopt
+    // Upbit 응답은 공백 없는 평면 object → 중첩/이스케이프 처리 불필요
+    std::optional<std::string_view> findValue(std::string_view json, std::string_view key) noexcept
+    {
+        const auto pos = json.find(key);
+        if (pos == std::string_view::npos)
+            return std::nullopt;
+
+        std::size_t b = pos + key.size();
+        while (b < json.size() && json[b] == ' ') ++b;
+        if (b >= json.size())
+            return std::nullopt;
+
+        if (json[b] == '"')
+        {
+            const auto e = json.find('"', b + 1);
+            if (e == std::string_view::npos)
+                return std::nullopt;
+            return json.substr(b + 1, e - b - 1);
+        }
+
+        std::size_t e = b;
+        while (e < json.size() && json[e] != ',' && json[e] != '}') ++e;
+        return json.substr(b, e - b);
+    }
+
+    template <typename T>
+    bool parseNumber(std::optional<std::string_view> token, T& out) noexcept
+    {
+        if (!token || token->empty())
+            return false;
+        const auto [ptr, ec] = std::from_chars(token->data(), token->data() + token->size(), out);
+        return ec == std::errc{};
+    }
+
 } // anonymous namespace
 
 namespace api::upbit::ws {
@@ -102,4 +137,85 @@ std::optional<WsCandleResult> parseCandle(
     return WsCandleResult{api::upbit::mappers::toDomain(candleDto), unit};
 }
 
+std::optional<WsTrade> parseTrade(std::string_view json, std::string_view market)
+{
+    const auto type = findValue(json, "\"type\":");
+    if (!type || *type != "trade")
+        return std::nullopt;    // non-trade 정상 경로: silent drop
+
+    WsTrade t{};
+    const bool ok =
+        parseNumber(findValue(json, "\"trade_price\":"), t.price) &&
+        parseNumber(findValue(json, "\"trade_volume\":"), t.volume) &&
+        parseNumber(findValue(json, "\"trade_timestamp\":"), t.timestamp_ms);
+    if (!ok || t.price <= 0.0)
+    {
+        util::Logger::instance().warn("[WsParser][", market, "] trade field parse failed");
+        return std::nullopt;
+    }
+
+    (void)parseNumber(findValue(json, "\"sequential_id\":"), t.sequential_id);
+    t.is_bid = findValue(json, "\"ask_bid\":") == std::optional<std::string_view>("BID");
+    return t;
+}
+
+std::optional<WsOrderbook> parseOrderbook(std::string_view json, std::string_view market)
+{
+    const auto type = findValue(json, "\"type\":");
+    if (!type || *type != "orderbook")
+        return std::nullopt;    // non-orderbook 정상 경로: silent drop
+
+    auto& logger = util::Logger::instance();
+
+    WsOrderbook ob{};
+    const bool ok =
+        parseNumber(findValue(json, "\"timestamp\":"), ob.timestamp_ms) &&
+        parseNumber(findValue(json, "\"total_ask_size\":"), ob.total_ask_size) &&
+        parseNumber(findValue(json, "\"total_bid_size\":"), ob.total_bid_size);
+
+    constexpr std::string_view units_key = "\"orderbook_units\":[";
+    const auto units_pos = json.find(units_key);
+    if (!ok || units_pos == std::string_view::npos)
+    {
+        logger.warn("[WsParser][", market, "] orderbook field parse failed");
+        return std::nullopt;
+    }
+
+    // [{...},{...}] — 원소 object는 평면(중첩 없음) → '{' ~ '}' 구간마다 키 스캔
+    std::size_t pos = units_pos + units_key.size();
+    while (ob.levels < ob.units.size())
+    {
+        while (pos < json.size() && (json[pos] == ',' || json[pos] == ' ')) ++pos;
+        if (pos >= json.size() || json[pos] != '{')
+            break;
+
+        const auto end = json.find('}', pos);
+        if (end == std::string_view::npos)
+            break;
+
+        const std::string_view unit = json.substr(pos, end - pos + 1);
+        auto& lv = ob.units[ob.levels];
+        const bool unit_ok =
+            parseNumber(findValue(unit, "\"ask_price\":"), lv.ask_price) &&
+            parseNumber(findValue(unit, "\"bid_price\":"), lv.bid_price) &&
+            parseNumber(findValue(unit, "\"ask_size\":"), lv.ask_size) &&
+            parseNumber(findValue(unit, "\"bid_size\":"), lv.bid_size);
+        if (!unit_ok)
+        {
+            logger.warn("[WsParser][", market, "] orderbook unit parse failed: index=", ob.levels);
+            return std::nullopt;
+        }
+
+        ++ob.levels;
+        pos = end + 1;
+    }
+
+    if (ob.levels == 0)
+    {
+        logger.warn("[WsParser][", market, "] orderbook has no units");
+        return std::nullopt;
+    }
+    return ob;
+}
+
 } // namespace api::upbit::ws
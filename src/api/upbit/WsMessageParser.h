@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 #include <variant>
@@ -8,6 +11,7 @@
 #include "core/domain/Candle.h"
 #include "core/domain/MyTrade.h"
 #include "core/domain/Order.h"
+#include "core/domain/Orderbook.h"
 
 namespace api::upbit::ws {
 
@@ -18,6 +22,26 @@ namespace api::upbit::ws {
         int unit_minutes;
     };
 
+    // 체결(trade) 1건 — 틱 집계/intrabar 체크에 필요한 필드만
+    struct WsTrade {
+        double price{0};
+        double volume{0};
+        std::int64_t timestamp_ms{0};   // trade_timestamp
+        std::int64_t sequential_id{0};  // 체결 고유 번호 (재연결/대기 연결 교체 중복 판정)
+        bool is_bid{false};             // 매수 체결 (ask_bid == "BID")
+    };
+
+    // 호가(orderbook) 스냅샷 1건 — 상위 levels단 (고정 배열, 힙 할당 없음)
+    inline constexpr std::size_t kWsOrderbookMaxLevels = 30;
+
+    struct WsOrderbook {
+        std::int64_t timestamp_ms{0};
+        double total_ask_size{0};
+        double total_bid_size{0};
+        std::size_t levels{0};
+        std::array<core::OrderbookLevel, kWsOrderbookMaxLevels> units{};
+    };
+
     // 파싱 실패 시 empty 반환 (내부에서 logger.error 기록)
     std::vector<WsOrderEvent> parseMyOrder(
         std::string_view json, std::string_view market = "");
@@ -27,4 +51,14 @@ namespace api::upbit::ws {
         std::string_view json, int configured_fallback_unit,
         std::string_view market = "");
 
+    // non-trade → silent nullopt / 필드 누락 → logger.warn + nullopt
+    // 체결 스트림은 초당 수천 건 → DOM 없이 필요한 키만 스캔 (할당 없음)
+    std::optional<WsTrade> parseTrade(
+        std::string_view json, std::string_view market = "");
+
+    // non-orderbook → silent nullopt / 필드 누락 → logger.warn + nullopt
+    // parseTrade와 같은 키 스캔 (orderbook_units 배열은 원소 object 단위로 순회)
+    std::optional<WsOrderbook> parseOrderbook(
+        std::string_view json, std::string_view market = "");
+
 } // namespace api::upbit::ws
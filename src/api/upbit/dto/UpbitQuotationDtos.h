@@ -39,6 +39,18 @@ namespace api::upbit::dto
 		j.at("market").get_to(d.market);
 		j.at("korean_name").get_to(d.korean_name);
 		j.at("english_name").get_to(d.english_name);
+
+		// is_details=true 응답에만 존재 (구 스펙 market_warning: "NONE"/"CAUTION"도 수용)
+		if (auto it = j.find("market_event"); it != j.end() && it->is_object()) {
+			MarketEventDto ev;
+			ev.warning = it->value("warning", false);
+			d.market_event = ev;
+		}
+		else if (auto it = j.find("market_warning"); it != j.end() && it->is_string()) {
+			MarketEventDto ev;
+			ev.warning = it->get<std::string>() != "NONE";
+			d.market_event = ev;
+		}
 	}
 	
 	/*
@@ -102,6 +114,7 @@ namespace api::upbit::dto
 		j.at("trade_volume").get_to(d.trade_volume);
 		j.at("acc_trade_volume").get_to(d.acc_trade_volume);
 		j.at("acc_trade_volume_24h").get_to(d.acc_trade_volume_24h);
+		d.acc_trade_price_24h = j.value("acc_trade_price_24h", 0.0);
 	}
 
 
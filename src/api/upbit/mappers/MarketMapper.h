@@ -12,6 +12,7 @@ namespace api::upbit::mappers
 		m.market = dto.market;
 		m.ko_name = dto.korean_name;
 		m.en_name = dto.english_name;
+		m.is_warning = dto.market_event.has_value() && dto.market_event->warning;
 		return m;
 	}
 }
@@ -26,6 +26,7 @@ namespace api::upbit::mappers
 		t.trade_volume = dto.trade_volume;
 		t.acc_trade_volume = dto.acc_trade_volume;
 		t.acc_trade_volume_24h = dto.acc_trade_volume_24h;
+		t.acc_trade_price_24h = dto.acc_trade_price_24h;
 
 		return t;
 	}
@@ -3,13 +3,21 @@
 #include <algorithm>
 #include <boost/asio/ssl/host_name_verification.hpp>
 #include <chrono>
+#include <functional>
 #include <random>
 #include <sstream>
 #include <thread>
 
+#ifndef _WIN32
+#include <sys/socket.h>
+#endif
+
 #include "UpbitWebSocketClient.h"
 #include <json.hpp>
+#include "api/net/ResolverCache.h"
+#include "api/net/TlsSessionCache.h"
 #include "util/Config.h"
+#include "util/LatencyHistogram.h"
 #include "util/Logger.h"
 
 namespace api::ws {
@@ -31,6 +39,19 @@ namespace {
             }));
     }
 
+    // 대기 연결 교체 후 중복 억제 구간 (죽은 연결이 마지막으로 전달한 메시지가 재구독 직후 다시 올 수 있는 범위)
+    constexpr auto kFailoverDedupeWindow = std::chrono::seconds(2);
+
+    // 소켓 객체 상태는 건드리지 않고 OS 소켓만 양방향 종료
+    // → 다른 스레드가 그 소켓에서 진행 중인 동기 I/O를 즉시 실패시킴 (close는 소유 스레드가 수행)
+    void shutdownNativeSocket(tcp::socket::native_handle_type fd) noexcept
+    {
+#ifdef _WIN32
+        ::shutdown(fd, SD_BOTH);
+#else
+        ::shutdown(fd, SHUT_RDWR);
+#endif
+    }
 
 } // anonymous namespace
 
@@ -38,10 +59,14 @@ namespace {
 
 UpbitWebSocketClient::UpbitWebSocketClient(
     boost::asio::io_context& ioc,
-    boost::asio::ssl::context& ssl_ctx)
+    boost::asio::ssl::context& ssl_ctx,
+    api::net::ResolverCache* dns,
+    api::net::TlsSessionCache* tls)
     : ioc_(ioc)
     , ssl_ctx_(ssl_ctx)
     , resolver_(boost::asio::make_strand(ioc))
+    , dns_(dns)
+    , tls_(tls)
 {
     // ws_는 connectImpl에서 resetStream으로 처음 생성
 }
@@ -61,10 +86,22 @@ void UpbitWebSocketClient::start()
     thread_ = std::jthread([this](std::stop_token stoken) {
         runReadLoop_(stoken);
     });
+
+    if (standby_enabled_ && !standby_thread_.joinable()) {
+        standby_thread_ = std::jthread([this](std::stop_token stoken) {
+            runStandby_(stoken);
+        });
+    }
 }
 
 void UpbitWebSocketClient::stop()
 {
+    // 대기 연결 먼저 정리: 종료 요청만 보내고 스트림은 대기 연결 스레드가 직접 닫음
+    // (진행 중인 핸드셰이크/keepalive는 그 스레드의 stop_callback이 소켓 shutdown으로 깨움)
+    standby_thread_.request_stop();
+    if (standby_thread_.joinable())
+        standby_thread_.join();
+
     thread_.request_stop();
 
     // ws_mu_로 reconnectOnce_의 ws_.reset()과 동기화하여 use-after-free 방지
@@ -147,27 +184,50 @@ void UpbitWebSocketClient::subscribeMyOrder(
     pushCommand(CmdSubMyOrder{ markets, is_only_realtime, format });
 }
 
+void UpbitWebSocketClient::subscribeTrades(
+    const std::vector<std::string>& markets,
+    bool is_only_realtime,
+    const std::string& format)
+{
+    pushCommand(CmdSubTrades{ markets, is_only_realtime, format });
+}
+
+void UpbitWebSocketClient::subscribeOrderbooks(
+    const std::vector<std::string>& markets,
+    int levels,
+    bool is_only_realtime,
+    const std::string& format)
+{
+    pushCommand(CmdSubOrderbooks{ markets, levels, is_only_realtime, format });
+}
+
 // ========== 내부 유틸 ==========
 
 void UpbitWebSocketClient::resetStream()
 {
-    ws_ = std::make_unique<WsStream>(ioc_, ssl_ctx_);
+    ws_ = makeStream_();
+}
+
+std::unique_ptr<UpbitWebSocketClient::WsStream> UpbitWebSocketClient::makeStream_()
+{
+    auto ws = std::make_unique<WsStream>(ioc_, ssl_ctx_);
 
     // ping/pong 제어 프레임을 로그로 남겨 실제 keepalive 동작 여부를 진단한다.
-    ws_->control_callback(
+    ws->control_callback(
         [](websocket::frame_type kind, beast::string_view payload)
         {
-            auto& logger = util::Logger::instance();
+            // payload는 string_view 그대로 넘긴다 (비활성 레벨에서 복사/할당 없음)
+            const std::string_view body(payload.data(), payload.size());
             switch (kind)
             {
             case websocket::frame_type::ping:
-                logger.debug("[WS] control frame: ping payload=", std::string(payload));
+                COINBOT_LOG_DEBUG("[WS] control frame: ping", util::kv("payload", body));
                 break;
             case websocket::frame_type::pong:
-                logger.debug("[WS] control frame: pong payload=", std::string(payload));
+                COINBOT_LOG_DEBUG("[WS] control frame: pong", util::kv("payload", body));
                 break;
             case websocket::frame_type::close:
-                logger.info("[WS] control frame: close payload=", std::string(payload));
+                COINBOT_LOG_INFO("[WS] control frame: close", util::kv("payload", body));
                 break;
             default:
                 break;
@@ -179,7 +239,8 @@ void UpbitWebSocketClient::resetStream()
     // idle_timeout 제거: io_context 미실행 환경에서 동작하지 않으며
     //                    expires_after()와 내부 타이머 충돌 유발
     opt.keep_alive_pings  = false; // ping은 직접 전송
-    ws_->set_option(opt);
+    ws->set_option(opt);
+    return ws;
 }
 
 bool UpbitWebSocketClient::sendTextFrame(const std::string& text)
@@ -219,6 +280,7 @@ bool UpbitWebSocketClient::reconnectOnce_(std::stop_token stoken)
     if (stoken.stop_requested()) return false;
 
     ++reconnect_failures_;
+    stats_.reconnect_attempts.fetch_add(1, std::memory_order_relaxed);
 
     const auto delay = computeReconnectDelay_();
     util::Logger::instance().info("[WS] reconnect attempt=", reconnect_failures_,
@@ -244,8 +306,10 @@ bool UpbitWebSocketClient::reconnectOnce_(std::stop_token stoken)
     connectImpl(host_, port_, target_, bearer_jwt_);
     const bool ok = (ws_ && ws_->is_open());
 
+    stats_.connected.store(ok, std::memory_order_relaxed);
     if (ok) {
         reconnect_failures_ = 0;
+        stats_.reconnect_success.fetch_add(1, std::memory_order_relaxed);
         util::Logger::instance().info("[WS] reconnect success");
     } else {
         util::Logger::instance().warn("[WS] reconnect failed (will backoff)");
@@ -255,10 +319,18 @@ bool UpbitWebSocketClient::reconnectOnce_(std::stop_token stoken)
 
 void UpbitWebSocketClient::resubscribeAll()
 {
-    for (const auto& [key, frame] : last_sub_frames_)
-        (void)sendTextFrame(frame);
+    if (sub_bodies_.empty()) return;
+    (void)sendTextFrame(buildSubscribeFrame_());
+
+    util::Logger::instance().info("[WS] resubscribe done. count=", sub_bodies_.size());
+}
 
-    util::Logger::instance().info("[WS] resubscribe done. count=", last_sub_frames_.size());
+void UpbitWebSocketClient::applySubscription_(
+    const std::string& type, std::string body, const std::string& format)
+{
+    sub_bodies_[type] = std::move(body);
+    sub_format_ = format;
+    (void)sendTextFrame(buildSubscribeFrame_());
 }
 
 void UpbitWebSocketClient::connectImpl(
@@ -275,44 +347,243 @@ void UpbitWebSocketClient::connectImpl(
 
     // 스트림 새로 생성
     resetStream();
+    (void)openStream_(*ws_, host, port, target, bearer_jwt_, "[WS]");
 
+    // 대기 연결 스레드에 엔드포인트 전달 (엔드포인트가 바뀌면 기존 대기 연결 폐기)
+    if (standby_enabled_) {
+        {
+            std::lock_guard lk(standby_mu_);
+            const bool same = standby_target_ &&
+                standby_target_->host == host && standby_target_->port == port &&
+                standby_target_->target == target && standby_target_->bearer_jwt == bearer_jwt_;
+            if (!same) {
+                ++standby_target_gen_;  // 연결/keepalive 중인 대기 연결은 끝난 뒤 대기 연결 스레드가 폐기
+                if (standby_ready_) {
+                    standby_fd_.reset();
+                    standby_.reset();
+                    standby_ready_ = false;
+                    stats_.standby_ready.store(false, std::memory_order_relaxed);
+                }
+            }
+            standby_target_ = CmdConnect{ host, port, target, bearer_jwt_ };
+        }
+        standby_cv_.notify_all();
+    }
+}
+
+bool UpbitWebSocketClient::openStream_(
+    WsStream& ws,
+    const std::string& host,
+    const std::string& port,
+    const std::string& target,
+    const std::optional<std::string>& bearer_jwt,
+    const char* tag,
+    const std::function<void(tcp::socket::native_handle_type)>& on_tcp_connected)
+{
+    auto& logger = util::Logger::instance();
     boost::system::error_code ec;
 
-    // 1. DNS 해석
-    auto results = resolver_.resolve(host, port, ec);
-    util::Logger::instance().info("[WS] resolve: ", (ec ? ec.message() : "OK"));
-    if (ec) return;
+    // 1. DNS 해석 (공유 캐시가 있으면 재연결 시 DNS 왕복 생략)
+    auto results = dns_ ? dns_->resolve(host, port, ec) : resolver_.resolve(host, port, ec);
+    logger.info(tag, " resolve: ", (ec ? ec.message() : "OK"));
+    if (ec) return false;
 
     // 2. TCP 연결 (TLS 핸드셰이크 전에 SNI 설정 필요)
-    beast::get_lowest_layer(*ws_).connect(results, ec);
-    util::Logger::instance().info("[WS] tcp connect: ", (ec ? ec.message() : "OK"));
-    if (ec) return;
+    beast::get_lowest_layer(ws).connect(results, ec);
+    logger.info(tag, " tcp connect: ", (ec ? ec.message() : "OK"));
+    if (ec) {
+        if (dns_) dns_->invalidate(host, port);     // 캐시된 주소 폐기 → 다음 재연결에서 새로 해석
+        return false;
+    }
+    if (on_tcp_connected)
+        on_tcp_connected(beast::get_lowest_layer(ws).socket().native_handle());
 
     // 3. SNI 설정 : TLS 핸드셰이크 전에 서버에 호스트명 전달 (인증서 선택, 위조 방지)
-    if (!SSL_set_tlsext_host_name(ws_->next_layer().native_handle(), host.c_str())) {
-        util::Logger::instance().error("[WS] SNI: FAIL");
-        return;
+    if (!SSL_set_tlsext_host_name(ws.next_layer().native_handle(), host.c_str())) {
+        logger.error(tag, " SNI: FAIL");
+        return false;
     }
-    util::Logger::instance().info("[WS] SNI: OK");
+    logger.info(tag, " SNI: OK");
 
     // 4. TLS 인증서의 호스트명이 실제 접속 대상과 일치하는지 검증한다.
-    ws_->next_layer().set_verify_callback(boost::asio::ssl::host_name_verification(host));
-
-    // 5. TLS 핸드셰이크
-    ws_->next_layer().handshake(boost::asio::ssl::stream_base::client, ec);
-    util::Logger::instance().info("[WS] tls handshake: ", (ec ? ec.message() : "OK"));
-    if (ec) return;
+    ws.next_layer().set_verify_callback(boost::asio::ssl::host_name_verification(host));
+
+    // 5. TLS 핸드셰이크 (이전 세션이 있으면 약식 핸드셰이크)
+    const bool offered = tls_ && tls_->apply(ws.next_layer().native_handle(), host);
+    const auto handshake_start = util::monoNowNs();
+    ws.next_layer().handshake(boost::asio::ssl::stream_base::client, ec);
+    const auto handshake_ns = util::monoNowNs() - handshake_start;
+    logger.info(tag, " tls handshake: ", (ec ? ec.message() : "OK"),
+        " resumed=", (!ec && SSL_session_reused(ws.next_layer().native_handle()) == 1),
+        " offered=", offered, " us=", handshake_ns / 1000);
+    if (ec) return false;
+    if (tls_) tls_->recordHandshake(ws.next_layer().native_handle(), handshake_ns);
 
     // 6. private 연결 시 헤더 생성 및 삽입
-    applyAuthorizationDecorator(*ws_, bearer_jwt_);
+    applyAuthorizationDecorator(ws, bearer_jwt);
 
     // 7. WebSocket 핸드셰이크 (HTTP Upgrade)
-    ws_->handshake(host, target, ec);
-    util::Logger::instance().info("[WS] ws handshake: ", (ec ? ec.message() : "OK"));
-    if (ec) return;
+    ws.handshake(host, target, ec);
+    logger.info(tag, " ws handshake: ", (ec ? ec.message() : "OK"));
+    if (ec) return false;
+
+    logger.info(tag, " Connected", (bearer_jwt.has_value() ? " (private)" : " (public)"));
+    return true;
+}
+
+// ========== 대기 연결 ==========
+
+void UpbitWebSocketClient::runStandby_(std::stop_token stoken)
+{
+    auto& logger = util::Logger::instance();
+
+    // 주 연결과 같은 주기로 keepalive (private는 텍스트 하트비트 주기가 더 짧을 수 있음)
+    const auto keepalive = (heartbeat_mode_ == HeartbeatMode::UpbitTextPing)
+        ? std::min(ping_interval_, heartbeat_interval_)
+        : ping_interval_;
+
+    // 종료 요청 시 이 스레드가 보유한 소켓에 shutdown만 걸어 진행 중인 핸드셰이크/keepalive를 깨움
+    // (stop_callback은 요청 스레드에서 실행 → 스트림 객체는 건드리지 않음)
+    std::stop_callback wake_on_stop(stoken, [this] {
+        std::lock_guard lk(standby_mu_);
+        if (standby_fd_) shutdownNativeSocket(*standby_fd_);
+    });
+
+    // TCP 연결 직후 소켓 공개 (이미 종료 요청이 왔으면 바로 shutdown → 핸드셰이크 즉시 실패)
+    const auto publish_fd = [&](tcp::socket::native_handle_type fd) {
+        std::lock_guard lk(standby_mu_);
+        standby_fd_ = fd;
+        if (stoken.stop_requested()) shutdownNativeSocket(fd);
+    };
+
+    std::uint32_t failures = 0;
+    while (!stoken.stop_requested())
+    {
+        std::unique_ptr<WsStream> stream;   // 락 밖 I/O 동안 이 스레드가 독점
+        CmdConnect endpoint;
+        std::uint64_t gen = 0;
+        bool keepalive_only = false;
+        {
+            std::unique_lock lk(standby_mu_);
+            const bool need_connect = standby_cv_.wait_for(lk, stoken, keepalive,
+                [&] { return standby_target_.has_value() && !standby_ready_; });
+            if (stoken.stop_requested()) break;
+
+            if (!need_connect) {
+                if (!standby_ready_) continue;
+                // keepalive 동안은 꺼내 둠 → 그 사이 승격 시도는 기다리지 않고 일반 재연결로 진행
+                stream = std::move(standby_);
+                standby_ready_ = false;
+                keepalive_only = true;
+            }
+            else {
+                endpoint = *standby_target_;
+                stream = makeStream_();
+            }
+            gen = standby_target_gen_;
+        }
+
+        // 핸드셰이크/keepalive I/O는 락 밖에서 (수신 스레드의 승격 시도를 막지 않도록)
+        const bool ok = keepalive_only
+            ? keepAliveStandby_(*stream)
+            : openStream_(*stream, endpoint.host, endpoint.port, endpoint.target,
+                          endpoint.bearer_jwt, "[WS][standby]", publish_fd);
+        bool ready = false;
+        {
+            std::lock_guard lk(standby_mu_);
+            // 그 사이 엔드포인트가 바뀌었거나 종료 요청이 왔으면 폐기
+            if (ok && gen == standby_target_gen_ && !stoken.stop_requested()) {
+                standby_ = std::move(stream);
+                standby_ready_ = true;
+                ready = true;
+            }
+            else {
+                standby_fd_.reset();
+            }
+        }
+        stream.reset();     // 폐기 대상은 이 스레드가 닫음 (standby_fd_ 해제 후라 stop_callback과 겹치지 않음)
+        stats_.standby_ready.store(ready, std::memory_order_relaxed);
+
+        if (keepalive_only) continue;   // 실패 시 다음 반복에서 바로 새 대기 연결
+        if (ok) {
+            failures = 0;
+            if (ready) stats_.standby_connects.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // 실패 시 주 연결과 같은 backoff 범위로 재시도 (jitter 생략)
+        const std::uint32_t exp = std::min<std::uint32_t>(failures++, 10);
+        const auto delay = std::min<std::chrono::milliseconds>(
+            reconnect_min_backoff_ * (1LL << exp), reconnect_max_backoff_);
+        logger.warn("[WS][standby] connect failed, retry in ", delay.count(), "ms");
+
+        std::unique_lock lk(standby_mu_);
+        standby_cv_.wait_for(lk, stoken, delay, [] { return false; });
+    }
+
+    // 종료: 남은 대기 연결도 이 스레드가 닫음
+    std::unique_ptr<WsStream> leftover;
+    {
+        std::lock_guard lk(standby_mu_);
+        standby_fd_.reset();
+        leftover = std::move(standby_);
+        standby_ready_ = false;
+    }
+    stats_.standby_ready.store(false, std::memory_order_relaxed);
+}
+
+bool UpbitWebSocketClient::keepAliveStandby_(WsStream& stream)
+{
+    // 대기 연결은 읽지 않으므로 pong/{"status":"UP"} 응답은 소켓에 쌓였다가 승격 후 첫 read에서 소비됨
+    boost::system::error_code ec;
+    stream.ping({}, ec);
+    if (!ec && heartbeat_mode_ == HeartbeatMode::UpbitTextPing) {
+        stream.text(true);
+        stream.write(boost::asio::buffer(std::string_view("PING")), ec);
+    }
+
+    if (ec) {
+        util::Logger::instance().warn("[WS][standby] keepalive failed: ", ec.message());
+        return false;
+    }
+    COINBOT_LOG_DEBUG("[WS][standby] keepalive sent");
+    return true;
+}
+
+bool UpbitWebSocketClient::promoteStandby_()
+{
+    std::unique_ptr<WsStream> promoted;
+    {
+        std::lock_guard lk(standby_mu_);
+        if (!standby_ready_) return false;
+        promoted = std::move(standby_);
+        standby_ready_ = false;
+        standby_fd_.reset();    // 이제 수신 스레드 소유 → 대기 연결 종료 깨우기 대상 아님
+    }
+    stats_.standby_ready.store(false, std::memory_order_relaxed);
+    standby_cv_.notify_all();   // 다음 대기 연결 즉시 준비
+
+    if (!promoted || !promoted->is_open()) return false;
 
-    util::Logger::instance().info("[WS] Connected",
-                                  (bearer_jwt_.has_value() ? " (private)" : " (public)"));
+    {
+        std::lock_guard lk(ws_mu_);
+        // 죽은 주 연결은 close 핸드셰이크 없이 폐기 (ws_mu_ 보유 중 블로킹 금지)
+        ws_ = std::move(promoted);
+    }
+    return true;
+}
+
+bool UpbitWebSocketClient::isFailoverDuplicate_(std::string_view msg)
+{
+    const std::size_t fp = std::hash<std::string_view>{}(msg);
+
+    if (std::chrono::steady_clock::now() < dedupe_until_ &&
+        std::find(recent_fp_.begin(), recent_fp_.end(), fp) != recent_fp_.end())
+        return true;
+
+    recent_fp_[recent_fp_pos_] = fp;
+    recent_fp_pos_ = (recent_fp_pos_ + 1) % kRecentFingerprints;
+    return false;
 }
 
 // ========== 수신 루프 (jthread 진입점) ==========
@@ -332,6 +603,24 @@ void UpbitWebSocketClient::runReadLoop_(std::stop_token stoken)
 
     // reconnect 시도 + max 초과 여부 갱신 (3곳 공통 처리)
     auto doReconnect = [&]() {
+        // 대기 연결이 준비돼 있으면 backoff/핸드셰이크 없이 교체 → 재구독만 수행
+        const std::int64_t failover_start = util::monoNowNs();
+        if (standby_enabled_ && promoteStandby_()) {
+            resubscribeAll();
+            const auto failover_us =
+                static_cast<std::uint64_t>((util::monoNowNs() - failover_start) / 1000);
+
+            reconnect_failures_ = 0;
+            dedupe_until_ = std::chrono::steady_clock::now() + kFailoverDedupeWindow;
+            stats_.connected.store(true, std::memory_order_relaxed);
+            stats_.standby_promotions.fetch_add(1, std::memory_order_relaxed);
+            stats_.last_failover_us.store(failover_us, std::memory_order_relaxed);
+            util::Logger::instance().info("[WS] failover to standby done. us=", failover_us);
+
+            if (on_reconnect_) on_reconnect_();
+            return;
+        }
+
         const bool ok = reconnectOnce_(stoken);
         if (ok) {
             resubscribeAll();
@@ -362,29 +651,36 @@ void UpbitWebSocketClient::runReadLoop_(std::stop_token stoken)
             for (auto& c : local) {
                 if (auto* cc = std::get_if<CmdConnect>(&c)) {
                     connectImpl(cc->host, cc->port, cc->target, cc->bearer_jwt);
+                    stats_.connected.store(ws_ && ws_->is_open(), std::memory_order_relaxed);
                     if (ws_ && ws_->is_open())
                         resubscribeAll();
                     continue;
                 }
                 if (auto* sc = std::get_if<CmdSubCandles>(&c)) {
-                    const std::string ticket = makeTicket();
-                    const std::string frame  = buildCandleSubJsonFrame(
-                        ticket, sc->type, sc->markets,
-                        sc->is_only_snapshot, sc->is_only_realtime, sc->format);
-                    last_sub_frames_[sc->type] = frame;
-                    (void)sendTextFrame(frame);
+                    applySubscription_(sc->type, buildCandleSubBody(
+                        sc->type, sc->markets, sc->is_only_snapshot, sc->is_only_realtime), sc->format);
                     util::Logger::instance().info("[WS] Candle subscribe sent: ", sc->type);
                     continue;
                 }
                 if (auto* sm = std::get_if<CmdSubMyOrder>(&c)) {
-                    const std::string ticket = makeTicket();
-                    const std::string frame  = buildMyOrderSubJsonFrame(
-                        ticket, sm->markets, sm->is_only_realtime, sm->format);
-                    last_sub_frames_["myOrder"] = frame;
-                    (void)sendTextFrame(frame);
+                    applySubscription_("myOrder",
+                        buildMyOrderSubBody(sm->markets, sm->is_only_realtime), sm->format);
                     util::Logger::instance().info("[WS] MyOrder subscribe sent");
                     continue;
                 }
+                if (auto* st = std::get_if<CmdSubTrades>(&c)) {
+                    applySubscription_("trade",
+                        buildTradeSubBody(st->markets, st->is_only_realtime), st->format);
+                    util::Logger::instance().info("[WS] Trade subscribe sent: markets=", st->markets.size());
+                    continue;
+                }
+                if (auto* so = std::get_if<CmdSubOrderbooks>(&c)) {
+                    applySubscription_("orderbook",
+                        buildOrderbookSubBody(so->markets, so->levels, so->is_only_realtime), so->format);
+                    util::Logger::instance().info("[WS] Orderbook subscribe sent: markets=", so->markets.size(),
+                        " levels=", so->levels);
+                    continue;
+                }
             }
         }
 
@@ -400,7 +696,7 @@ void UpbitWebSocketClient::runReadLoop_(std::stop_token stoken)
                 boost::system::error_code ec;
                 ws_->ping({}, ec);
                 if (!ec)
-                    util::Logger::instance().debug("[WS] ping sent");
+                    COINBOT_LOG_DEBUG("[WS] ping sent");
                 else {
                     util::Logger::instance().error("[WS] ping error: ", ec.message());
                     if (!stoken.stop_requested())
@@ -413,7 +709,7 @@ void UpbitWebSocketClient::runReadLoop_(std::stop_token stoken)
                     util::Logger::instance().warn("[WS] text heartbeat send failed, reconnecting");
                     doReconnect();
                 } else {
-                    util::Logger::instance().debug("[WS] text heartbeat sent: PING");
+                    COINBOT_LOG_DEBUG("[WS] text heartbeat sent: PING");
                 }
             }
         }
@@ -454,10 +750,14 @@ void UpbitWebSocketClient::runReadLoop_(std::stop_token stoken)
                 continue;
 
             util::Logger::instance().error("[WS] read error: ", ec.message());
+            stats_.connected.store(false, std::memory_order_relaxed);
             doReconnect();
             continue;
         }
 
+        // 프레임 수신 시각 (지연 측정 기준점 - 문자열 변환/필터 전)
+        const std::int64_t recv_ns = util::monoNowNs();
+
         // 수신 메시지 처리
         const std::string msg = beast::buffers_to_string(buffer.data());
 
@@ -468,8 +768,8 @@ void UpbitWebSocketClient::runReadLoop_(std::stop_token stoken)
 
         if (!is_candle) {
             constexpr std::size_t kMaxLog = 200;
-            if (msg.size() <= kMaxLog) util::Logger::instance().debug("[WS] RX: ", msg);
-            else                       util::Logger::instance().debug("[WS] RX: ", msg.substr(0, kMaxLog), "...");
+            COINBOT_LOG_DEBUG("[WS] RX", util::kv("bytes", msg.size()),
+                util::kv("head", std::string_view(msg).substr(0, kMaxLog)));
         }
 
         // Upbit 텍스트 하트비트 응답 {"status":"UP"} 필터 — 도메인 메시지 아님
@@ -479,14 +779,21 @@ void UpbitWebSocketClient::runReadLoop_(std::stop_token stoken)
                 const auto j = nlohmann::json::parse(msg);
                 if (j.is_object() &&
                     j.value("status", "") == "UP") {
-                    util::Logger::instance().debug("[WS] heartbeat ack: status=UP");
+                    COINBOT_LOG_DEBUG("[WS] heartbeat ack", util::kv("status", "UP"));
                     continue;
                 }
             } catch (...) { /* 파싱 실패 시 일반 메시지로 처리 */ }
         }
 
+        // 대기 연결 교체 직후: 죽은 연결에서 이미 전달한 payload 재수신 억제
+        if (standby_enabled_ && isFailoverDuplicate_(msg)) {
+            stats_.duplicates_suppressed.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        stats_.messages_rx.fetch_add(1, std::memory_order_relaxed);
         if (on_msg_)
-            on_msg_(std::string_view(msg));
+            on_msg_(std::string_view(msg), recv_ns);
     }
 
     // stop 요청 시: 소켓이 이미 닫혔으므로 WS close 핸드셰이크 생략
@@ -508,47 +815,73 @@ std::string UpbitWebSocketClient::makeTicket()
     return oss.str();
 }
 
-std::string UpbitWebSocketClient::buildCandleSubJsonFrame(
-    const std::string& ticket,
+std::string UpbitWebSocketClient::buildSubscribeFrame_() const
+{
+    // 구독 본문은 이미 직렬화된 object → 배열 원소로 이어 붙임
+    std::string frame = "[";
+    frame += nlohmann::json{ {"ticket", makeTicket()} }.dump();
+    for (const auto& [type, body] : sub_bodies_) {
+        frame += ',';
+        frame += body;
+    }
+    frame += ',';
+    frame += nlohmann::json{ {"format", sub_format_} }.dump();
+    frame += ']';
+    return frame;
+}
+
+std::string UpbitWebSocketClient::buildCandleSubBody(
     const std::string& type,
     const std::vector<std::string>& markets,
     bool is_only_snapshot,
-    bool is_only_realtime,
-    const std::string& format)
+    bool is_only_realtime)
 {
-    // 구독 본문
-    nlohmann::json root = nlohmann::json::array();
-    root.push_back({ {"ticket", ticket} });
-
-    // 구독 내용
     nlohmann::json body;
     body["type"]              = type;
     body["codes"]             = markets;
     body["is_only_snapshot"]  = is_only_snapshot;
     body["is_only_realtime"]  = is_only_realtime;
-    root.push_back(body);
-
-    root.push_back({ {"format", format} });
-    return root.dump();
+    return body.dump();
 }
 
-std::string UpbitWebSocketClient::buildMyOrderSubJsonFrame(
-    const std::string& ticket,
+std::string UpbitWebSocketClient::buildMyOrderSubBody(
     const std::vector<std::string>& markets,
-    bool is_only_realtime,
-    const std::string& format)
+    bool is_only_realtime)
 {
-    nlohmann::json root = nlohmann::json::array();
-    root.push_back({ {"ticket", ticket} });
-
     nlohmann::json body;
     body["type"]             = "myOrder";
     body["codes"]            = markets;
     body["is_only_realtime"] = is_only_realtime;
-    root.push_back(body);
+    return body.dump();
+}
 
-    root.push_back({ {"format", format} });
-    return root.dump();
+std::string UpbitWebSocketClient::buildTradeSubBody(
+    const std::vector<std::string>& markets,
+    bool is_only_realtime)
+{
+    nlohmann::json body;
+    body["type"]             = "trade";
+    body["codes"]            = markets;
+    body["is_only_realtime"] = is_only_realtime;
+    return body.dump();
+}
+
+std::string UpbitWebSocketClient::buildOrderbookSubBody(
+    const std::vector<std::string>& markets,
+    int levels,
+    bool is_only_realtime)
+{
+    // 단 수 지정: "KRW-BTC.15" (응답의 code에는 접미사 없음 → 라우팅 영향 없음)
+    std::vector<std::string> codes;
+    codes.reserve(markets.size());
+    for (const auto& m : markets)
+        codes.push_back(levels > 0 ? m + "." + std::to_string(levels) : m);
+
+    nlohmann::json body;
+    body["type"]             = "orderbook";
+    body["codes"]            = codes;
+    body["is_only_realtime"] = is_only_realtime;
+    return body.dump();
 }
 
 } // namespace api::ws
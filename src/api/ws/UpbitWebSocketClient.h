@@ -1,9 +1,15 @@
 ﻿// api/ws/UpbitWebSocketClient.h
 //
 // 업비트 WebSocket 클라이언트
-// - TLS 연결, 캔들/myOrder 구독, raw JSON EventRouter로 수신
+// - TLS 연결, 캔들/체결/호가/myOrder 구독, raw JSON EventRouter로 수신
+// - Upbit는 새 구독 요청이 연결의 기존 구독을 대체 → 타입별 구독 본문을 모아 항상 한 프레임으로 전송
 // - 전략/도메인 파싱은 담당하지 않음
 //
+// 대기 연결(warm standby, 선택):
+// - 별도 스레드가 같은 엔드포인트로 TLS + WS 핸드셰이크까지 끝낸 연결을 하나 더 유지 (구독 X, keepalive만)
+// - 주 연결 read/ping 실패 시 backoff·resolve·TCP·TLS·WS 핸드셰이크 없이 대기 연결로 교체 후 즉시 재구독
+// - 교체 직후 짧은 구간은 직전에 전달한 메시지와 동일한 payload를 걸러 중복 전달 방지
+//
 // 생명주기: setMessageHandler → connectPublic/Private → subscribeXxx → start() → stop()
 #pragma once
 
@@ -13,8 +19,13 @@
 #include <boost/beast/ssl.hpp>
 #include <boost/beast/websocket.hpp>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <functional>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -25,6 +36,8 @@
 #include <vector>
 #include <cstdint>
 
+namespace api::net { class ResolverCache; class TlsSessionCache; }
+
 namespace api::ws
 {
     using tcp = boost::asio::ip::tcp;
@@ -37,12 +50,15 @@ namespace api::ws
     public:
         // TCP 위에 TLS를 올리고, 그 위에 WebSocket을 올린 최종 통신 객체
         using WsStream          = websocket::stream<beast::ssl_stream<beast::tcp_stream>>;
-        using MessageHandler    = std::function<void(std::string_view)>; // raw JSON
+        using MessageHandler    = std::function<void(std::string_view, std::int64_t)>; // raw JSON, 수신 시각(util::monoNowNs)
         using ReconnectCallback = std::function<void()>;  // 재연결 성공 후 호출
         using FatalCallback     = std::function<void()>;  // 재연결 한도 초과 시 호출
 
+        // dns/tls: REST와 공유하는 캐시 (외부 소유, nullptr이면 매번 resolve + full handshake)
         UpbitWebSocketClient(boost::asio::io_context& ioc,
-                             boost::asio::ssl::context& ssl_ctx);
+                             boost::asio::ssl::context& ssl_ctx,
+                             api::net::ResolverCache* dns = nullptr,
+                             api::net::TlsSessionCache* tls = nullptr);
         ~UpbitWebSocketClient();
 
         // 복사/이동 금지 (io_context 참조 보유)
@@ -71,6 +87,18 @@ namespace api::ws
                               bool is_only_realtime = false,
                               const std::string& format = "DEFAULT");
 
+        // 체결(trade) 구독 — 틱 단위 체결가 (캔들보다 촘촘한 intrabar 가격)
+        void subscribeTrades(const std::vector<std::string>& markets,
+                             bool is_only_realtime = true,
+                             const std::string& format = "DEFAULT");
+
+        // 호가(orderbook) 구독 — levels > 0이면 코드 뒤 ".{levels}"로 단 수 지정 (1/5/15/30), 0이면 서버 기본
+        // 메시지마다 상위 단 전체 스냅샷 → 첫 스냅샷도 받도록 기본 is_only_realtime=false
+        void subscribeOrderbooks(const std::vector<std::string>& markets,
+                                 int levels = 15,
+                                 bool is_only_realtime = false,
+                                 const std::string& format = "DEFAULT");
+
         // 내 주문 체결 구독
         void subscribeMyOrder(const std::vector<std::string>& markets,
                               bool is_only_realtime = true,
@@ -84,6 +112,11 @@ namespace api::ws
         void setHeartbeatMode(HeartbeatMode mode) { heartbeat_mode_ = mode; }
         void setHeartbeatInterval(std::chrono::seconds s) { heartbeat_interval_ = s; }
 
+        // ---- 대기 연결 ----
+
+        // start() 전에만 호출할 것 (대기 연결 스레드는 start()에서 가동)
+        void setWarmStandby(bool enabled) { standby_enabled_ = enabled; }
+
         // ---- 수신 콜백 ----
 
         // start() 전에 설정 권장
@@ -104,6 +137,22 @@ namespace api::ws
         // 수신 루프 종료 + join (소멸자에서도 자동 호출)
         void stop();
 
+        // ---- 통계 (근사 카운팅, memory_order_relaxed - 메트릭 수집용) ----
+        struct Stats {
+            std::atomic<std::uint64_t> messages_rx{0};          // 도메인 메시지 수신 수 (하트비트 제외)
+            std::atomic<std::uint64_t> reconnect_attempts{0};   // 재연결 시도 수
+            std::atomic<std::uint64_t> reconnect_success{0};    // 재연결 성공 수
+            std::atomic<bool>          connected{false};        // 현재 연결 여부
+
+            std::atomic<bool>          standby_ready{false};        // 승격 가능한 대기 연결 보유 여부
+            std::atomic<std::uint64_t> standby_connects{0};         // 대기 연결 수립 수
+            std::atomic<std::uint64_t> standby_promotions{0};       // 대기 연결로 즉시 교체한 수
+            std::atomic<std::uint64_t> duplicates_suppressed{0};    // 교체 직후 중복으로 걸러낸 메시지 수
+            std::atomic<std::uint64_t> last_failover_us{0};         // 마지막 교체 소요 (장애 감지 → 재구독 완료)
+        };
+
+        const Stats& stats() const noexcept { return stats_; }
+
     private:
         // ---- 커맨드 큐 타입 ----
         struct CmdConnect {
@@ -122,13 +171,25 @@ namespace api::ws
             bool is_only_realtime{};
             std::string format;
         };
+        struct CmdSubTrades {
+            std::vector<std::string> markets;
+            bool is_only_realtime{};
+            std::string format;
+        };
+        struct CmdSubOrderbooks {
+            std::vector<std::string> markets;
+            int levels{};
+            bool is_only_realtime{};
+            std::string format;
+        };
 
-        using Command = std::variant<CmdConnect, CmdSubCandles, CmdSubMyOrder>;
+        using Command = std::variant<CmdConnect, CmdSubCandles, CmdSubMyOrder, CmdSubTrades, CmdSubOrderbooks>;
 
         void pushCommand(Command c);
 
         // ws_ 생성/정리
         void resetStream();
+        std::unique_ptr<WsStream> makeStream_();
 
         // WS 스레드 전용 텍스트 프레임 송신
         bool sendTextFrame(const std::string& text);
@@ -140,29 +201,60 @@ namespace api::ws
         // 다음 재연결 sleep 시간 계산 (지수 backoff + jitter)
         std::chrono::milliseconds computeReconnectDelay_();
 
-        // 내부 공통 연결 루틴: resolve → tcp → tls → ws handshake
+        // 주 연결 루틴: 연결 정보 저장 후 ws_를 새로 만들어 openStream_
         void connectImpl(const std::string& host,
                          const std::string& port,
                          const std::string& target,
                          std::optional<std::string> bearer_jwt);
 
+        // 공통 연결 루틴: resolve → tcp → tls → ws handshake (tag는 로그 접두어)
+        // - on_tcp_connected: TCP 연결 직후 OS 소켓 핸들 전달 (대기 연결의 종료 깨우기용)
+        bool openStream_(WsStream& ws,
+                         const std::string& host,
+                         const std::string& port,
+                         const std::string& target,
+                         const std::optional<std::string>& bearer_jwt,
+                         const char* tag,
+                         const std::function<void(tcp::socket::native_handle_type)>& on_tcp_connected = {});
+
+        // ---- 대기 연결 ----
+
+        // 대기 연결 유지 루프 (standby_thread_)
+        void runStandby_(std::stop_token stoken);
+
+        // 대기 연결 스레드가 스트림을 꺼내 독점한 상태에서 락 없이 호출: 컨트롤 ping (+ 텍스트 PING), 실패 시 false
+        bool keepAliveStandby_(WsStream& stream);
+
+        // 수신 스레드에서 호출: 준비된 대기 연결을 ws_로 교체 (없으면 false)
+        bool promoteStandby_();
+
+        // 교체 직후 중복 메시지 판정 + 최근 전달 메시지 지문 기록 (수신 스레드 전용)
+        bool isFailoverDuplicate_(std::string_view msg);
+
         // 수신 루프 (jthread에서 실행, stop_token으로 종료 감지)
         void runReadLoop_(std::stop_token stoken);
 
-        // 구독 요청 JSON 프레임 생성
+        // 타입별 구독 본문 갱신 후 전체 구독 프레임 전송 (WS 스레드 전용)
+        void applySubscription_(const std::string& type, std::string body, const std::string& format);
+
+        // 구독 요청 JSON 프레임 생성: [ {ticket}, 본문..., {format} ]
         static std::string makeTicket();
-        static std::string buildCandleSubJsonFrame(
-            const std::string& ticket,
+        std::string buildSubscribeFrame_() const;
+        static std::string buildCandleSubBody(
             const std::string& type,
             const std::vector<std::string>& markets,
             bool is_only_snapshot,
-            bool is_only_realtime,
-            const std::string& format);
-        static std::string buildMyOrderSubJsonFrame(
-            const std::string& ticket,
+            bool is_only_realtime);
+        static std::string buildMyOrderSubBody(
+            const std::vector<std::string>& markets,
+            bool is_only_realtime);
+        static std::string buildTradeSubBody(
             const std::vector<std::string>& markets,
-            bool is_only_realtime,
-            const std::string& format);
+            bool is_only_realtime);
+        static std::string buildOrderbookSubBody(
+            const std::vector<std::string>& markets,
+            int levels,
+            bool is_only_realtime);
 
         // ---- 멤버 변수 ----
 
@@ -170,6 +262,8 @@ namespace api::ws
         boost::asio::ssl::context& ssl_ctx_;
 
         tcp::resolver resolver_;
+        api::net::ResolverCache* dns_;
+        api::net::TlsSessionCache* tls_;
 
         // WebSocket stream (재연결 시 새로 생성하므로 포인터 보관)
         std::unique_ptr<WsStream> ws_;
@@ -180,6 +274,26 @@ namespace api::ws
         // 내부 수신 스레드 (stop_token 내장)
         std::jthread thread_;
 
+        // ---- 대기 연결 상태 ----
+        // standby_는 standby_ready_ == false 동안 대기 연결 스레드만, true가 된 뒤에는 수신 스레드만 가져감
+        // 연결/keepalive I/O는 대기 연결 스레드가 락 밖에서 수행하고, 스트림 정리도 그 스레드가 직접 함
+        bool standby_enabled_{ false };
+        std::mutex standby_mu_;
+        std::condition_variable_any standby_cv_;
+        std::unique_ptr<WsStream> standby_;
+        bool standby_ready_{ false };
+        std::optional<CmdConnect> standby_target_;     // connectImpl이 기록한 최신 엔드포인트
+        std::uint64_t standby_target_gen_{ 0 };        // 엔드포인트 변경 시 증가 → 이전 엔드포인트 연결 폐기 판정
+        // 대기 연결 스레드가 보유한 스트림의 OS 소켓 (종료 요청 시 shutdown만 걸어 블로킹 I/O를 깨움)
+        std::optional<tcp::socket::native_handle_type> standby_fd_;
+        std::jthread standby_thread_;
+
+        // 교체 직후 중복 억제: 최근 전달 메시지 지문 링 + 억제 구간 종료 시각
+        static constexpr std::size_t kRecentFingerprints = 256;
+        std::array<std::size_t, kRecentFingerprints> recent_fp_{};
+        std::size_t recent_fp_pos_{ 0 };
+        std::chrono::steady_clock::time_point dedupe_until_{};
+
         // ping 주기 / 재연결 backoff / 텍스트 하트비트
         std::chrono::seconds      ping_interval_{ 25 };
         HeartbeatMode             heartbeat_mode_{ HeartbeatMode::None };
@@ -196,8 +310,9 @@ namespace api::ws
         std::string target_;
         std::optional<std::string> bearer_jwt_;
 
-        // 재연결 후 재구독을 위해 마지막 subscribe frame 보관
-        std::unordered_map<std::string, std::string> last_sub_frames_;
+        // 재연결 후 재구독을 위해 타입별 마지막 구독 본문(JSON object) 보관 (WS 스레드 전용)
+        std::map<std::string, std::string> sub_bodies_;
+        std::string sub_format_{ "DEFAULT" };
 
         // 커맨드 큐
         std::mutex cmd_mu_;
@@ -211,6 +326,8 @@ namespace api::ws
 
         // 재연결 한도 초과 콜백
         FatalCallback fatal_cb_{};
+
+        Stats stats_;
     };
 
 } // namespace api::ws
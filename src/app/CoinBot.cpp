@@ -9,12 +9,15 @@
 //   4) MarketEngineManager 구성 (계좌 동기화 + 마켓별 복구)
 //   5) EventRouter 구성
 //   6) WebSocket 클라이언트 구성 (public: 캔들, private: myOrder)
-//   7) start() → SIGINT 대기 → stop()
+//   7) start() → SIGINT 대기(+ 마켓 구성 파일 감시 또는 유니버스 스캐너 반영) → stop()
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <csignal>
 #include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <optional>
 #include <sstream>
@@ -26,14 +29,21 @@
 #include <boost/asio/ssl/context.hpp>
 
 #include "api/auth/UpbitJwtSigner.h"
+#include "api/net/ResolverCache.h"
+#include "api/net/TlsSessionCache.h"
 #include "api/rest/RestClient.h"
 #include "api/upbit/UpbitExchangeRestClient.h"
+#include "api/upbit/UpbitPublicRestClient.h"
 #include "api/upbit/SharedOrderApi.h"
 #include "api/ws/UpbitWebSocketClient.h"
 #include "app/EventRouter.h"
 #include "app/MarketEngineManager.h"
+#include "app/MarketScanner.h"
+#include "app/MetricsExporter.h"
+#include "app/MetricsServer.h"
 #include "database/Database.h"
 #include "engine/OrderStore.h"
+#include "statebus/StateBusWriter.h"
 #include "trading/allocation/AccountManager.h"
 #include "util/Config.h"
 #include "util/Logger.h"
@@ -127,6 +137,111 @@ static std::vector<std::string> loadMarkets()
     return result.empty() ? util::AppConfig::instance().bot.markets : result;
 }
 
+// ---- 런타임 마켓 구성 파일 ----
+// 환경 변수 UPBIT_MARKETS_FILE 우선, 없으면 AppConfig 값 (비어 있으면 감시 비활성)
+static std::string loadMarketsFilePath()
+{
+    auto env = readEnv("UPBIT_MARKETS_FILE");
+    return env.has_value() ? *env : util::AppConfig::instance().bot.markets_file;
+}
+
+// ---- 체결 스트림 ----
+// 환경 변수 UPBIT_TRADE_STREAM (1/true 활성, 0/false 비활성) 우선, 없으면 AppConfig 값
+static bool loadTradeStream()
+{
+    auto env = readEnv("UPBIT_TRADE_STREAM");
+    if (!env.has_value())
+        return util::AppConfig::instance().bot.trade_stream;
+    return *env == "1" || *env == "true";
+}
+
+// ---- 호가 스트림 ----
+// 환경 변수 UPBIT_ORDERBOOK_LEVELS 우선, 없으면 AppConfig 값 (Upbit 지원 단 수로 올림, 0이면 비활성)
+static int loadOrderbookLevels()
+{
+    int levels = util::AppConfig::instance().bot.orderbook_levels;
+    if (auto env = readEnv("UPBIT_ORDERBOOK_LEVELS")) {
+        try {
+            levels = std::stoi(*env);
+        }
+        catch (const std::exception&) {
+            util::Logger::instance().warn("[CoinBot] Invalid UPBIT_ORDERBOOK_LEVELS ignored: ", *env);
+        }
+    }
+    if (levels <= 0) return 0;
+    for (const int supported : { 1, 5, 15 })
+        if (levels <= supported) return supported;
+    return 30;
+}
+
+// ---- 유니버스 스캐너 설정 ----
+// 환경 변수 UPBIT_SCANNER_TOP_N(>0)이 있으면 활성화 + 선택 마켓 수 재정의
+// 선택 수는 AccountManager 슬롯 상한(max_markets)을 넘지 않도록 제한
+static util::ScannerConfig loadScannerConfig()
+{
+    util::ScannerConfig cfg = util::AppConfig::instance().scanner;
+    if (auto env = readEnv("UPBIT_SCANNER_TOP_N")) {
+        try {
+            const long n = std::stol(*env);
+            cfg.enabled = n > 0;
+            if (n > 0) cfg.top_n = static_cast<std::size_t>(n);
+        }
+        catch (const std::exception&) {
+            util::Logger::instance().warn("[CoinBot] Invalid UPBIT_SCANNER_TOP_N ignored: ", *env);
+        }
+    }
+    cfg.top_n = std::min(cfg.top_n, util::AppConfig::instance().account.max_markets);
+    return cfg;
+}
+
+// 줄/쉼표 구분 마켓 목록, '#' 이후는 주석. 읽기 실패 시 nullopt (빈 파일은 빈 목록)
+static std::optional<std::vector<std::string>> readMarketsFile(const std::string& path)
+{
+    std::ifstream in(path);
+    if (!in)
+        return std::nullopt;
+
+    std::vector<std::string> result;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        line = line.substr(0, line.find('#'));
+        std::istringstream ss(line);
+        std::string token;
+        while (std::getline(ss, token, ','))
+        {
+            const auto b = token.find_first_not_of(" \t\r");
+            if (b == std::string::npos) continue;
+            const auto e = token.find_last_not_of(" \t\r");
+            token = token.substr(b, e - b + 1);
+            if (std::find(result.begin(), result.end(), token) == result.end())
+                result.push_back(token);
+        }
+    }
+    return result;
+}
+
+// 목표 마켓 목록(구성 파일/스캐너)과 현재 운용 마켓의 차이를 반영 (추가는 즉시, 제거는 drain 요청)
+static void applyMarketSet(app::MarketEngineManager& engine_mgr,
+                             const std::vector<std::string>& desired)
+{
+    auto& logger = util::Logger::instance();
+    const auto current = engine_mgr.markets();
+
+    for (const auto& market : current)
+    {
+        if (std::find(desired.begin(), desired.end(), market) == desired.end())
+            (void)engine_mgr.removeMarket(market);
+    }
+    for (const auto& market : desired)
+    {
+        // drain 중인 마켓이 다시 들어오면 addMarket이 drain을 취소
+        if (!engine_mgr.addMarket(market) &&
+            std::find(current.begin(), current.end(), market) == current.end())
+            logger.warn("[CoinBot] Market add failed: ", market);
+    }
+}
+
 // ---- 봇 실행 본체 ----
 // MarketEngineManager 생성자가 계좌 동기화 실패 시 throw → main에서 catch
 static int run(const std::string& access_key,
@@ -146,15 +261,25 @@ static int run(const std::string& access_key,
     ssl_ctx.set_verify_mode(boost::asio::ssl::verify_peer); // 서버 인증서 체인 검증 활성화
 #endif
 
+    // ---- 연결 캐시 (REST/WS 공유) ----
+    // DNS 결과 TTL 재사용 + TLS 세션 재사용 → 새 REST 연결/WS 재연결의 resolve·full handshake 생략
+    // ssl_ctx보다 뒤에 선언 → 먼저 소멸 (세션 콜백 해제 후 ssl_ctx 정리)
+    api::net::ResolverCache   dns_cache;
+    api::net::TlsSessionCache tls_sessions(ssl_ctx);
+
     // ---- REST 클라이언트 ----
     api::auth::UpbitJwtSigner signer(access_key, secret_key);
-    api::rest::RestClient     rest_client(ioc, ssl_ctx);
+    api::rest::RestClient     rest_client(ioc, ssl_ctx, &dns_cache, &tls_sessions);
 
-    // UpbitExchangeRestClient: 순수 HTTP 담당 (스레드 비안전)
-    // SharedOrderApi: IOrderApi 구현 + mutex 직렬화 (멀티마켓 워커 스레드 공유용)
+    // UpbitExchangeRestClient: 순수 HTTP 담당 (호출마다 독립 연결 → 병렬 호출 가능)
+    // SharedOrderApi: IOrderApi 구현, Permit 게이트로 동시 호출 상한 + 요청/주문 시작 간격 제한
+    //                 (멀티마켓 워커 스레드 공유용)
+    const auto& rest_cfg = util::AppConfig::instance().rest;
     auto exchange_client = std::make_unique<api::rest::UpbitExchangeRestClient>(
         rest_client, std::move(signer));
-    api::upbit::SharedOrderApi shared_api(std::move(exchange_client));
+    api::upbit::SharedOrderApi shared_api(std::move(exchange_client),
+        api::upbit::SharedOrderApi::Options{
+            rest_cfg.max_in_flight, rest_cfg.min_request_interval, rest_cfg.min_order_interval });
 
     // ---- 공유 자원 ----
     engine::OrderStore                  order_store;
@@ -166,21 +291,57 @@ static int run(const std::string& access_key,
     db.open(util::AppConfig::instance().bot.db_path);
     logger.info("[CoinBot] Database opened: ", util::AppConfig::instance().bot.db_path);
 
+    // ---- 라이브 상태 버스 ----
+    // engine_mgr보다 먼저 생성 → 워커 종료 후 unmap/unlink
+    // 열기 실패(비 POSIX, 권한 등)는 발행만 생략하고 계속 진행
+    const auto& bus_cfg = util::AppConfig::instance().state_bus;
+    statebus::StateBusWriter state_bus(
+        statebus::StateBusWriter::Options{ bus_cfg.shm_name, bus_cfg.market_capacity });
+    if (!bus_cfg.shm_name.empty())
+        (void)state_bus.open();
+
     // ---- MarketEngineManager ----
     // 생성자 내부에서 계좌 동기화 + 마켓별 미체결 복구 수행
     // 계좌 동기화 실패 시 std::runtime_error → run() 밖으로 전파
     logger.info("[CoinBot] Initializing MarketEngineManager...");
+    app::MarketEngineManager::MarketManagerConfig mgr_cfg{};   // 기본값
+    mgr_cfg.startup_parallelism = rest_cfg.max_in_flight;      // REST 동시 호출 상한만큼 마켓 복구 병렬화
+    mgr_cfg.trade_stream = loadTradeStream();
+    const int orderbook_levels = loadOrderbookLevels();
+    mgr_cfg.orderbook = orderbook_levels > 0;
     app::MarketEngineManager engine_mgr(
         shared_api,
         order_store,
         account_mgr,
         markets,
-        app::MarketEngineManager::MarketManagerConfig{},   // 기본값
+        mgr_cfg,
         &db); // DB 주입: 신호·주문·캔들 기록
 
     // ---- EventRouter ----
     app::EventRouter router;
     engine_mgr.registerWith(router);
+    engine_mgr.attachStateBus(state_bus);   // 미오픈이면 무시
+
+    // ---- 런타임 마켓 추가: 과거 분봉으로 지표 warm-start ----
+    // Quotation API(인증 없음)로 전략 단위 최근 분봉 조회 → 최신순 응답 + 첫 봉은 진행 중 → 제외 후 오래된 순으로
+    api::upbit::UpbitPublicRestClient public_api(rest_client);
+    engine_mgr.setCandleHistorySource([&public_api, &engine_mgr](const std::string& market) {
+        const auto& bot_cfg = util::AppConfig::instance().bot;
+        std::vector<core::Candle> history;
+        auto result = public_api.getCandlesMinutes(
+            market, engine_mgr.strategyCandleUnit(), bot_cfg.warmup_candles);
+        if (auto* candles = std::get_if<std::vector<core::Candle>>(&result);
+            candles && candles->size() > 1)
+            history.assign(candles->rbegin(), candles->rend() - 1);
+        return history;
+    });
+
+    // ---- 유니버스 스캐너 ----
+    // 활성화 시 시세 일괄 조회로 상위 마켓을 고르고, 선택이 바뀌면 메인 루프가 마켓 추가/drain으로 반영
+    // (스캐너가 켜져 있으면 마켓 구성 파일은 무시)
+    const util::ScannerConfig scanner_cfg = loadScannerConfig();
+    app::MarketScanner scanner(public_api, scanner_cfg);
+    scanner.seed(markets);
 
     // ---- HealthCheck: WS fatal 감지 플래그 ----
     // WS 재연결 한도 초과 또는 워커 비정상 종료 시 std::exit(1) → systemd Restart=on-failure 유발
@@ -195,24 +356,34 @@ static int run(const std::string& access_key,
     };
 
     // ---- WebSocket: PUBLIC (캔들) ----
-    api::ws::UpbitWebSocketClient ws_public(ioc, ssl_ctx);
-    ws_public.setMessageHandler([&router](std::string_view json) {
-        (void)router.routeMarketData(json);
+    api::ws::UpbitWebSocketClient ws_public(ioc, ssl_ctx, &dns_cache, &tls_sessions);
+    ws_public.setMessageHandler([&router](std::string_view json, std::int64_t recv_ns) {
+        (void)router.routeMarketData(json, recv_ns);
     });
     ws_public.setFatalCallback(onWsFatal);  // 비정상 종료 콜백을 start() 전 등록
+    ws_public.setWarmStandby(util::AppConfig::instance().websocket.warm_standby);
     ws_public.connectPublic("api.upbit.com", "443", "/websocket/v1");
     const std::string live_candle_type = buildLiveCandleType();
     logger.info("[CoinBot] Live candle type: ", live_candle_type);
     ws_public.subscribeCandles(live_candle_type, markets, false, true);
+    if (mgr_cfg.trade_stream) {
+        // 캔들과 같은 구독 프레임으로 전송 (Upbit는 새 구독 요청이 기존 구독을 대체)
+        ws_public.subscribeTrades(markets, true);
+        logger.info("[CoinBot] Trade stream enabled (tick-level intrabar checks)");
+    }
+    if (orderbook_levels > 0) {
+        ws_public.subscribeOrderbooks(markets, orderbook_levels);
+        logger.info("[CoinBot] Orderbook stream enabled: levels=", orderbook_levels);
+    }
 
     // ---- WebSocket: PRIVATE (myOrder) ----
     // JWT는 Private WS 핸드셰이크에서 한 번만 사용되므로 no-query 토큰으로 충분
     api::auth::UpbitJwtSigner signer_for_ws(access_key, secret_key);
     const std::string ws_bearer = signer_for_ws.makeBearerToken(std::nullopt);
 
-    api::ws::UpbitWebSocketClient ws_private(ioc, ssl_ctx);
-    ws_private.setMessageHandler([&router](std::string_view json) {
-        (void)router.routeMyOrder(json);
+    api::ws::UpbitWebSocketClient ws_private(ioc, ssl_ctx, &dns_cache, &tls_sessions);
+    ws_private.setMessageHandler([&router](std::string_view json, std::int64_t recv_ns) {
+        (void)router.routeMyOrder(json, recv_ns);
     });
     // Private WS 재연결 시 주문 단위 복구 트리거 (주문 내역을 복구해야 함)
     // atomic flag로 우선 처리 — 전체 계좌 재분배 없이 pending 주문만 복구
@@ -223,27 +394,107 @@ static int run(const std::string& access_key,
     // Private WS는 주문 이벤트가 없으면 ~120s 후 서버가 끊는다 — 30s 텍스트 하트비트로 방지
     ws_private.setHeartbeatMode(api::ws::UpbitWebSocketClient::HeartbeatMode::UpbitTextPing);
     ws_private.setHeartbeatInterval(std::chrono::seconds(30));
+    ws_private.setWarmStandby(util::AppConfig::instance().websocket.warm_standby);
     ws_private.connectPrivate("api.upbit.com", "443", "/websocket/v1/private", ws_bearer);
     ws_private.subscribeMyOrder(markets, true);
 
+    // 런타임 마켓 구성 변경 → 전체 목록으로 재구독 (같은 타입 구독 프레임은 교체되어 재연결 시에도 유지)
+    engine_mgr.setMarketSetListener(
+        [&ws_public, &ws_private, &live_candle_type, &mgr_cfg, orderbook_levels, &logger](const std::vector<std::string>& current) {
+            if (current.empty()) {
+                logger.warn("[CoinBot] No markets left, keeping previous WS subscriptions");
+                return;
+            }
+            ws_public.subscribeCandles(live_candle_type, current, false, true);
+            if (mgr_cfg.trade_stream)
+                ws_public.subscribeTrades(current, true);
+            if (orderbook_levels > 0)
+                ws_public.subscribeOrderbooks(current, orderbook_levels);
+            ws_private.subscribeMyOrder(current, true);
+        });
+
+    // ---- Metrics: 로컬 Prometheus 엔드포인트 ----
+    // 스크레이프는 각 컴포넌트의 atomic 통계만 읽음 → 거래 경로 락과 무관
+    const auto& metrics_cfg = util::AppConfig::instance().metrics;
+    const app::MetricsSources metrics_src{
+        &router, &engine_mgr, &account_mgr, &shared_api, &ws_public, &ws_private, &db,
+        &dns_cache, &tls_sessions, scanner_cfg.enabled ? &scanner : nullptr };
+    app::MetricsServer metrics_server(metrics_cfg.http_bind_address, metrics_cfg.http_port,
+        [&metrics_src] { return app::renderMetrics(metrics_src); });
+
     // ---- 시작 ----
     logger.info("[CoinBot] Starting...");
     engine_mgr.start();
     ws_public.start();
     ws_private.start();
+    if (metrics_cfg.http_port != 0)
+        (void)metrics_server.start();
+    if (scanner_cfg.enabled)
+        scanner.start();
     logger.info("[CoinBot] Running. Press Ctrl+C to stop.");
 
-    // ---- SIGINT / SIGTERM 대기 + fatal 감지 ----
+    // ---- SIGINT / SIGTERM 대기 + fatal 감지 + 주기 지연 리포트 ----
     // WS 재연결 한도 초과 또는 워커 비정상 종료 시 즉시 exit(1) → systemd 재시작
+    const auto latency_interval = util::AppConfig::instance().metrics.latency_report_interval;
+    auto next_latency_report = std::chrono::steady_clock::now() + latency_interval;
+
+    // 마켓 구성 파일: 수정 시각이 바뀌면 다시 읽어 반영, drain 완료 마켓은 같은 주기로 회수
+    const std::string markets_file = loadMarketsFilePath();
+    const auto markets_poll = util::AppConfig::instance().bot.markets_file_poll_interval;
+    auto next_markets_poll = std::chrono::steady_clock::now();
+    std::optional<std::filesystem::file_time_type> markets_file_mtime;
+    std::uint64_t scanner_version = 0;
+    // 마지막 목표 마켓 목록: 일부 추가가 실패해도(계좌 조회 실패, slot 부족 등) 운용 목록과 같아질 때까지 매 주기 재반영
+    std::optional<std::vector<std::string>> desired_markets;
+    if (scanner_cfg.enabled && !markets_file.empty())
+        logger.warn("[CoinBot] Market scanner enabled, markets file ignored: ", markets_file);
+    else if (!markets_file.empty())
+        logger.info("[CoinBot] Watching markets file: ", markets_file);
+
     while (!g_stop_requested) {
         if (fatal_requested.load(std::memory_order_acquire) || engine_mgr.hasFatalWorker()) {
             logger.error("[HealthCheck] Fatal state detected, exiting for systemd restart");
             std::exit(1);
         }
+        if (latency_interval.count() > 0 && std::chrono::steady_clock::now() >= next_latency_report) {
+            engine_mgr.logLatencyReport();
+            next_latency_report += latency_interval;
+        }
+        if (std::chrono::steady_clock::now() >= next_markets_poll) {
+            next_markets_poll += markets_poll;
+            if (scanner_cfg.enabled) {
+                if (scanner.selectionVersion() != scanner_version) {
+                    auto selection = scanner.selection();
+                    scanner_version = selection.version;
+                    desired_markets = std::move(selection.markets);
+                }
+            }
+            else if (!markets_file.empty()) {
+                std::error_code ec;
+                const auto mtime = std::filesystem::last_write_time(markets_file, ec);
+                if (!ec && mtime != markets_file_mtime) {
+                    if (auto desired = readMarketsFile(markets_file)) {
+                        markets_file_mtime = mtime;
+                        desired_markets = std::move(*desired);
+                    }
+                }
+            }
+            (void)engine_mgr.reapDrainedMarkets();
+
+            // drain 중인 마켓도 회수 전까지는 운용 목록에 남으므로 그동안은 불일치로 보고 재반영 (중복 요청은 무시됨)
+            if (desired_markets) {
+                auto want = *desired_markets;
+                std::sort(want.begin(), want.end());
+                if (want != engine_mgr.markets())
+                    applyMarketSet(engine_mgr, *desired_markets);
+            }
+        }
         std::this_thread::sleep_for(std::chrono::milliseconds(20));
     }
 
     // ---- 정지 ----
+    metrics_server.stop();
+    scanner.stop();     // 진행 중인 시세 조회 1회 완료 후 종료
     // 주문 경로를 먼저 멈춰 종료 중 추가 주문 가능성을 줄인다.
     ws_public.stop();
     // WS는 이후 정리한다. (read 루프는 내부 timeout으로 빠르게 탈출)
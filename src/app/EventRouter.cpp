@@ -3,16 +3,57 @@
 
 #include <json.hpp>
 
+#include "util/LatencyHistogram.h"
 #include "util/Logger.h"
 
 namespace app {
 
+EventRouter::EventRouter()
+    : routes_(new RouteTable())
+{
+}
+
+EventRouter::~EventRouter()
+{
+    delete routes_.load(std::memory_order_relaxed);
+}
+
 void EventRouter::registerMarket(const std::string& market, PrivateQueue& queue)
 {
-    routes_[market] = &queue;
+    std::lock_guard lock(write_mtx_);
+
+    auto next = std::make_unique<RouteTable>(*routes_.load(std::memory_order_relaxed));
+    (*next)[market] = &queue;
+    replaceRoutes_(std::move(next));
+
     util::log().info("[EventRouter] registered market=", market);
 }
 
+bool EventRouter::unregisterMarket(const std::string& market)
+{
+    std::lock_guard lock(write_mtx_);
+
+    const RouteTable* current = routes_.load(std::memory_order_relaxed);
+    if (current->find(market) == current->end())
+        return false;
+
+    auto next = std::make_unique<RouteTable>(*current);
+    next->erase(market);
+    replaceRoutes_(std::move(next));
+
+    util::log().info("[EventRouter] unregistered market=", market);
+    return true;
+}
+
+void EventRouter::replaceRoutes_(std::unique_ptr<RouteTable> next)
+{
+    const RouteTable* old = routes_.exchange(next.release(), std::memory_order_seq_cst);
+
+    // 옛 테이블로 조회/push 중인 라우팅 스레드가 모두 끝난 뒤 해제
+    rcu_.synchronize();
+    delete old;
+}
+
 // ── 키 기반 문자열 값 추출 (zero-allocation) ──────────────────────────
 // JSON 내에서 "key" : "value" 형태를 찾아 value를 string_view로 반환
 // 이스케이프(\\) 포함 시 nullopt → fallback 파싱으로 전환
@@ -108,7 +149,7 @@ std::optional<std::string> EventRouter::extractMarketSlow_(std::string_view json
 }
 
 // ── 시장 데이터 라우팅 (json은 manager에서 거른다, drop-oldest는 BlockingQueue 내부에서 처리) ────
-bool EventRouter::routeMarketData(std::string_view json)
+bool EventRouter::routeMarketData(std::string_view json, std::int64_t recv_ns)
 {
     if (!accepting_.load(std::memory_order_relaxed))
         return false;
@@ -142,9 +183,11 @@ bool EventRouter::routeMarketData(std::string_view json)
         return false;
     }
 
-    // 2. 라우팅 대상 큐 조회
-    auto it = routes_.find(market_key);
-    if (it == routes_.end()) {
+    // 2. 라우팅 대상 큐 조회 (push까지 RCU 읽기 구간 → 해제 중인 큐에 push하지 않음)
+    util::RcuDomain::ReadGuard read_guard(rcu_);
+    const RouteTable& routes = *routes_.load(std::memory_order_seq_cst);
+    auto it = routes.find(market_key);
+    if (it == routes.end()) {
         stats_.unknown_market.fetch_add(1, std::memory_order_relaxed);
         util::log().warn("[EventRouter] marketData unknown market=", market_key);
         return false;
@@ -154,13 +197,18 @@ bool EventRouter::routeMarketData(std::string_view json)
     if (used_fallback) stats_.fallback_used.fetch_add(1, std::memory_order_relaxed);
 
     // push (큐 포화 시 BlockingQueue 내부에서 drop-oldest 처리)
-    it->second->push(engine::input::MarketDataRaw{std::string(json)});
+    // orderbook은 최신 스냅샷만 의미 있음 → 아직 처리 안 된 이전 스냅샷을 덮어씀
+    engine::input::MarketDataRaw raw{std::string(json), recv_ns, util::monoNowNs()};
+    if (extractStringValue_(json, "\"type\"") == std::string_view("orderbook"))
+        it->second->push_latest(std::move(raw));
+    else
+        it->second->push(std::move(raw));
     stats_.total_routed.fetch_add(1, std::memory_order_relaxed);
     return true;
 }
 
 // ── myOrder 라우팅 (유실 불가, 항상 push) ────────────────────────────
-bool EventRouter::routeMyOrder(std::string_view json)
+bool EventRouter::routeMyOrder(std::string_view json, std::int64_t recv_ns)
 {
     if (!accepting_.load(std::memory_order_relaxed))
         return false;
@@ -194,9 +242,11 @@ bool EventRouter::routeMyOrder(std::string_view json)
         return false;
     }
 
-    // 2. 라우팅 대상 큐 조회
-    auto it = routes_.find(market_key);
-    if (it == routes_.end()) {
+    // 2. 라우팅 대상 큐 조회 (push까지 RCU 읽기 구간 → 해제 중인 큐에 push하지 않음)
+    util::RcuDomain::ReadGuard read_guard(rcu_);
+    const RouteTable& routes = *routes_.load(std::memory_order_seq_cst);
+    auto it = routes.find(market_key);
+    if (it == routes.end()) {
         stats_.unknown_market.fetch_add(1, std::memory_order_relaxed);
         util::log().warn("[EventRouter] myOrder unknown market=", market_key);
         return false;
@@ -205,8 +255,8 @@ bool EventRouter::routeMyOrder(std::string_view json)
     if (used_fast) stats_.fast_path_success.fetch_add(1, std::memory_order_relaxed);
     if (used_fallback) stats_.fallback_used.fetch_add(1, std::memory_order_relaxed);
 
-    // 3. 유실 불가 → 항상 push (백프레셔 없음)
-    it->second->push(engine::input::MyOrderRaw{std::string(json)});
+    // 3. 유실 불가 → 우선 레인에 항상 push (백프레셔/drop 없음)
+    it->second->push_priority(engine::input::MyOrderRaw{std::string(json), recv_ns, util::monoNowNs()});
     stats_.total_routed.fetch_add(1, std::memory_order_relaxed);
     return true;
 }
@@ -5,6 +5,8 @@
 #include <atomic>
 #include <cctype>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -12,6 +14,7 @@
 
 #include "core/BlockingQueue.h"
 #include "engine/input/EngineInput.h"
+#include "util/Rcu.h"
 
 namespace app {
 
@@ -19,25 +22,34 @@ class EventRouter {
 public:
     using PrivateQueue = core::BlockingQueue<engine::input::EngineInput>;
 
-    EventRouter() = default;
+    EventRouter();
+    ~EventRouter();
 
-    // 마켓별 큐 등록 (WS 스레드 시작 전 호출)
-    // Phase 1.5에서 MarketEngineManager가 호출 예정
+    EventRouter(const EventRouter&) = delete;
+    EventRouter& operator=(const EventRouter&) = delete;
+
+    // 마켓별 큐 등록 (WS 스레드 실행 중에도 호출 가능)
+    // 라우팅 테이블을 복사·수정한 새 테이블로 교체 (RCU) → 라우팅 경로는 락 없이 조회
     //
-    // 수명 계약: queue는 EventRouter보다 오래 살아있어야 함
-    // - 등록 후 WS 스레드가 시작되면 routes_는 읽기 전용으로 사용
-    // - 등록된 큐 객체의 이동/해제 금지 (댕글링 포인터 방지)
+    // 수명 계약: queue는 unregisterMarket() 반환 전까지(또는 EventRouter 소멸 전까지) 살아있어야 함
     void registerMarket(const std::string& market, PrivateQueue& queue);
 
+    // 마켓 등록 해제 (런타임 마켓 제거)
+    // 반환 시점에는 옛 테이블로 라우팅 중이던 스레드가 모두 빠져나감 (grace period)
+    // → 이후 해당 큐로의 push가 없으므로 호출자가 큐를 해제해도 안전
+    // @return 미등록 마켓이면 false
+    bool unregisterMarket(const std::string& market);
+
     // 시장 데이터 라우팅 - drop-oldest는 BlockingQueue(max_size) 생성 시 자동 처리
+    // orderbook 스냅샷은 push_latest로 합침 (큐에 남은 이전 스냅샷을 최신값으로 교체)
     // 성공 시 true, 파싱 실패/미등록 마켓 시 false
-    [[nodiscard]] bool routeMarketData(std::string_view json);
+    // recv_ns: WS 프레임 수신 시각(util::monoNowNs), 큐 push 직전 route_ns와 함께 입력에 기록
+    [[nodiscard]] bool routeMarketData(std::string_view json, std::int64_t recv_ns = 0);
 
     // myOrder 라우팅 - 항상 push (파싱 실패/미등록 마켓 시 drop)
-    // 주의: marketData와 동일한 bounded queue (max_size=5000, drop-oldest) 공유
-    //       burst 시 오래된 myOrder가 밀려날 수 있음 → 실운영에서 큐 분리 검토
+    // 큐의 우선 레인(push_priority)으로 넣음 → 시장 데이터 burst의 drop-oldest에 밀려나지 않고 먼저 처리됨
     // 성공 시 true, 파싱 실패/미등록 마켓 시 false
-    [[nodiscard]] bool routeMyOrder(std::string_view json);
+    [[nodiscard]] bool routeMyOrder(std::string_view json, std::int64_t recv_ns = 0);
 
     // 라우팅 통계 (근사 카운팅, memory_order_relaxed)
     struct Stats {
@@ -70,8 +82,16 @@ private:
     static std::optional<std::string_view> extractStringValue_(
         std::string_view json, std::string_view key);
 
-    // 등록된 마켓 → 큐 매핑 (WS 시작 전 세팅, 이후 읽기 전용)
-    std::unordered_map<std::string, PrivateQueue*> routes_;
+    using RouteTable = std::unordered_map<std::string, PrivateQueue*>;
+
+    // 새 테이블 발행 + grace period 후 옛 테이블 해제 (write_mtx_ 보유 상태에서 호출)
+    void replaceRoutes_(std::unique_ptr<RouteTable> next);
+
+    // 등록된 마켓 → 큐 매핑 (불변 테이블, 변경 시 통째로 교체)
+    // 읽기는 rcu_ 구간 안에서 seq_cst load, 쓰기는 write_mtx_로 직렬화
+    std::atomic<const RouteTable*> routes_;
+    util::RcuDomain rcu_;
+    std::mutex write_mtx_;
 
     // true: 라우팅 허용, false: 종료 중 라우팅 차단
     std::atomic<bool> accepting_{ true };
@@ -4,8 +4,10 @@
 #include "app/EventRouter.h"
 #include "app/StartupRecovery.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
@@ -13,16 +15,22 @@
 
 #include "api/upbit/WsMessageParser.h"
 #include "util/Config.h"
+#include "util/LatencyHistogram.h"
 #include "util/Logger.h"
+#include "util/PrometheusText.h"
 
 namespace app {
 
 namespace {
 
+    // 복구 결과 대기 만료: 코디네이터 최대 백오프(0.5+1s) + 조회 지연보다 충분히 길게
+    // 결과 이벤트가 drop-oldest로 유실된 경우에만 이 시간 뒤 재제출
+    constexpr auto kRecoveryResultTimeout = std::chrono::seconds(30);
+
     // 전략 상태를 로그용 문자열로 변환
-    const char* toStringState(trading::strategies::RsiMeanReversionStrategy::State s)
+    const char* toStringState(trading::StrategyState s)
     {
-        using S = trading::strategies::RsiMeanReversionStrategy::State;
+        using S = trading::StrategyState;
         switch (s)
         {
         case S::Flat:         return "Flat";
@@ -49,6 +57,30 @@ namespace {
         }, size);
     }
 
+    // 큐 진입 구간 기록: WS 수신 → 라우팅, 라우팅 → 워커 pop
+    void recordIngress(PipelineLatency& lat, std::int64_t recv_ns, std::int64_t route_ns)
+    {
+        if (route_ns <= 0) return;
+        if (recv_ns > 0)
+            lat.record(LatencyStage::WsToRoute, route_ns - recv_ns);
+        lat.record(LatencyStage::RouteToDequeue, util::monoNowNs() - route_ns);
+    }
+
+    // ns → us (리포트 가독성)
+    double toMicros(std::uint64_t ns)
+    {
+        return static_cast<double>(ns) / 1000.0;
+    }
+
+    void logLatencySummary(std::string_view market, LatencyStage stage,
+        const util::LatencySummary& s)
+    {
+        COINBOT_LOG_INFO("[Latency][", market, "]",
+            util::kv("stage", toString(stage)), util::kv("n", s.count),
+            util::kv("p50_us", toMicros(s.p50)), util::kv("p99_us", toMicros(s.p99)),
+            util::kv("p999_us", toMicros(s.p999)), util::kv("max_us", toMicros(s.max)));
+    }
+
 } // anonymous namespace
 
 // ========== 생성자 ==========
@@ -64,6 +96,15 @@ MarketEngineManager::MarketEngineManager(
     , account_mgr_(account_mgr)
     , cfg_(std::move(cfg))
     , db_(db)
+    , recovery_(api_,
+        [this](const std::string& market, engine::input::RecoveredOrders&& rec) {
+            // 런타임 추가/제거와 경합 → 공유 락 (해제 중인 ctx 큐에 push하지 않음)
+            std::shared_lock lock(contexts_mtx_);
+            auto it = contexts_.find(market);
+            if (it != contexts_.end())
+                it->second->event_queue.push_priority(std::move(rec));  // 시장 데이터 drop에 밀려나지 않도록
+        },
+        cfg_.recovery)
 {
     auto& logger = util::Logger::instance();
     const auto logBudgets = [this, &logger](std::string_view stage)
@@ -88,11 +129,41 @@ MarketEngineManager::MarketEngineManager(
         }
     };
 
-    // 1) 계좌 동기화 (1차: 실패 시 예외)
-    logger.info("[MarketEngineManager] Syncing account with exchange...");
-    rebuildAccountOnStartup_(/*throw_on_fail=*/true);
-
-    // 2) 마켓별 컨텍스트 생성 + 전략 복구
+    // 분봉 단위 결정: live 스트림 하나에서 상위 단위를 리샘플, 전략은 그 중 한 단위를 소비
+    const auto& bot_cfg = util::AppConfig::instance().bot;
+    live_unit_ = bot_cfg.live_candle_unit_minutes;
+    strategy_unit_ = bot_cfg.strategy_candle_unit_minutes > 0
+        ? bot_cfg.strategy_candle_unit_minutes : live_unit_;
+    if (strategy_unit_ != live_unit_ &&
+        !marketdata::CandleResampler::canDerive(live_unit_, strategy_unit_))
+    {
+        logger.warn("[MarketEngineManager] strategy_candle_unit_minutes=", strategy_unit_,
+            " cannot be built from live unit ", live_unit_, ", using live unit");
+        strategy_unit_ = live_unit_;
+    }
+    for (const int unit : bot_cfg.resample_units_minutes)
+        if (marketdata::CandleResampler::canDerive(live_unit_, unit))
+            resample_units_.push_back(unit);
+    if (strategy_unit_ != live_unit_)
+        resample_units_.push_back(strategy_unit_);
+    std::sort(resample_units_.begin(), resample_units_.end());
+    resample_units_.erase(std::unique(resample_units_.begin(), resample_units_.end()), resample_units_.end());
+
+    std::ostringstream units_log;
+    for (const int unit : resample_units_) units_log << unit << "m ";
+    logger.info("[MarketEngineManager] Candle units: live=", live_unit_, "m strategy=", strategy_unit_,
+        "m resample=[ ", units_log.str(), "]");
+
+    // 시작 흐름 (REST 왕복 최소화):
+    //   1) 마켓별 컨텍스트 생성 (REST 없음)
+    //   2) 마켓별 봇 미체결 취소를 병렬 fan-out (SharedOrderApi 동시 호출 상한/간격 안에서)
+    //   3) 취소 반영 후 계좌 1회 조회 → AccountManager 재구축 (실패 시 예외)
+    //   4) 같은 Account로 마켓별 포지션 스냅샷 → 전략 syncOnStart
+    const auto t_begin = util::monoNowNs();
+
+    // 1) 마켓별 컨텍스트 생성
+    std::vector<MarketContext*> ordered;
+    ordered.reserve(markets.size());
     for (const auto& market : markets)
     {
         // 중복 마켓 입력 방어: 덮어쓰면 이전 큐 포인터가 댕글링될 수 있음
@@ -102,39 +173,50 @@ MarketEngineManager::MarketEngineManager(
             continue;
         }
 
-        auto ctx = std::make_unique<MarketContext>(market, cfg_.queue_capacity);
+        auto ctx = makeContext_(market);
+        ordered.push_back(ctx.get());
+        contexts_[market] = std::move(ctx);
+    }
+    const auto t_contexts = util::monoNowNs();
 
-        // MarketEngine 생성
-        ctx->engine = std::make_unique<engine::MarketEngine>(
-            market, api_, store_, account_mgr_);
+    // 2) 마켓별 봇 미체결 취소 (병렬)
+    std::vector<std::int64_t> cancel_ns(ordered.size(), 0);
+    cancelStartupOrdersParallel_(ordered, cancel_ns);
+    const auto t_cancel = util::monoNowNs();
 
-        // 전략 생성
-        ctx->strategy = std::make_unique<trading::strategies::RsiMeanReversionStrategy>(
-            market, cfg_.strategy_params);
+    // 3) 계좌 1회 조회 + 재구축 (취소로 풀린 KRW/코인까지 반영된 상태)
+    logger.info("[MarketEngineManager] Syncing account with exchange...");
+    const core::Account account = *rebuildAccountOnStartup_(/*throw_on_fail=*/true);
+    const auto t_account = util::monoNowNs();
 
-        // DB 신호 콜백 등록: PendingEntry→InPosition, PendingExit→Flat 전이 시 signals 테이블 기록
-        if (db_) {
-            ctx->strategy->setSignalCallback([this](const trading::SignalRecord& sig) {
-                db_->insertSignal(sig);
-            });
-        }
+    // 4) 전략 포지션 복구 (REST 없음)
+    for (MarketContext* ctx : ordered)
+        syncStrategyOnStart_(*ctx, account);
+    const auto t_sync = util::monoNowNs();
 
-        // StartupRecovery: 미체결 취소 + 내부 전략 포지션 복구
-        recoverMarketState_(*ctx);
+    // 동기화 후 분배 상태 확인 로그
+    logBudgets("after_startup_sync");
 
-        logger.info("[MarketEngineManager] Context created for market=", market);
-        contexts_[market] = std::move(ctx);
+    // 시작 소요 시간 분해 (가장 느린 마켓 = 취소 단계 하한)
+    std::size_t slowest = 0;
+    std::int64_t cancel_sum_ns = 0;
+    for (std::size_t i = 0; i < cancel_ns.size(); ++i)
+    {
+        cancel_sum_ns += cancel_ns[i];
+        if (cancel_ns[i] > cancel_ns[slowest]) slowest = i;
     }
-
-    // 생성 직후(1차 동기화 + 복구 반영) 분배 상태 확인 로그
-    logBudgets("after_recovery");
-
-    // 3) 미체결 취소 후 최종 계좌 동기화 (2차: 실패 시 경고만)
-    logger.info("[MarketEngineManager] Final account sync after recovery...");
-    rebuildAccountOnStartup_(/*throw_on_fail=*/false);
-
-    // 2차 동기화 후 최종 분배 상태 확인 로그
-    logBudgets("after_final_sync");
+    const auto ms = [](std::int64_t ns) { return static_cast<double>(ns) / 1e6; };
+    COINBOT_LOG_INFO("[MarketEngineManager][StartupTiming]",
+        util::kv("markets", ordered.size()),
+        util::kv("parallel", std::min(cfg_.startup_parallelism, ordered.size())),
+        util::kv("contexts_ms", ms(t_contexts - t_begin)),
+        util::kv("cancel_ms", ms(t_cancel - t_contexts)),
+        util::kv("cancel_sum_ms", ms(cancel_sum_ns)),
+        util::kv("cancel_slowest", ordered.empty() ? std::string("-") : ordered[slowest]->market),
+        util::kv("cancel_slowest_ms", ordered.empty() ? 0.0 : ms(cancel_ns[slowest])),
+        util::kv("account_ms", ms(t_account - t_cancel)),
+        util::kv("sync_ms", ms(t_sync - t_account)),
+        util::kv("total_ms", ms(t_sync - t_begin)));
 
     logger.info("[MarketEngineManager] Initialized with ", contexts_.size(), " markets",
         (contexts_.size() < markets.size()
@@ -148,44 +230,123 @@ MarketEngineManager::~MarketEngineManager()
     stop();
 }
 
+// ========== makeContext_ ==========
+std::unique_ptr<MarketEngineManager::MarketContext> MarketEngineManager::makeContext_(
+    const std::string& market)
+{
+    auto ctx = std::make_unique<MarketContext>(market, cfg_.queue_capacity);
+
+    // MarketEngine 생성
+    ctx->engine = std::make_unique<engine::MarketEngine>(
+        market, api_, store_, account_mgr_);
+    ctx->balances = account_mgr_.publishedBalances(market);
+
+    if (cfg_.trade_stream)
+        ctx->ticks = std::make_unique<marketdata::TickAggregator>(
+            static_cast<std::int64_t>(live_unit_) * 60'000);
+
+    if (cfg_.orderbook)
+    {
+        ctx->orderbook = std::make_unique<marketdata::OrderBook>();
+        ctx->engine->setOrderBook(ctx->orderbook.get());
+    }
+
+    if (!resample_units_.empty())
+    {
+        ctx->resampler = std::make_unique<marketdata::CandleResampler>(live_unit_, resample_units_);
+        ctx->resampled.reserve(resample_units_.size());
+    }
+
+    // 전략 생성 (전략들이 공유 조회하는 봉 시계열은 컨텍스트 소유)
+    ctx->series = std::make_unique<marketdata::PriceSeries>(
+        trading::strategies::MarketStrategies::kSeriesLookback);
+    ctx->strategies = std::make_unique<trading::strategies::MarketStrategies>(
+        market, cfg_.strategy_params, *ctx->series);
+
+    // DB 신호 콜백 등록: PendingEntry→InPosition, PendingExit→Flat 전이 시 signals 테이블 기록
+    if (db_) {
+        ctx->strategies->setSignalCallback([this, c = ctx.get()](const trading::SignalRecord& sig) {
+            // 같은 주문의 사전 추정이 있으면 예상 체결가/슬리피지를 함께 기록 (실제 VWAP과 비교용)
+            if (c->slippage_identifier.empty() || c->slippage_identifier != sig.identifier) {
+                db_->insertSignal(sig);
+                return;
+            }
+            trading::SignalRecord rec = sig;
+            rec.expected_price = c->slippage_estimate.vwap;
+            rec.expected_slippage_bps = c->slippage_estimate.slippage_bps;
+            db_->insertSignal(rec);
+        });
+    }
+
+    util::Logger::instance().info("[MarketEngineManager] Context created for market=", market);
+    return ctx;
+}
+
 // ========== registerWith ==========
 void MarketEngineManager::registerWith(EventRouter& router)
 {
+    std::shared_lock lock(contexts_mtx_);
+
+    router_ = &router;
     for (auto& [market, ctx] : contexts_)
     {
         router.registerMarket(market, ctx->event_queue);
     }
 }
 
+// ========== attachStateBus ==========
+void MarketEngineManager::attachStateBus(statebus::StateBusWriter& bus)
+{
+    if (started_ || !bus.isOpen()) return;
+
+    std::shared_lock lock(contexts_mtx_);
+
+    state_bus_ = &bus;
+    for (auto& [market, ctx] : contexts_)
+        ctx->state_slot = bus.addMarket(market);
+}
+
 // ========== start ==========
 void MarketEngineManager::start()
 {
+    std::lock_guard membership(membership_mtx_);
     if (started_) return;
 
-    auto& logger = util::Logger::instance();
+    recovery_.start();
 
     // 마켓별로 스레드 생성
+    std::shared_lock lock(contexts_mtx_);
     for (auto& [market, ctx] : contexts_)
-    {
-        // jthread 생성 시 stop_token이 자동으로 전달됨
-        ctx->worker = std::jthread([this, &ctx_ref = *ctx](std::stop_token stoken) {
-            workerLoop_(ctx_ref, stoken);
-        });
-
-        logger.info("[MarketEngineManager] Worker started for market=", market);
-    }
+        startWorker_(*ctx);
 
     started_ = true;
 }
 
+// ========== startWorker_ ==========
+void MarketEngineManager::startWorker_(MarketContext& ctx)
+{
+    // jthread 생성 시 stop_token이 자동으로 전달됨
+    ctx.worker = std::jthread([this, &ctx](std::stop_token stoken) {
+        workerLoop_(ctx, stoken);
+    });
+
+    util::Logger::instance().info("[MarketEngineManager] Worker started for market=", ctx.market);
+}
+
 // ========== stop ==========
 void MarketEngineManager::stop()
 {
+    std::lock_guard membership(membership_mtx_);
     if (!started_) return;
 
     auto& logger = util::Logger::instance();
     logger.info("[MarketEngineManager] Stopping all workers...");
 
+    // 코디네이터 먼저 정지 (진행 중인 조회 1회는 완료 후 종료)
+    recovery_.stop();
+
+    std::shared_lock lock(contexts_mtx_);
+
     // 모든 워커에 stop 요청 (request_stop → stop_token을 통해 전달)
     for (auto& [market, ctx] : contexts_)
         ctx->worker.request_stop();
@@ -202,11 +363,361 @@ void MarketEngineManager::stop()
 
     started_ = false;
     logger.info("[MarketEngineManager] All workers stopped");
+
+    // 종료 시점 최종 지연 리포트 (공유 락 재진입 금지 → 해제 후 호출)
+    lock.unlock();
+    logLatencyReport();
+}
+
+// ========== addMarket ==========
+bool MarketEngineManager::addMarket(const std::string& market)
+{
+    auto& logger = util::Logger::instance();
+    std::lock_guard membership(membership_mtx_);
+
+    if (!router_)
+    {
+        logger.warn("[MarketEngineManager] addMarket before registerWith: ", market);
+        return false;
+    }
+
+    {
+        std::shared_lock lock(contexts_mtx_);
+        if (auto it = contexts_.find(market); it != contexts_.end())
+        {
+            MarketContext& existing = *it->second;
+            if (!existing.draining.load(std::memory_order_acquire))
+                return false;
+
+            // 제거 대기 중 재추가 → drain 취소 (해제 전이므로 그대로 계속 운용)
+            existing.draining.store(false, std::memory_order_release);
+            existing.drained.store(false, std::memory_order_release);
+            logger.info("[MarketEngineManager] Drain cancelled for market=", market);
+            return true;
+        }
+    }
+
+    const auto t_begin = util::monoNowNs();
+
+    // 1) 봇 미체결 취소 (이전 실행이 남긴 이 마켓 주문, prefix는 전략 id만으로 계산)
+    //    엔진/전략은 예산 slot 배분 후에 생성
+    cancelStartupOrders_(market);
+
+    // 2) 계좌 1회 조회 (취소 반영 후 포지션 이어받기)
+    auto account_result = api_.getMyAccount();
+    if (!std::holds_alternative<core::Account>(account_result))
+    {
+        logger.warn("[MarketEngineManager] addMarket account fetch failed: market=", market,
+            " error=", std::get<api::rest::RestError>(account_result).message);
+        return false;
+    }
+    const auto& account = std::get<core::Account>(account_result);
+
+    std::optional<core::Position> position;
+    for (const auto& pos : account.positions)
+    {
+        if ("KRW-" + pos.currency == market)
+        {
+            position = pos;
+            break;
+        }
+    }
+
+    // 3) 예산 slot 배분 (유휴 Flat 마켓에서 KRW 이전, 엔진 생성 전)
+    if (!account_mgr_.addMarket(market, position))
+    {
+        logger.warn("[MarketEngineManager] addMarket rejected by AccountManager "
+            "(duplicate or max_markets reached): ", market);
+        return false;
+    }
+
+    // 4) 엔진/전략 생성 + 포지션 복구
+    auto ctx = makeContext_(market);
+    syncStrategyOnStart_(*ctx, account);
+
+    // 5) 과거 확정 봉으로 지표 warm-start (수 시간 분량 지표 준비 대기 생략)
+    std::size_t warmed = 0;
+    if (history_source_)
+        warmed = ctx->strategies->warmUp(history_source_(market));
+    if (warmed == 0)
+        logger.warn("[MarketEngineManager] Warm-up skipped (no history), market=", market);
+
+    // 6) 상태 버스 슬롯 (같은 이름이 있었으면 재사용)
+    if (state_bus_)
+        ctx->state_slot = state_bus_->addMarket(market);
+
+    // 7) 등록 → 라우팅 → 워커 시작 (라우팅 전에 컨텍스트가 보여야 복구 결과도 전달됨)
+    //    워커 시작 후 전략은 워커 전용 → 로그용 상태는 미리 읽어 둠
+    const char* state = toStringState(ctx->strategies->state());
+    MarketContext& ref = *ctx;
+    {
+        std::unique_lock lock(contexts_mtx_);
+        contexts_.emplace(market, std::move(ctx));
+    }
+    router_->registerMarket(market, ref.event_queue);
+    if (started_)
+        startWorker_(ref);
+
+    const auto b = account_mgr_.getBudget(market);
+    COINBOT_LOG_INFO("[MarketEngineManager][MarketAdded]",
+        util::kv("market", market),
+        util::kv("state", state),
+        util::kv("warmup_candles", warmed),
+        util::kv("krw_available", b ? b->available_krw : 0.0),
+        util::kv("coin_balance", b ? b->coin_balance : 0.0),
+        util::kv("total_ms", static_cast<double>(util::monoNowNs() - t_begin) / 1e6));
+
+    // 8) WS 재구독 등 구성 변경 반영
+    notifyMarketSet_();
+    return true;
+}
+
+// ========== removeMarket ==========
+bool MarketEngineManager::removeMarket(const std::string& market)
+{
+    std::lock_guard membership(membership_mtx_);
+    std::shared_lock lock(contexts_mtx_);
+
+    auto it = contexts_.find(market);
+    if (it == contexts_.end())
+        return false;
+
+    MarketContext& ctx = *it->second;
+    if (!ctx.draining.load(std::memory_order_acquire))
+    {
+        // drained는 워커가 다시 판정 (이전 drain 취소 시 남은 값 무효화)
+        ctx.drained.store(false, std::memory_order_release);
+        ctx.draining.store(true, std::memory_order_release);
+        util::Logger::instance().info("[MarketEngineManager] Draining market=", market,
+            " (no new entries, waiting for flat)");
+    }
+    return true;
+}
+
+// ========== reapDrainedMarkets ==========
+std::size_t MarketEngineManager::reapDrainedMarkets()
+{
+    auto& logger = util::Logger::instance();
+    std::lock_guard membership(membership_mtx_);
+
+    std::vector<MarketContext*> ready;
+    {
+        std::shared_lock lock(contexts_mtx_);
+        for (const auto& [market, ctx] : contexts_)
+        {
+            if (ctx->draining.load(std::memory_order_acquire) &&
+                ctx->drained.load(std::memory_order_acquire))
+                ready.push_back(ctx.get());
+        }
+    }
+    if (ready.empty()) return 0;
+
+    std::size_t removed = 0;
+    for (MarketContext* ctx : ready)
+    {
+        const std::string market = ctx->market;
+
+        // 1) 예산 반환 먼저 (예약/코인 보유 재확인은 AccountManager가 모든 slot 락 안에서 수행)
+        //    실패 시 해제하지 않고 그대로 운용 → 워커가 유휴 Flat을 다시 판정한 뒤 다음 회수에서 재시도
+        if (!account_mgr_.removeMarket(market))
+        {
+            ctx->drained.store(false, std::memory_order_release);
+            logger.warn("[MarketEngineManager] AccountManager refused removal, keeping market=",
+                market, " (reserved or holding coin)");
+            continue;
+        }
+
+        // 2) 라우팅 해제: 반환 시점부터 이 큐로의 push 없음 (RCU grace period)
+        if (router_)
+            (void)router_->unregisterMarket(market);
+
+        // 3) 워커 정지 (남은 큐 이벤트는 버림 — drain 완료라 주문 이벤트 없음)
+        ctx->worker.request_stop();
+        if (ctx->worker.joinable())
+            ctx->worker.join();
+
+        // 4) 상태 버스 표시 + 컨텍스트 파기
+        if (state_bus_ && ctx->state_slot)
+            state_bus_->markRemoved(*ctx->state_slot);
+
+        {
+            std::unique_lock lock(contexts_mtx_);
+            contexts_.erase(market);
+        }
+
+        logger.info("[MarketEngineManager] Market removed: ", market);
+        ++removed;
+    }
+
+    if (removed > 0)
+        notifyMarketSet_();
+    return removed;
+}
+
+// ========== markets ==========
+std::vector<std::string> MarketEngineManager::markets() const
+{
+    std::shared_lock lock(contexts_mtx_);
+
+    std::vector<std::string> out;
+    out.reserve(contexts_.size());
+    for (const auto& [market, ctx] : contexts_)
+        out.push_back(market);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+// ========== notifyMarketSet_ ==========
+void MarketEngineManager::notifyMarketSet_()
+{
+    if (market_set_listener_)
+        market_set_listener_(markets());
+}
+
+// ========== isIdleFlat_ ==========
+bool MarketEngineManager::isIdleFlat_(const MarketContext& ctx)
+{
+    if (ctx.strategies->state() != trading::StrategyState::Flat ||
+        ctx.has_active_pending.load(std::memory_order_relaxed) ||
+        ctx.recovery_in_flight)
+        return false;
+
+    if (!ctx.balances) return true;
+
+    // AccountManager::removeMarket과 같은 조건 (예약 없음 + 유효 코인 없음)
+    const auto b = ctx.balances->load();
+    const auto& acc = util::AppConfig::instance().account;
+    const bool holds_coin = b.coin_balance >= acc.coin_epsilon &&
+        b.coin_balance * b.avg_entry_price >= acc.init_dust_threshold_krw;
+    return b.reserved_krw <= 0 && !holds_coin;
+}
+
+// ========== logLatencyReport ==========
+void MarketEngineManager::logLatencyReport() const
+{
+    std::shared_lock lock(contexts_mtx_);
+
+    // 단계별로 마켓 히스토그램을 읽어 출력 + 전체 합산(ALL)
+    for (std::size_t i = 0; i < kLatencyStageCount; ++i)
+    {
+        const auto stage = static_cast<LatencyStage>(i);
+        util::LatencyHistogram::Snapshot total;
+
+        for (const auto& [market, ctx] : contexts_)
+        {
+            const auto snap = ctx->latency.at(stage).snapshot();
+            if (snap.count == 0) continue;
+
+            logLatencySummary(market, stage, snap.summary());
+            total.merge(snap);
+        }
+
+        if (total.count > 0)
+            logLatencySummary("ALL", stage, total.summary());
+    }
+}
+
+// ========== writeMetrics ==========
+void MarketEngineManager::writeMetrics(util::PrometheusText& out) const
+{
+    const auto now_ns = util::monoNowNs();
+    std::shared_lock lock(contexts_mtx_);
+
+    out.family("coinbot_market_queue_depth", "gauge", "Pending events in the market worker queue");
+    for (const auto& [market, ctx] : contexts_)
+        out.sample("coinbot_market_queue_depth", { { "market", market } },
+            static_cast<std::uint64_t>(ctx->event_queue.approxSize()));
+
+    out.family("coinbot_market_queue_dropped_total", "counter", "Events dropped by drop-oldest");
+    for (const auto& [market, ctx] : contexts_)
+        out.sample("coinbot_market_queue_dropped_total", { { "market", market } },
+            ctx->event_queue.droppedCount());
+
+    out.family("coinbot_market_queue_coalesced_total", "counter", "Queued orderbook snapshots replaced by a newer one");
+    for (const auto& [market, ctx] : contexts_)
+        out.sample("coinbot_market_queue_coalesced_total", { { "market", market } },
+            ctx->event_queue.coalescedCount());
+
+    out.family("coinbot_worker_up", "gauge", "1 if the market worker loop is running");
+    for (const auto& [market, ctx] : contexts_)
+    {
+        const bool up = ctx->last_loop_ns.load(std::memory_order_relaxed) > 0 &&
+            !ctx->exited_abnormally.load(std::memory_order_acquire);
+        out.sample("coinbot_worker_up", { { "market", market } }, std::uint64_t{ up ? 1u : 0u });
+    }
+
+    out.family("coinbot_worker_last_loop_age_seconds", "gauge", "Seconds since the worker loop last iterated");
+    for (const auto& [market, ctx] : contexts_)
+    {
+        const auto last = ctx->last_loop_ns.load(std::memory_order_relaxed);
+        const double age = last > 0 ? static_cast<double>(now_ns - last) / 1e9 : -1.0;
+        out.sample("coinbot_worker_last_loop_age_seconds", { { "market", market } }, age);
+    }
+
+    out.family("coinbot_market_trades_total", "counter", "Trade stream ticks per market by aggregation result");
+    for (const auto& [market, ctx] : contexts_)
+    {
+        if (!ctx->ticks) continue;
+        const auto& ts = ctx->ticks->stats();
+        out.sample("coinbot_market_trades_total", { { "market", market }, { "result", "applied" } },
+            ts.applied.load(std::memory_order_relaxed));
+        out.sample("coinbot_market_trades_total", { { "market", market }, { "result", "duplicate" } },
+            ts.duplicates.load(std::memory_order_relaxed));
+        out.sample("coinbot_market_trades_total", { { "market", market }, { "result", "stale" } },
+            ts.stale.load(std::memory_order_relaxed));
+    }
+
+    // 북 내용(스프레드/깊이)은 워커 전용 → 메트릭은 카운터만, 값은 상태 버스로 발행
+    out.family("coinbot_market_orderbook_updates_total", "counter", "Orderbook snapshots per market by result");
+    for (const auto& [market, ctx] : contexts_)
+    {
+        if (!ctx->orderbook) continue;
+        const auto& os = ctx->orderbook->stats();
+        out.sample("coinbot_market_orderbook_updates_total", { { "market", market }, { "result", "applied" } },
+            os.updates.load(std::memory_order_relaxed));
+        out.sample("coinbot_market_orderbook_updates_total", { { "market", market }, { "result", "stale" } },
+            os.stale.load(std::memory_order_relaxed));
+        out.sample("coinbot_market_orderbook_updates_total", { { "market", market }, { "result", "crossed" } },
+            os.crossed.load(std::memory_order_relaxed));
+    }
+
+    out.family("coinbot_market_slippage_orders_total", "counter",
+        "Market orders with a pre-trade slippage estimate by outcome");
+    for (const auto& [market, ctx] : contexts_)
+    {
+        if (!ctx->orderbook) continue;
+        out.sample("coinbot_market_slippage_orders_total", { { "market", market }, { "result", "estimated" } },
+            ctx->slippage_estimated.load(std::memory_order_relaxed));
+        out.sample("coinbot_market_slippage_orders_total", { { "market", market }, { "result", "clipped" } },
+            ctx->slippage_clipped.load(std::memory_order_relaxed));
+        out.sample("coinbot_market_slippage_orders_total", { { "market", market }, { "result", "rejected" } },
+            ctx->slippage_rejected.load(std::memory_order_relaxed));
+    }
+
+    const auto& rs = recovery_.stats();
+    out.family("coinbot_recovery_batches_total", "counter", "Batched order queries issued by the recovery coordinator");
+    out.sample("coinbot_recovery_batches_total", {}, rs.batches.load(std::memory_order_relaxed));
+    out.family("coinbot_recovery_batch_errors_total", "counter", "Batched order queries that failed");
+    out.sample("coinbot_recovery_batch_errors_total", {}, rs.batch_errors.load(std::memory_order_relaxed));
+    out.family("coinbot_recovery_unresolved_total", "counter", "Pending orders left unresolved after all retries");
+    out.sample("coinbot_recovery_unresolved_total", {}, rs.unresolved.load(std::memory_order_relaxed));
+
+    out.family("coinbot_pipeline_latency_seconds", "summary", "Per-stage market pipeline latency");
+    for (const auto& [market, ctx] : contexts_)
+    {
+        for (std::size_t i = 0; i < kLatencyStageCount; ++i)
+        {
+            const auto stage = static_cast<LatencyStage>(i);
+            out.summary("coinbot_pipeline_latency_seconds",
+                { { "market", market }, { "stage", toString(stage) } },
+                ctx->latency.at(stage).snapshot());
+        }
+    }
 }
 
 // 계좌 동기화를 통한 AccountManager 구축
 // ========== rebuildAccountOnStartup_ ==========
-bool MarketEngineManager::rebuildAccountOnStartup_(bool throw_on_fail)
+std::optional<core::Account> MarketEngineManager::rebuildAccountOnStartup_(bool throw_on_fail)
 {
     auto& logger = util::Logger::instance();
 
@@ -216,10 +727,11 @@ bool MarketEngineManager::rebuildAccountOnStartup_(bool throw_on_fail)
 
         if (std::holds_alternative<core::Account>(result))
         {
-            account_mgr_.rebuildFromAccount(std::get<core::Account>(result));
+            auto& account = std::get<core::Account>(result);
+            account_mgr_.rebuildFromAccount(account);
 
             logger.info("[MarketEngineManager] Account synced (attempt ", attempt, ")");
-            return true;
+            return std::move(account);
         }
 
         const auto& err = std::get<api::rest::RestError>(result);
@@ -239,29 +751,74 @@ bool MarketEngineManager::rebuildAccountOnStartup_(bool throw_on_fail)
     }
 
     logger.warn("[MarketEngineManager] Account sync failed, continuing with stale data");
-    return false;
+    return std::nullopt;
 }
 
-// 각 마켓 컨텍스트의 전략 상태 복구: 미체결 주문 취소 + 내부 포지션 재구성
-// ========== recoverMarketState_ ==========
-void MarketEngineManager::recoverMarketState_(MarketContext& ctx)
+// ========== cancelStartupOrdersParallel_ ==========
+// 마켓별 StartupRecovery::cancelBotOpenOrders를 startup_parallelism개 스레드로 분배
+// - 마켓 간 의존 없음 (각자 자기 prefix 주문만 취소)
+// - 실제 동시 REST 수/요청 간격은 SharedOrderApi 게이트가 제한
+void MarketEngineManager::cancelStartupOrdersParallel_(
+    const std::vector<MarketContext*>& ctxs, std::vector<std::int64_t>& elapsed_ns)
 {
-    auto& logger = util::Logger::instance();
+    const std::size_t n = ctxs.size();
+    if (n == 0) return;
+
+    const std::size_t workers = std::clamp<std::size_t>(cfg_.startup_parallelism, 1, n);
+    std::atomic<std::size_t> next{ 0 };
+
+    const auto work = [&]
+    {
+        for (std::size_t i = next.fetch_add(1); i < n; i = next.fetch_add(1))
+        {
+            const auto start = util::monoNowNs();
+            cancelStartupOrders_(ctxs[i]->market);
+            elapsed_ns[i] = util::monoNowNs() - start;
+        }
+    };
+
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(workers - 1);
+        for (std::size_t w = 1; w < workers; ++w)
+            pool.emplace_back(work);
+        work();     // 현재 스레드도 한 몫 처리
+    }   // jthread 소멸 시 join
+}
 
-    // StartupRecovery 옵션: 봇 주문 prefix = "strategy_id:market:"
+// ========== cancelStartupOrders_ ==========
+// 봇이 낸 미체결 주문 취소 (StartupRecovery 1단계, 시작 스레드풀에서 호출)
+void MarketEngineManager::cancelStartupOrders_(const std::string& market)
+{
+    // StartupRecovery 옵션: 봇 주문 prefix = "strategy_id:market:" (마켓의 전략마다)
     StartupRecovery::Options opt;
-    opt.bot_identifier_prefix = std::string(ctx.strategy->id())
-        + ":" + ctx.market + ":";
+    opt.bot_identifier_prefixes = trading::strategies::MarketStrategies::identifierPrefixes(market);
 
     try
     {
-        StartupRecovery::run(api_, ctx.market, opt, *ctx.strategy);
-        logger.info("[MarketEngineManager] Recovery done for market=", ctx.market,
-            " state=", toStringState(ctx.strategy->state()));
+        StartupRecovery::cancelBotOpenOrders(api_, market, opt);
     }
     catch (const std::exception& e)
     {
         // 복구 실패 시 경고만 (기존 정책)
+        util::Logger::instance().warn("[MarketEngineManager] Startup cancel failed for market=",
+            market, ": ", e.what());
+    }
+}
+
+// ========== syncStrategyOnStart_ ==========
+// 공유 계좌 스냅샷으로 전략 포지션 복구 (StartupRecovery 2단계, REST 없음)
+void MarketEngineManager::syncStrategyOnStart_(MarketContext& ctx, const core::Account& account)
+{
+    auto& logger = util::Logger::instance();
+    try
+    {
+        ctx.strategies->syncOnStart(StartupRecovery::buildPositionSnapshot(account, ctx.market));
+        logger.info("[MarketEngineManager] Recovery done for market=", ctx.market,
+            " state=", toStringState(ctx.strategies->state()));
+    }
+    catch (const std::exception& e)
+    {
         logger.warn("[MarketEngineManager] Recovery failed for market=", ctx.market,
             ": ", e.what());
     }
@@ -299,8 +856,13 @@ void MarketEngineManager::workerLoop_(MarketContext& ctx, std::stop_token stoken
 
     logger.info("[MarketEngineManager][", ctx.market, "] Worker loop started");
 
+    const std::int64_t state_idle_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        util::AppConfig::instance().state_bus.idle_publish_interval).count();
+
     while (!stoken.stop_requested())
     {
+        ctx.last_loop_ns.store(util::monoNowNs(), std::memory_order_relaxed);
+
         try
         {
             // 복구 요청은 일반 이벤트보다 먼저 처리
@@ -321,6 +883,32 @@ void MarketEngineManager::workerLoop_(MarketContext& ctx, std::stop_token stoken
 
             // 3. Pending 상태 타임아웃 감시
             checkPendingTimeout_(ctx);
+
+            // 3-1. 런타임 제거 대기: 유휴 Flat이 되면 해제 가능 표시 (reapDrainedMarkets가 회수)
+            if (ctx.draining.load(std::memory_order_acquire))
+            {
+                if (!ctx.drained.load(std::memory_order_relaxed) && isIdleFlat_(ctx))
+                {
+                    ctx.drained.store(true, std::memory_order_release);
+                    logger.info("[MarketEngineManager][", ctx.market, "] Drained, ready for removal");
+                }
+            }
+            else if (ctx.drained.load(std::memory_order_relaxed))
+            {
+                ctx.drained.store(false, std::memory_order_relaxed);   // drain 취소됨
+            }
+
+            // 4. 라이브 상태 발행 (처리한 이벤트가 있거나 idle 주기 경과 시)
+            if (ctx.state_slot)
+            {
+                const auto now_ns = util::monoNowNs();
+                if (maybe.has_value() || !out.empty() ||
+                    now_ns - ctx.state_published_ns >= state_idle_ns)
+                {
+                    publishState_(ctx);
+                    ctx.state_published_ns = now_ns;
+                }
+            }
         }
         catch (const std::exception& e)
         {
@@ -339,6 +927,59 @@ void MarketEngineManager::workerLoop_(MarketContext& ctx, std::stop_token stoken
     logger.info("[MarketEngineManager][", ctx.market, "] Worker loop ended");
 }
 
+// ========== publishState_ ==========
+void MarketEngineManager::publishState_(MarketContext& ctx)
+{
+    statebus::MarketState s;
+
+    s.strategy_state = static_cast<std::uint32_t>(ctx.strategies->state());
+
+    if (ctx.pending_candle.has_value())
+    {
+        const core::Candle& c = *ctx.pending_candle;
+        s.flags |= statebus::kCandleValid;
+        s.candle_open = c.open_price;
+        s.candle_high = c.high_price;
+        s.candle_low = c.low_price;
+        s.candle_close = c.close_price;
+        s.candle_volume = c.volume;
+        c.start_timestamp.copy(s.candle_ts, sizeof(s.candle_ts) - 1);
+    }
+
+    const auto& snap = ctx.strategies->signalSnapshot();
+    if (snap.rsi.ready)        { s.flags |= statebus::kRsiReady;        s.rsi = snap.rsi.v; }
+    if (snap.volatility.ready) { s.flags |= statebus::kVolatilityReady; s.volatility = snap.volatility.v; }
+    if (snap.marketOk)         s.flags |= statebus::kMarketOk;
+    s.trend_strength = snap.trendStrength;
+
+    if (ctx.balances)
+    {
+        const auto b = ctx.balances->load();
+        s.available_krw = b.krw_available;
+        s.reserved_krw = b.reserved_krw;
+        s.coin_balance = b.coin_balance;
+        s.avg_entry_price = b.avg_entry_price;
+        s.initial_capital = b.initial_capital;
+        s.realized_pnl = b.realized_pnl;
+    }
+
+    if (ctx.orderbook && ctx.orderbook->valid())
+    {
+        using Side = marketdata::OrderBook::Side;
+        const auto& book = *ctx.orderbook;
+        s.flags |= statebus::kOrderbookValid;
+        s.best_bid = book.bestBid();
+        s.best_ask = book.bestAsk();
+        s.bid_depth_krw = book.depthNotional(Side::Bid);
+        s.ask_depth_krw = book.depthNotional(Side::Ask);
+    }
+
+    s.queue_depth = ctx.event_queue.approxSize();
+    s.queue_dropped = ctx.event_queue.droppedCount();
+
+    state_bus_->publish(*ctx.state_slot, s);
+}
+
 // ========== handleOne_ ==========
 void MarketEngineManager::handleOne_(MarketContext& ctx,
     const engine::input::EngineInput& in)
@@ -352,13 +993,21 @@ void MarketEngineManager::handleOne_(MarketContext& ctx,
         if constexpr (std::is_same_v<T, engine::input::MyOrderRaw>)
             handleMyOrder_(ctx, x);
         else if constexpr (std::is_same_v<T, engine::input::MarketDataRaw>)
+        {
+            // 제거 대기 중 유휴 Flat이면 시장 데이터 무시 → 신규 진입 없음
+            // (보유 중이면 청산 판단을 위해 계속 처리)
+            if (ctx.draining.load(std::memory_order_relaxed) && isIdleFlat_(ctx))
+                return;
             handleMarketData_(ctx, x);
+        }
         else if constexpr (std::is_same_v<T, engine::input::AccountSyncRequest>)
         {
             // 기본 경로는 atomic flag로 전환됨.
             // 큐에 남아있는 기존 이벤트 호환용으로 유지
             runRecovery_(ctx);
         }
+        else if constexpr (std::is_same_v<T, engine::input::RecoveredOrders>)
+            handleRecoveredOrders_(ctx, x);
 
     }, in);
 }
@@ -369,8 +1018,12 @@ void MarketEngineManager::handleMyOrder_(MarketContext& ctx,
 {
     auto& logger = util::Logger::instance();
 
+    recordIngress(ctx.latency, raw.recv_ns, raw.route_ns);
+
     // 0~2) JSON 파싱 + DTO 변환 + 도메인 이벤트 분해를 파사드에 위임
+    const auto parse_start = util::monoNowNs();
     const auto events = api::upbit::ws::parseMyOrder(raw.json, ctx.market);
+    ctx.latency.at(LatencyStage::Parse).recordSince(parse_start);
     if (events.empty()) return;
 
     // 3) MyTrade 존재 여부 사전 확인 (done-only(바로체결) 감지용)
@@ -391,9 +1044,11 @@ void MarketEngineManager::handleMyOrder_(MarketContext& ctx,
         {
             const auto& t = std::get<core::MyTrade>(ev);
             ctx.engine->onMyTrade(t);
+            ctx.latency.at(LatencyStage::MyOrderToTrade).recordSince(raw.recv_ns);
 
-            logger.info("[Manager][", ctx.market, "][TradeEvent] order_uuid=",
-                t.order_uuid, " price=", t.price, " vol=", t.volume);
+            COINBOT_LOG_INFO("[Manager][", ctx.market, "][TradeEvent]",
+                util::kv("order_uuid", t.order_uuid), util::kv("price", t.price),
+                util::kv("vol", t.volume));
         }
         else
         {
@@ -437,8 +1092,8 @@ void MarketEngineManager::handleMyOrder_(MarketContext& ctx,
             // - reconcile 실패 시 executed_funds 등이 불완전하므로 기록 보류
             if (db_ && isTerminal && reconcile_ok) db_->insertOrder(o);
 
-            logger.info("[Manager][", ctx.market, "][OrderEvent] status=",
-                static_cast<int>(o.status), " order_uuid=", o.id);
+            COINBOT_LOG_INFO("[Manager][", ctx.market, "][OrderEvent]",
+                util::kv("status", static_cast<int>(o.status)), util::kv("order_uuid", o.id));
         }
     }
 }
@@ -449,63 +1104,52 @@ void MarketEngineManager::handleMarketData_(MarketContext& ctx,
 {
     auto& logger = util::Logger::instance();
 
-    // 0~2) JSON 파싱 + 타입 확인 + DTO 변환 + 도메인 매핑을 파사드에 위임
-    const int configured_unit = util::AppConfig::instance().bot.live_candle_unit_minutes;
-    const auto result = api::upbit::ws::parseCandle(raw.json, configured_unit, ctx.market);
-    if (!result.has_value()) return;
-    const core::Candle incoming = result->candle;
-    const int live_unit = result->unit_minutes;
+    recordIngress(ctx.latency, raw.recv_ns, raw.route_ns);
 
-    // 동일 분봉 업데이트는 최신값으로 덮어쓰고,
-    // 다음 분봉이 도착하면 이전 분봉을 "확정 close"로 처리한다.
+    // 0~2) JSON 파싱 + 타입 확인 + DTO 변환 + 도메인 매핑을 파사드에 위임
+    const auto parse_start = util::monoNowNs();
 
-    // mark price를 항상 최신 intrabar close로 갱신하고,
-    // InPosition 상태에서 stop/target 도달 시 즉시 시장가 매도를 제출하는 헬퍼.
-    // submit 성공/실패 여부와 무관하게 mark price는 intrabar close로 유지된다.
-    auto doIntrabarCheck = [&](double intrabar_close)
+    // 체결 스트림 구독 시: trade 메시지는 DOM 파싱 없이 스캔 → 틱 집계 + 체결가 intrabar 체크
+    if (ctx.ticks)
     {
-        ctx.engine->setMarkPrice(intrabar_close);
-
-        // 같은 분봉 ts에서 이미 실패한 경우 다음 분봉까지 재시도하지 않는다.
-        // 새 분봉이 도착하면 ts가 달라지므로 자동으로 해제된다.
-        if (ctx.pending_candle.has_value() &&
-            ctx.intrabar_fail_ts.has_value() &&
-            ctx.pending_candle->start_timestamp == *ctx.intrabar_fail_ts)
+        if (const auto trade = api::upbit::ws::parseTrade(raw.json, ctx.market))
+        {
+            ctx.latency.at(LatencyStage::Parse).recordSince(parse_start);
+            handleTrade_(ctx, *trade);
             return;
+        }
+    }
 
-        if (ctx.strategy->state() !=
-            trading::strategies::RsiMeanReversionStrategy::State::InPosition)
+    // 호가 구독 시: orderbook 메시지도 같은 키 스캔 → L2 북 덮어쓰기
+    if (ctx.orderbook)
+    {
+        if (const auto ob = api::upbit::ws::parseOrderbook(raw.json, ctx.market))
+        {
+            ctx.latency.at(LatencyStage::Parse).recordSince(parse_start);
+            handleOrderbook_(ctx, *ob);
             return;
+        }
+    }
 
-        const trading::AccountSnapshot account = buildAccountSnapshot_(ctx.market);
-        const trading::Decision d =
-            ctx.strategy->onIntrabarCandle(intrabar_close, account);
-
-        if (!d.hasOrder()) return;
-
-        logger.info("[Manager][", ctx.market, "][IntrabarExit] close=",
-            intrabar_close, " reason=", d.order->client_tag);
+    const auto result = api::upbit::ws::parseCandle(raw.json, live_unit_, ctx.market);
+    ctx.latency.at(LatencyStage::Parse).recordSince(parse_start);
+    if (!result.has_value()) return;
+    const core::Candle incoming = result->candle;
+    const int live_unit = result->unit_minutes;
 
-        const auto r = ctx.engine->submit(*d.order);
-        logger.info("[Manager][", ctx.market, "][Submit] success=", r.success,
-            " code=", static_cast<int>(r.code));
+    // 상위 단위 봉 누적 (업데이트당 O(단위 수)), 완성 봉은 새 분봉이 도착한 경로 C에서만 나옴
+    ctx.resampled.clear();
+    if (ctx.resampler && live_unit == live_unit_)
+        (void)ctx.resampler->update(incoming, ctx.resampled);
 
-        if (!r.success)
-        {
-            logger.warn("[Manager][", ctx.market,
-                "][IntrabarExit] FAILED -> skip until next candle");
-            ctx.strategy->onSubmitFailed();
-            // 이 분봉 ts를 기록 → 같은 분봉에서 재시도 금지
-            if (ctx.pending_candle.has_value())
-                ctx.intrabar_fail_ts = ctx.pending_candle->start_timestamp;
-        }
-    };
+    // 동일 분봉 업데이트는 최신값으로 덮어쓰고,
+    // 다음 분봉이 도착하면 이전 분봉을 "확정 close"로 처리한다.
 
     // 경로 A: pending_candle이 비어 있는 첫 수신
     if (!ctx.pending_candle.has_value())
     {
         ctx.pending_candle = incoming;
-        doIntrabarCheck(static_cast<double>(incoming.close_price));
+        intrabarCheck_(ctx, static_cast<double>(incoming.close_price));
         return;
     }
 
@@ -513,7 +1157,7 @@ void MarketEngineManager::handleMarketData_(MarketContext& ctx,
     if (ctx.pending_candle->start_timestamp == incoming.start_timestamp)
     {
         ctx.pending_candle = incoming;
-        doIntrabarCheck(static_cast<double>(incoming.close_price));
+        intrabarCheck_(ctx, static_cast<double>(incoming.close_price));
         return;
     }
 
@@ -523,24 +1167,53 @@ void MarketEngineManager::handleMarketData_(MarketContext& ctx,
 	// db에 확정된 캔들 기록 (중복은 DB에서 무시)
     if (db_) db_->insertCandle(ctx.market, candle, live_unit);
 
-    logger.info("[Manager][", ctx.market, "][Candle] ts=",
-        candle.start_timestamp, " unit=", live_unit, " close=", candle.close_price);
+    COINBOT_LOG_INFO("[Manager][", ctx.market, "][Candle]",
+        util::kv("ts", candle.start_timestamp), util::kv("unit", live_unit),
+        util::kv("close", candle.close_price));
+
+    for (const auto& bar : ctx.resampled)
+    {
+        if (db_) db_->insertCandle(ctx.market, bar.candle, bar.unit_minutes);
+        COINBOT_LOG_DEBUG("[Manager][", ctx.market, "][Candle]",
+            util::kv("ts", bar.candle.start_timestamp), util::kv("unit", bar.unit_minutes),
+            util::kv("close", bar.candle.close_price));
+    }
 
     // 확정 캔들 close를 mark_price로 주입 (finalizeSellOrder dust 판정용)
     ctx.engine->setMarkPrice(candle.close_price);
 
+    // 전략 단위 봉: live 단위면 방금 확정된 봉, 상위 단위면 이번에 완성된 리샘플 봉 (없으면 전략 생략)
+    const core::Candle* strategy_candle = nullptr;
+    if (strategy_unit_ == live_unit)
+    {
+        strategy_candle = &candle;
+    }
+    else
+    {
+        for (const auto& bar : ctx.resampled)
+            if (bar.unit_minutes == strategy_unit_) strategy_candle = &bar.candle;
+    }
+    if (!strategy_candle)
+    {
+        intrabarCheck_(ctx, static_cast<double>(incoming.close_price));
+        return;
+    }
+
     // 3) AccountManager에서 예산 조회 → 전략용 스냅샷 빌드
-    const trading::AccountSnapshot account = buildAccountSnapshot_(ctx.market);
-    logger.info("[Manager][", ctx.market, "][Account] krw_available=",
-        account.krw_available, " coin_available=", account.coin_available);
+    const trading::AccountSnapshot account = buildAccountSnapshot_(ctx);
+    COINBOT_LOG_INFO("[Manager][", ctx.market, "][Account]",
+        util::kv("krw_available", account.krw_available),
+        util::kv("coin_available", account.coin_available));
 
     // 4) 전략 실행
-    const trading::Decision d = ctx.strategy->onCandle(candle, account);
-    const trading::Snapshot snap = ctx.strategy->signalSnapshot();
+    const auto strategy_start = util::monoNowNs();
+    const trading::Decision d = ctx.strategies->onCandle(*strategy_candle, account);
+    ctx.latency.at(LatencyStage::Strategy).recordSince(strategy_start);
+    const trading::Snapshot snap = ctx.strategies->signalSnapshot();
 
     // 전략 반영 여부 검증용 로그
-    logger.info("[Manager][", ctx.market, "][Strategy] state=",
-        toStringState(ctx.strategy->state()));
+    COINBOT_LOG_INFO("[Manager][", ctx.market, "][Strategy]",
+        util::kv("state", toStringState(ctx.strategies->state())));
     //logger.info("[Manager][", ctx.market, "][Signal] marketOk=", snap.marketOk,
     //    //" rsi=", snap.rsi.v,
     //    " rsi_ready=", snap.rsi.ready,
@@ -559,7 +1232,10 @@ void MarketEngineManager::handleMarketData_(MarketContext& ctx,
             " reason=", req.client_tag,
             " ", orderSizeToLog(req.size));
 
+        const auto submit_start = util::monoNowNs();
         const auto r = ctx.engine->submit(req);
+        ctx.latency.at(LatencyStage::SubmitRest).recordSince(submit_start);
+        recordSlippage_(ctx, req, r);
 
         logger.info("[Manager][", ctx.market, "][Submit] success=", r.success,
             " code=", static_cast<int>(r.code),
@@ -569,13 +1245,118 @@ void MarketEngineManager::handleMarketData_(MarketContext& ctx,
         {
             logger.warn("[Manager][", ctx.market,
                 "][Submit] FAILED -> rollback strategy pending");
-            ctx.strategy->onSubmitFailed();
+            ctx.strategies->onSubmitFailed();
         }
     }
 
     // 경로 C: 새 분봉의 첫 close도 intrabar 체크
-    // (onCandle이 이미 PendingExit로 전이했다면 doIntrabarCheck 내부 guard에서 noAction)
-    doIntrabarCheck(static_cast<double>(incoming.close_price));
+    // (onCandle이 이미 PendingExit로 전이했다면 intrabarCheck_ 내부 guard에서 noAction)
+    intrabarCheck_(ctx, static_cast<double>(incoming.close_price));
+}
+
+// ========== intrabarCheck_ ==========
+// mark price를 항상 최신 intrabar 가격(캔들 close 또는 체결가)으로 갱신하고,
+// InPosition 상태에서 stop/target 도달 시 즉시 시장가 매도를 제출한다.
+// submit 성공/실패 여부와 무관하게 mark price는 intrabar 가격으로 유지된다.
+void MarketEngineManager::intrabarCheck_(MarketContext& ctx, double intrabar_close)
+{
+    auto& logger = util::Logger::instance();
+
+    ctx.engine->setMarkPrice(intrabar_close);
+
+    // 같은 분봉 ts에서 이미 실패한 경우 다음 분봉까지 재시도하지 않는다.
+    // 새 분봉이 도착하면 ts가 달라지므로 자동으로 해제된다.
+    if (ctx.pending_candle.has_value() &&
+        ctx.intrabar_fail_ts.has_value() &&
+        ctx.pending_candle->start_timestamp == *ctx.intrabar_fail_ts)
+        return;
+
+    if (ctx.strategies->state() != trading::StrategyState::InPosition)
+        return;
+
+    const trading::AccountSnapshot account = buildAccountSnapshot_(ctx);
+    const trading::Decision d =
+        ctx.strategies->onIntrabarCandle(intrabar_close, account);
+
+    if (!d.hasOrder()) return;
+
+    logger.info("[Manager][", ctx.market, "][IntrabarExit] close=",
+        intrabar_close, " reason=", d.order->client_tag);
+
+    const auto submit_start = util::monoNowNs();
+    const auto r = ctx.engine->submit(*d.order);
+    ctx.latency.at(LatencyStage::SubmitRest).recordSince(submit_start);
+    recordSlippage_(ctx, *d.order, r);
+    logger.info("[Manager][", ctx.market, "][Submit] success=", r.success,
+        " code=", static_cast<int>(r.code));
+
+    if (!r.success)
+    {
+        logger.warn("[Manager][", ctx.market,
+            "][IntrabarExit] FAILED -> skip until next candle");
+        ctx.strategies->onSubmitFailed();
+        // 이 분봉 ts를 기록 → 같은 분봉에서 재시도 금지
+        if (ctx.pending_candle.has_value())
+            ctx.intrabar_fail_ts = ctx.pending_candle->start_timestamp;
+    }
+}
+
+// ========== handleTrade_ ==========
+// 체결 1건: 로컬 봉 집계 후 체결가로 intrabar 체크 (캔들 푸시보다 촘촘한 손절/익절 반응)
+void MarketEngineManager::handleTrade_(MarketContext& ctx, const api::upbit::ws::WsTrade& trade)
+{
+    using Result = marketdata::TickAggregator::Result;
+
+    const Result r = ctx.ticks->update(trade.price, trade.volume, trade.timestamp_ms, trade.sequential_id);
+    if (r == Result::Duplicate || r == Result::Stale) return;
+
+    if (r == Result::BarClosed)
+    {
+        const auto& bar = ctx.ticks->lastClosed();
+        COINBOT_LOG_DEBUG("[Manager][", ctx.market, "][TickBar]",
+            util::kv("start_ms", bar.start_ms), util::kv("close", bar.close),
+            util::kv("trades", bar.trades));
+    }
+
+    intrabarCheck_(ctx, trade.price);
+}
+
+// ========== recordSlippage_ ==========
+void MarketEngineManager::recordSlippage_(MarketContext& ctx, const core::OrderRequest& req,
+    const engine::EngineResult& r)
+{
+    if (!r.slippage.has_value()) return;
+
+    const auto& e = *r.slippage;
+    ctx.slippage_estimated.fetch_add(1, std::memory_order_relaxed);
+    if (r.clipped) ctx.slippage_clipped.fetch_add(1, std::memory_order_relaxed);
+    if (!r.success && r.code == engine::EngineErrorCode::OrderRejected)
+        ctx.slippage_rejected.fetch_add(1, std::memory_order_relaxed);
+
+    ctx.slippage_identifier = req.identifier;
+    ctx.slippage_estimate = e;
+
+    COINBOT_LOG_INFO("[Manager][", ctx.market, "][Slippage]",
+        util::kv("vwap", e.vwap), util::kv("touch", e.touch),
+        util::kv("slippage_bps", e.slippage_bps), util::kv("cost_bps", e.cost_bps),
+        util::kv("levels", e.levels_used), util::kv("exhausted", e.exhausted),
+        util::kv("clipped", r.clipped));
+}
+
+// ========== handleOrderbook_ ==========
+// 호가 스냅샷 1건: 마켓 북 배열에 그대로 덮어씀 (할당 없음)
+void MarketEngineManager::handleOrderbook_(MarketContext& ctx, const api::upbit::ws::WsOrderbook& ob)
+{
+    const bool applied = ctx.orderbook->update(ob.timestamp_ms, ob.total_ask_size, ob.total_bid_size,
+        std::span<const core::OrderbookLevel>(ob.units.data(), ob.levels));
+    if (!applied) return;
+
+    if (!ctx.orderbook->valid())
+    {
+        COINBOT_LOG_DEBUG("[Manager][", ctx.market, "][Orderbook] one-sided snapshot",
+            util::kv("bid_levels", ctx.orderbook->levels(marketdata::OrderBook::Side::Bid)),
+            util::kv("ask_levels", ctx.orderbook->levels(marketdata::OrderBook::Side::Ask)));
+    }
 }
 
 // ========== handleEngineEvents_ ==========
@@ -595,7 +1376,7 @@ void MarketEngineManager::handleEngineEvents_(MarketContext& ctx,
                 static_cast<double>(e.filled_volume)
             };
 
-            ctx.strategy->onFill(fill);
+            ctx.strategies->onFill(fill);
         }
         else if (std::holds_alternative<engine::EngineOrderStatusEvent>(ev))
         {
@@ -611,22 +1392,22 @@ void MarketEngineManager::handleEngineEvents_(MarketContext& ctx,
                 e.position_effect
             };
 
-            ctx.strategy->onOrderUpdate(out);
+            ctx.strategies->onOrderUpdate(out);
         }
     }
 }
 
 // ========== buildAccountSnapshot_ ==========
 trading::AccountSnapshot MarketEngineManager::buildAccountSnapshot_(
-    std::string_view market) const
+    const MarketContext& ctx)
 {
     trading::AccountSnapshot snap{};
 
-    auto budget = account_mgr_.getBudget(market);
-    if (budget.has_value())
+    if (ctx.balances)
     {
-        snap.krw_available = budget->available_krw;
-        snap.coin_available = budget->coin_balance;
+        const auto b = ctx.balances->load();
+        snap.krw_available = b.krw_available;
+        snap.coin_available = b.coin_balance;
     }
 
     return snap;
@@ -635,6 +1416,7 @@ trading::AccountSnapshot MarketEngineManager::buildAccountSnapshot_(
 // ========== hasFatalWorker ==========
 bool MarketEngineManager::hasFatalWorker() const
 {
+    std::shared_lock lock(contexts_mtx_);
     for (const auto& [market, ctx] : contexts_)
         if (ctx->exited_abnormally.load(std::memory_order_acquire))
             return true;
@@ -649,6 +1431,7 @@ void MarketEngineManager::requestReconnectRecovery()
 {
     int triggered = 0;
 
+    std::shared_lock lock(contexts_mtx_);
     for (auto& [market, ctx] : contexts_)
     {
         if (!ctx->has_active_pending.load(std::memory_order_acquire))
@@ -665,14 +1448,13 @@ void MarketEngineManager::requestReconnectRecovery()
     // triggered == 0: 정상 구간 — 로그 생략
 }
 
-// 주문 단건 조회 기반 복구
+// pending 주문 복구 제출
 // 런타임에서 rebuildFromAccount 호출 금지 — 타 마켓 KRW 재분배 없음
 // 복구 흐름:
 //   1. pending 주문 ID 확보 → 없으면 즉시 종료
-//   2. getOrder(order_uuid) 1차 → getOpenOrders 2차 fallback
-//   3. reconcileFromSnapshot으로 delta 정산
-//   4. 터미널 + 정산 성공이면 로그 기록 (상태 정리는 onOrderSnapshot 내부에서 완료됨)
-//      정산 실패면 pending 유지(다음 recovery에서 재시도)
+//   2. RecoveryCoordinator에 제출 (즉시 반환, 워커 블로킹 없음)
+//      → 코디네이터가 전 마켓 요청을 모아 GET /v1/orders/uuids 일괄 조회 + 백오프 재시도
+//   3. 결과는 이 마켓 큐의 RecoveredOrders로 도착 → handleRecoveredOrders_에서 정산
 void MarketEngineManager::runRecovery_(MarketContext& ctx)
 {
     // 1) pending 주문 ID 확보 (pre-filter 이후 안전망 — 레이스 컨디션 방어)
@@ -681,50 +1463,60 @@ void MarketEngineManager::runRecovery_(MarketContext& ctx)
     {
         ctx.tracking_pending = false;
         ctx.pending_timeout_fired = false;
+        ctx.recovery_in_flight = false;
         return;
     }
 
-    auto& logger = util::Logger::instance();
-    logger.info("[MarketEngineManager][", ctx.market, "] Running recovery...");
+    // 이미 제출한 요청의 결과 대기 중이면 병합 (결과 유실 대비 만료 시 재제출)
+    const auto now = std::chrono::steady_clock::now();
+    if (ctx.recovery_in_flight && now - ctx.recovery_submitted_at < kRecoveryResultTimeout)
+        return;
 
-    // 2) 각 pending 주문에 대해 복구 시도
+    // 2) 코디네이터에 제출
+    std::vector<std::string> order_uuids;
     for (const auto& order_uuid : { buy_order_uuid, sell_order_uuid })
     {
-        if (order_uuid.empty()) continue;
+        if (!order_uuid.empty())
+            order_uuids.push_back(order_uuid);
+    }
+    recovery_.submit(ctx.market, order_uuids);
+
+    ctx.recovery_in_flight = true;
+    ctx.recovery_submitted_at = now;
 
-        // getOrder(order_uuid) 직접 조회 (최대 3회 재시도, 500ms 간격)
-        std::optional<core::Order> order = queryOrderWithRetry_(order_uuid, 3);
+    util::Logger::instance().info("[MarketEngineManager][", ctx.market,
+        "] Recovery submitted: buy=", buy_order_uuid, " sell=", sell_order_uuid);
+}
+
+// 코디네이터 조회 결과 반영 (worker thread)
+//   1. 제출 이후 WS로 이미 확정된 주문은 건너뜀 (지난 스냅샷으로 재정산 방지)
+//   2. reconcileFromSnapshot으로 delta 정산
+//   3. 터미널 + 정산 성공이면 DB 기록 (상태 정리는 onOrderSnapshot 내부에서 완료됨)
+//      정산 실패/조회 실패면 pending 유지(다음 recovery에서 재시도)
+void MarketEngineManager::handleRecoveredOrders_(MarketContext& ctx,
+    const engine::input::RecoveredOrders& rec)
+{
+    auto& logger = util::Logger::instance();
+    ctx.recovery_in_flight = false;
+
+    const auto [buy_order_uuid, sell_order_uuid] = ctx.engine->activePendingIds();
 
-        // 조회 실패 → 상태 유지, 다음 recovery 주기에서 재시도
-        // 오정산보다 미정산이 안전 — KRW/예약 불변식 보호
-        if (!order.has_value())
+    for (const auto& order : rec.orders)
+    {
+        if (order.id.empty() || (order.id != buy_order_uuid && order.id != sell_order_uuid))
         {
-            // 진단용 계좌 로그 (상태 변경 없음)
-            auto diag = api_.getMyAccount();
-            if (std::holds_alternative<core::Account>(diag))
-            {
-                const auto& acct = std::get<core::Account>(diag);
-                logger.warn("[MarketEngineManager][", ctx.market,
-                    "] Recovery fallback: order query failed, "
-                    "actual_krw=", acct.krw_free,
-                    " positions=", acct.positions.size(),
-                    " keeping pending state for order=", order_uuid);
-            }
-            else
-            {
-                logger.warn("[MarketEngineManager][", ctx.market,
-                    "] All recovery methods failed for order=", order_uuid);
-            }
+            logger.info("[MarketEngineManager][", ctx.market,
+                "] Recovered order no longer pending, skip, order=", order.id);
             continue;
         }
 
         // delta 정산 (MarketEngine 단일 경로)
-        const bool reconciled = ctx.engine->reconcileFromSnapshot(*order);
+        const bool reconciled = ctx.engine->reconcileFromSnapshot(order);
 
         const bool isTerminal =
-            order->status == core::OrderStatus::Filled ||
-            order->status == core::OrderStatus::Canceled ||
-            order->status == core::OrderStatus::Rejected;
+            order.status == core::OrderStatus::Filled ||
+            order.status == core::OrderStatus::Canceled ||
+            order.status == core::OrderStatus::Rejected;
 
         if (isTerminal)
         {
@@ -732,7 +1524,7 @@ void MarketEngineManager::runRecovery_(MarketContext& ctx)
             {
                 // 금액 미확정 주문은 상태를 닫지 않고 다음 recovery에서 재시도한다.
                 logger.warn("[MarketEngineManager][", ctx.market,
-                    "] Terminal order unresolved, keeping pending state, order=", order_uuid);
+                    "] Terminal order unresolved, keeping pending state, order=", order.id);
                 continue;
             }
 
@@ -741,10 +1533,10 @@ void MarketEngineManager::runRecovery_(MarketContext& ctx)
             // - syncOnStart: EngineOrderStatusEvent.executed_funds → onOrderUpdate 폴백으로 대체됨
 
             // WS 유실로 handleMyOrder_를 거치지 않은 주문의 최종 상태를 DB에 반영
-            if (db_) db_->insertOrder(*order);
+            if (db_) db_->insertOrder(order);
 
             logger.info("[MarketEngineManager][", ctx.market,
-                "] Recovery done: state=", toStringState(ctx.strategy->state()));
+                "] Recovery done: state=", toStringState(ctx.strategies->state()));
         }
         else
         {
@@ -753,39 +1545,26 @@ void MarketEngineManager::runRecovery_(MarketContext& ctx)
                 // open: 부분 체결분은 reconcileFromSnapshot에서 이미 delta 정산됨
                 logger.info("[MarketEngineManager][", ctx.market,
                     "] Order still open (partial fill reconciled), "
-                    "waiting for WS events, order=", order_uuid);
+                    "waiting for WS events, order=", order.id);
             }
             else
             {
                 logger.warn("[MarketEngineManager][", ctx.market,
-                    "] Open order unresolved, keeping pending state, order=", order_uuid);
+                    "] Open order unresolved, keeping pending state, order=", order.id);
             }
         }
     }
 
-    ctx.tracking_pending = false;
-    ctx.pending_timeout_fired = false;
-}
-
-// getOrder 재시도 (500ms 간격)
-// 불완전 스냅샷(executed_volume > 0 && executed_funds == 0)은 reconcileFromSnapshot에 위임
-std::optional<core::Order> MarketEngineManager::queryOrderWithRetry_(
-    std::string_view order_uuid, int max_retries)
-{
-    auto& logger = util::Logger::instance();
-    for (int i = 1; i <= max_retries; ++i)
+    // 조회 실패 → 상태 유지, 다음 recovery 주기에서 재시도
+    // 오정산보다 미정산이 안전 — KRW/예약 불변식 보호
+    for (const auto& order_uuid : rec.unresolved)
     {
-        auto result = api_.getOrder(order_uuid);
-        if (std::holds_alternative<core::Order>(result))
-            return std::get<core::Order>(result);
-
-        const auto& err = std::get<api::rest::RestError>(result);
-        logger.warn("[MarketEngineManager] getOrder failed (attempt ",
-            i, "/", max_retries, "): ", err.message);
-        if (i < max_retries)
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        logger.warn("[MarketEngineManager][", ctx.market,
+            "] All recovery methods failed, keeping pending state for order=", order_uuid);
     }
-    return std::nullopt;
+
+    ctx.tracking_pending = false;
+    ctx.pending_timeout_fired = false;
 }
 
 // ========== checkPendingTimeout_ ==========
@@ -6,28 +6,43 @@
 // - MarketEngine + AccountManager 기반으로 동작
 //
 // 생명주기: 생성자(동기화+복구) → registerWith(EventRouter) → start() → stop()
+// 런타임 마켓 변경: addMarket() / removeMarket() → reapDrainedMarkets() (제어 스레드)
 #pragma once
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <thread>       // std::jthread, std::stop_token (C++20)
 #include <unordered_map>
 #include <vector>
 
+#include "app/PipelineLatency.h"
+#include "app/RecoveryCoordinator.h"
 #include "core/BlockingQueue.h"
 #include "engine/input/EngineInput.h"
 #include "engine/MarketEngine.h"
 #include "engine/OrderStore.h"
 #include "engine/EngineEvents.h"
+#include "marketdata/CandleResampler.h"
+#include "marketdata/OrderBook.h"
+#include "marketdata/PriceSeries.h"
+#include "marketdata/SlippageEstimator.h"
+#include "marketdata/TickAggregator.h"
 #include "api/upbit/IOrderApi.h"
 #include "trading/allocation/AccountManager.h"
-#include "trading/strategies/RsiMeanReversionStrategy.h"
+#include "trading/strategies/StrategyRegistry.h"
 #include "trading/strategies/StrategyTypes.h"
 #include "database/Database.h"
+#include "statebus/StateBusWriter.h"
+
+namespace util { class PrometheusText; }
+namespace api::upbit::ws { struct WsTrade; struct WsOrderbook; }
 
 namespace app {
 
@@ -36,10 +51,14 @@ class EventRouter;  // 전방 선언
 // GCC/Clang에서 중첩 struct의 default member initializer를
 // 외부 클래스 생성자 기본 인자로 사용 불가 → 네임스페이스 레벨로 분리
 struct MarketManagerConfig {
-    trading::strategies::RsiMeanReversionStrategy::Params strategy_params;
-    std::size_t queue_capacity = 5000;      // 마켓별 큐 최대 크기 (drop-oldest)
+    trading::strategies::MarketStrategies::Params strategy_params;   // 전략별 Params (등록 순서)
+    std::size_t queue_capacity = 5000;      // 마켓별 시장 데이터 큐 최대 크기 (drop-oldest, myOrder/복구 결과는 우선 레인이라 제외)
     int sync_retry = 3;                     // 초기 계좌 동기화 재시도 횟수
     std::chrono::seconds pending_timeout{120}; // Pending 상태 타임아웃 (2분)
+    std::size_t startup_parallelism = 4;    // 시작 시 마켓별 미체결 취소 동시 실행 수 (SharedOrderApi max_in_flight와 맞출 것)
+    RecoveryCoordinatorConfig recovery;     // pending 주문 일괄 조회/재시도 설정
+    bool trade_stream = false;              // 체결 스트림 수신 → 마켓별 틱 집계 + 체결가 intrabar 체크
+    bool orderbook = false;                 // 호가 스트림 수신 → 마켓별 L2 북 유지
 };
 
 class MarketEngineManager final {
@@ -47,6 +66,12 @@ public:
     using PrivateQueue = core::BlockingQueue<engine::input::EngineInput>;
     using MarketManagerConfig = app::MarketManagerConfig;  // 하위 호환 alias
 
+    // 런타임 추가 마켓 warm-start용 과거 봉 조회 (오래된 순 확정 봉, 실패 시 빈 vector)
+    using CandleHistorySource = std::function<std::vector<core::Candle>(const std::string& market)>;
+
+    // 운용 마켓 구성 변경 알림 (변경 후 전체 마켓 목록, WS 재구독용)
+    using MarketSetListener = std::function<void(const std::vector<std::string>& markets)>;
+
     // 생성자: 계좌 동기화 + 마켓별 컨텍스트 생성 + 전략 복구
     // @param api: SharedOrderApi (thread-safe)
     // @param store: 공유 OrderStore
@@ -71,6 +96,10 @@ public:
     // EventRouter에 마켓별 큐 등록 (start() 전에 호출)
     void registerWith(EventRouter& router);
 
+    // 라이브 상태 버스에 마켓별 슬롯 등록 (start() 전에 호출, bus는 manager보다 오래 살아야 함)
+    // 워커가 이벤트 처리 후(또는 idle 주기마다) 전략/캔들/지표/잔고/큐 상태를 발행
+    void attachStateBus(statebus::StateBusWriter& bus);
+
     // 마켓별 워커 스레드 시작
     // 선행 조건: registerWith()가 먼저 호출되어야 함
     //   → 미등록 시 이벤트가 큐에 전달되지 않아 전략이 동작하지 않음
@@ -79,6 +108,35 @@ public:
     // 모든 워커 스레드 정지 + join
     void stop();
 
+    // 런타임 마켓 추가용 훅 (start() 전에 등록)
+    void setCandleHistorySource(CandleHistorySource fn) { history_source_ = std::move(fn); }
+    void setMarketSetListener(MarketSetListener fn) { market_set_listener_ = std::move(fn); }
+
+    // 런타임 마켓 추가 (제어 스레드, REST 호출로 수백 ms 블로킹)
+    // 흐름: 봇 미체결 취소 → 계좌 1회 조회 → 예산 slot 배분(유휴 마켓에서 이전) → 엔진/전략 생성
+    //       → 포지션 복구 → 과거 봉 warm-start → 상태 버스 슬롯 → 라우팅 등록 → 워커 시작 → 구성 변경 알림
+    // 제거 대기(drain) 중인 마켓이면 제거를 취소
+    // @return 이미 운용 중/registerWith 이전/계좌 조회 실패/예산 slot 부족이면 false
+    bool addMarket(const std::string& market);
+
+    // 런타임 마켓 제거 요청 (즉시 반환)
+    // 신규 진입을 막고(drain) 보유 포지션은 전략의 정상 청산(손절/익절/RSI)을 기다림
+    // Flat + pending/예약 없음이 되면 reapDrainedMarkets()가 실제 해제
+    // @return 운용 중이 아닌 마켓이면 false
+    bool removeMarket(const std::string& market);
+
+    // drain 완료 마켓 해제 (제어 스레드에서 주기 호출)
+    // 예산 반환 → 라우팅 해제(grace period) → 워커 join → 컨텍스트 파기 → 구성 변경 알림
+    // 예산 반환이 거절되면(예약/코인 보유) 컨텍스트·라우팅을 유지하고 drain 판정부터 다시 기다림
+    // @return 해제한 마켓 수
+    std::size_t reapDrainedMarkets();
+
+    // 현재 운용 중인 마켓 목록 (drain 중 포함, 정렬 순)
+    std::vector<std::string> markets() const;
+
+    // 전략이 소비하는 분봉 단위 (live 단위 또는 리샘플 단위, warm-start 조회 단위)
+    int strategyCandleUnit() const noexcept { return strategy_unit_; }
+
     // WS 재연결 시 복구 요청 (WS 스레드에서 호출 가능)
     // atomic flag로 우선 처리 — 일반 큐 drop-oldest 영향 없음
     void requestReconnectRecovery();
@@ -86,13 +144,26 @@ public:
     // 비정상 종료된 워커 스레드가 있으면 true (HealthCheck용)
     bool hasFatalWorker() const;
 
+    // 마켓별/전체 단계 지연 p50/p99/p999/max 로그 출력 (어느 스레드에서나 호출 가능)
+    void logLatencyReport() const;
+
+    // 마켓별 큐 깊이/drop, 워커 생존, 단계 지연을 Prometheus 텍스트로 출력
+    // atomic 읽기만 수행 → 워커/큐 락과 경합 없음 (메트릭 서버 스레드에서 호출)
+    void writeMetrics(util::PrometheusText& out) const;
+
 private:
     // 마켓별 독립 컨텍스트 (스레드 + 엔진 + 전략 + 큐)
     struct MarketContext {
         std::string market;
 
         std::unique_ptr<engine::MarketEngine> engine;
-        std::unique_ptr<trading::strategies::RsiMeanReversionStrategy> strategy;
+
+        // 확정 봉 시계열 (전략 지표가 공유 조회, 전략이 참조하므로 strategies보다 먼저 선언 → 나중에 해제)
+        std::unique_ptr<marketdata::PriceSeries> series;
+        // 이 마켓의 전략 묶음 (정적 디스패치 + 마켓당 주문 1개 중재)
+        std::unique_ptr<trading::strategies::MarketStrategies> strategies;
+        // 시장 데이터: drop-oldest (orderbook은 최신 스냅샷 1개로 합침)
+        // myOrder/복구 결과: 우선 레인 (drop 없음, 먼저 처리)
         PrivateQueue event_queue;
 
         std::jthread worker;    // stop_token 내장 (stop_flag 불필요)
@@ -101,6 +172,25 @@ private:
         // 다음 분봉이 들어오면 이전 분봉(최종 close)을 확정 처리한다.
         std::optional<core::Candle> pending_candle;
 
+        // live 분봉 → 상위 단위 봉 (worker thread 전용, 상위 단위가 없으면 nullptr)
+        std::unique_ptr<marketdata::CandleResampler> resampler;
+        std::vector<marketdata::ResampledBar> resampled;    // 이번 입력으로 완성된 상위 봉 (재사용 버퍼)
+
+        // 체결 스트림 → live 단위 로컬 봉 (worker thread 전용, 체결 구독이 꺼져 있으면 nullptr)
+        std::unique_ptr<marketdata::TickAggregator> ticks;
+
+        // 호가 스트림 → L2 북 (worker thread 전용, 호가 구독이 꺼져 있으면 nullptr)
+        std::unique_ptr<marketdata::OrderBook> orderbook;
+
+        // 마지막 시장가 submit의 사전 슬리피지 추정 (worker thread 전용, 신호 기록 시 identifier로 매칭)
+        std::string slippage_identifier;
+        marketdata::SlippageEstimate slippage_estimate{};
+
+        // 슬리피지 예산 적용 결과 (worker thread만 기록, 메트릭은 읽기만)
+        std::atomic<std::uint64_t> slippage_estimated{0};
+        std::atomic<std::uint64_t> slippage_clipped{0};
+        std::atomic<std::uint64_t> slippage_rejected{0};
+
         // intrabar 청산 submit 실패 시 기록되는 캔들 ts.
         // 동일 ts의 추가 업데이트에서 재시도를 막고, 다음 분봉에서만 재시도한다.
         std::optional<std::string> intrabar_fail_ts{};
@@ -114,6 +204,11 @@ private:
         // atomic flag로 큐 drop-oldest와 무관하게 우선 처리
         std::atomic<bool> recovery_requested{false};
 
+        // 복구 코디네이터에 제출 후 RecoveredOrders 대기 중 (worker thread 전용)
+        // 결과가 오지 않는 경우(전달 시점에 컨텍스트 없음 등)에 대비해 제출 시각 기준으로 만료시킴
+        bool recovery_in_flight{false};
+        std::chrono::steady_clock::time_point recovery_submitted_at{};
+
         // requestReconnectRecovery 필터링용
         // worker thread(checkPendingTimeout_)에서만 쓰기, WS IO thread에서 읽기
         std::atomic<bool> has_active_pending{false};
@@ -121,6 +216,25 @@ private:
         // stop 요청 없이 workerLoop_를 탈출하면 비정상 종료로 판정
         std::atomic<bool> exited_abnormally{false};
 
+        // 런타임 제거 요청 (제어 스레드 쓰기, 워커 읽기): 유휴 Flat이면 시장 데이터 무시 → 신규 진입 없음
+        std::atomic<bool> draining{false};
+
+        // drain 완료 (워커가 유휴 Flat 확인 후 기록 → reapDrainedMarkets가 해제)
+        std::atomic<bool> drained{false};
+
+        // 단계별 지연 히스토그램 (worker thread만 기록, 리포트는 읽기만)
+        PipelineLatency latency;
+
+        // 워커 루프 마지막 반복 시각 (util::monoNowNs, 생존 감시용)
+        std::atomic<std::int64_t> last_loop_ns{0};
+
+        // AccountManager가 seqlock으로 발행하는 이 마켓 잔고 (생성 시 1회 캐시)
+        const trading::allocation::PublishedBalances* balances{nullptr};
+
+        // 라이브 상태 버스 슬롯 (attachStateBus 이후 worker thread만 발행)
+        statebus::MarketSlot* state_slot{nullptr};
+        std::int64_t state_published_ns{0};
+
         explicit MarketContext(std::string m, std::size_t queue_capacity)
             : market(std::move(m))
             , event_queue(queue_capacity)
@@ -128,11 +242,30 @@ private:
     };
 
     // 시작 시점에만 사용: 거래소 계좌 조회 → AccountManager 전체 재구축
+    // 성공 시 조회한 Account 반환 (마켓별 포지션 스냅샷에 재사용)
     // 런타임 복구 경로에서는 호출 금지
-    bool rebuildAccountOnStartup_(bool throw_on_fail);
+    std::optional<core::Account> rebuildAccountOnStartup_(bool throw_on_fail);
+
+    // 컨텍스트 생성 (엔진/전략/신호 콜백, REST 없음)
+    // 선행 조건: account_mgr_에 마켓 slot이 있어야 함 (엔진이 발행 잔고 포인터를 캐시)
+    std::unique_ptr<MarketContext> makeContext_(const std::string& market);
+
+    // 워커 스레드 생성 (contexts_에 등록된 ctx)
+    void startWorker_(MarketContext& ctx);
 
-    // 생성자에서 호출: StartupRecovery로 시작 시점에 마켓 상태 복구
-    void recoverMarketState_(MarketContext& ctx);
+    // Flat + pending/예약 없음 + 유효 코인 없음 (worker thread, drain 판정용)
+    static bool isIdleFlat_(const MarketContext& ctx);
+
+    // 구성 변경 알림 (membership_mtx_ 보유 상태에서 호출)
+    void notifyMarketSet_();
+
+    // 생성자에서 호출: StartupRecovery 단계별 실행
+    // - 미체결 취소는 마켓별 병렬 (elapsed_ns[i] = ctxs[i] 소요 시간)
+    // - 포지션 복구는 1회 조회한 Account 공유
+    void cancelStartupOrdersParallel_(const std::vector<MarketContext*>& ctxs,
+                                      std::vector<std::int64_t>& elapsed_ns);
+    void cancelStartupOrders_(const std::string& market);
+    void syncStrategyOnStart_(MarketContext& ctx, const core::Account& account);
 
     // 워커 스레드(각 마켓 스레드) 메인 루프 
     void workerLoop_(MarketContext& ctx, std::stop_token stoken);
@@ -141,33 +274,62 @@ private:
     void handleOne_(MarketContext& ctx, const engine::input::EngineInput& in);
     void handleMyOrder_(MarketContext& ctx, const engine::input::MyOrderRaw& raw);
     void handleMarketData_(MarketContext& ctx, const engine::input::MarketDataRaw& raw);
+    void handleTrade_(MarketContext& ctx, const api::upbit::ws::WsTrade& trade);
+    void handleOrderbook_(MarketContext& ctx, const api::upbit::ws::WsOrderbook& ob);
+
+    // submit 결과의 슬리피지 추정 기록 (로그 + 신호 매칭용 보관 + 카운터)
+    void recordSlippage_(MarketContext& ctx, const core::OrderRequest& req, const engine::EngineResult& r);
+
+    // intrabar 가격(캔들 close/체결가)으로 mark price 갱신 + InPosition이면 stop/target 청산 판단
+    void intrabarCheck_(MarketContext& ctx, double intrabar_close);
     // 엔진 출력을 전략으로 전달
     void handleEngineEvents_(MarketContext& ctx, const std::vector<engine::EngineEvent>& evs);
 
-    // 재연결/타임아웃 복구: 주문 단건 조회 기반
+    // 재연결/타임아웃 복구: pending 주문 ID를 RecoveryCoordinator에 제출 (즉시 반환)
     // 런타임에서 rebuildFromAccount 호출 금지 — 타 마켓 KRW 재분배 없음
     void runRecovery_(MarketContext& ctx);
 
-    // 복구 헬퍼: getOrder 재시도
-    std::optional<core::Order> queryOrderWithRetry_(
-        std::string_view order_uuid, int max_retries);
+    // 코디네이터가 큐로 돌려준 조회 결과를 엔진에 delta 정산
+    void handleRecoveredOrders_(MarketContext& ctx, const engine::input::RecoveredOrders& rec);
 
     // Pending 상태 타임아웃 감시 (workerLoop_ 내에서 매 반복마다 호출)
     void checkPendingTimeout_(MarketContext& ctx);
 
-    // AccountManager에서 마켓별 예산 조회 → 전략용 AccountSnapshot 변환
-    trading::AccountSnapshot buildAccountSnapshot_(std::string_view market) const;
+    // 상태 버스 슬롯 발행 (worker thread, 할당 없음)
+    void publishState_(MarketContext& ctx);
+
+    // AccountManager 발행 잔고(seqlock, 락/할당 없음) → 전략용 AccountSnapshot 변환
+    static trading::AccountSnapshot buildAccountSnapshot_(const MarketContext& ctx);
 
     // 공유 자원 참조
 	api::upbit::IOrderApi& api_;    // 외부 거래소 API
 	engine::OrderStore& store_;     // 마켓들이 공유하는 주문 저장소
 	trading::allocation::AccountManager& account_mgr_; // 공유 계좌 관리자
     db::Database* db_{ nullptr };   // SQLite DB (없으면 기록 생략)
+    statebus::StateBusWriter* state_bus_{ nullptr };   // 라이브 상태 버스 (없으면 발행 생략)
+    EventRouter* router_{ nullptr };                    // registerWith에서 기록 (런타임 추가/제거용)
+
+    CandleHistorySource history_source_;
+    MarketSetListener market_set_listener_;
 
     MarketManagerConfig cfg_;
 
-    // 마켓별 컨텍스트 (생성자 이후 불변, 읽기 전용)
+    // 봇 설정에서 1회 결정 (strategy_candle_unit_minutes가 live에서 만들 수 없는 단위면 live로 대체)
+    int live_unit_{0};
+    int strategy_unit_{0};
+    std::vector<int> resample_units_;   // 리샘플러 생성 단위 (strategy_unit_ 포함)
+
+    // 마켓별 컨텍스트
+    // 삽입/삭제(addMarket/reapDrainedMarkets)만 배타 락, 순회/조회(메트릭·복구·헬스체크)는 공유 락
+    // 워커 스레드는 자기 ctx만 참조하므로 락 없음
     std::unordered_map<std::string, std::unique_ptr<MarketContext>> contexts_;
+    mutable std::shared_mutex contexts_mtx_;
+
+    // start/stop/addMarket/removeMarket/reapDrainedMarkets 직렬화
+    std::mutex membership_mtx_;
+
+    // 마켓 공용 pending 주문 복구 (contexts_보다 먼저 소멸 → 전달 콜백이 댕글링되지 않음)
+    RecoveryCoordinator recovery_;
 
     // 전체 시작 여부 (재진입 방지 플래그)
     bool started_{false};
@@ -0,0 +1,262 @@
+// app/MarketScanner.cpp
+#include "app/MarketScanner.h"
+
+#include <algorithm>
+#include <exception>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include "util/Logger.h"
+
+namespace app {
+
+namespace {
+
+// 후보 idx를 값 오름차순으로 정렬했을 때의 순위 → [0, 1] 백분위 (후보 1개면 1)
+void percentiles(const std::vector<double>& values, const std::vector<std::size_t>& idx,
+                 std::vector<double>& out)
+{
+    std::vector<std::size_t> order(idx);
+    std::sort(order.begin(), order.end(),
+        [&](std::size_t a, std::size_t b) { return values[a] < values[b]; });
+
+    const double denom = order.size() > 1 ? static_cast<double>(order.size() - 1) : 1.0;
+    for (std::size_t r = 0; r < order.size(); ++r)
+        out[order[r]] = order.size() > 1 ? static_cast<double>(r) / denom : 1.0;
+}
+
+} // anonymous namespace
+
+MarketScanner::MarketScanner(const api::upbit::UpbitPublicRestClient& api, Config cfg)
+    : api_(api)
+    , cfg_(std::move(cfg))
+{
+    cfg_.batch_size = std::clamp<std::size_t>(cfg_.batch_size, 1, 100);    // /v1/ticker 1회 최대
+    cfg_.top_n = std::max<std::size_t>(1, cfg_.top_n);
+    cfg_.retain_rank = std::max(cfg_.retain_rank, cfg_.top_n);
+    cfg_.volatility_weight = std::clamp(cfg_.volatility_weight, 0.0, 1.0);
+}
+
+MarketScanner::~MarketScanner()
+{
+    stop();
+}
+
+void MarketScanner::seed(std::vector<std::string> markets)
+{
+    std::lock_guard lock(mtx_);
+    selected_ = std::move(markets);
+}
+
+void MarketScanner::start()
+{
+    if (thread_.joinable()) return;
+    thread_ = std::jthread([this](std::stop_token stoken) { run_(stoken); });
+}
+
+void MarketScanner::stop()
+{
+    if (!thread_.joinable()) return;
+    thread_.request_stop();     // condition_variable_any 대기도 stop_token으로 깨어남
+    thread_.join();
+}
+
+MarketScanner::Selection MarketScanner::selection() const
+{
+    std::lock_guard lock(mtx_);
+    return Selection{ version_.load(std::memory_order_relaxed), selected_ };
+}
+
+// ========== run_ ==========
+// interval마다: (필요 시 유니버스 갱신) → 시세 일괄 조회 → 순위 → 선택이 바뀌면 version 증가
+void MarketScanner::run_(std::stop_token stoken)
+{
+    auto& logger = util::Logger::instance();
+    logger.info("[MarketScanner] Started: top_n=", cfg_.top_n,
+        " retain_rank=", cfg_.retain_rank, " interval=", cfg_.interval.count(), "s");
+
+    std::unique_lock lock(mtx_);
+    while (!stoken.stop_requested())
+    {
+        lock.unlock();
+        const auto started = Clock::now();
+        try
+        {
+            const bool stale = universe_.empty() || started - universe_at_ >= cfg_.universe_refresh;
+            if ((!stale || refreshUniverse_()) && fetchTickers_())
+            {
+                std::vector<std::string> previous;
+                {
+                    std::lock_guard guard(mtx_);
+                    previous = selected_;
+                }
+
+                std::vector<std::string> next = rank(table_, cfg_, previous);
+                stats_.scans.fetch_add(1, std::memory_order_relaxed);
+
+                // 후보가 하나도 없으면(거래대금 기준 미달 등) 기존 선택 유지 → 전 마켓 drain 방지
+                // 순위 순서만 바뀐 경우는 변경 아님 (마켓 집합 비교)
+                auto a = next, b = previous;
+                std::sort(a.begin(), a.end());
+                std::sort(b.begin(), b.end());
+                if (!next.empty() && a != b)
+                {
+                    logger.info("[MarketScanner] Selection changed: ", next.size(), " markets (universe=",
+                        table_.size(), ")");
+                    {
+                        std::lock_guard guard(mtx_);
+                        selected_ = std::move(next);
+                    }
+                    version_.fetch_add(1, std::memory_order_release);
+                    stats_.selection_changes.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            logger.error("[MarketScanner] scan failed: ", e.what());
+        }
+        stats_.last_scan_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - started).count(), std::memory_order_relaxed);
+
+        lock.lock();
+        cv_.wait_until(lock, stoken, started + cfg_.interval, [] { return false; });
+    }
+
+    logger.info("[MarketScanner] Stopped");
+}
+
+// ========== refreshUniverse_ ==========
+bool MarketScanner::refreshUniverse_()
+{
+    stats_.requests.fetch_add(1, std::memory_order_relaxed);
+    auto result = api_.getMarkets(true);    // isDetails=true → market_event.warning 포함
+    if (!std::holds_alternative<std::vector<core::MarketInfo>>(result))
+    {
+        stats_.request_errors.fetch_add(1, std::memory_order_relaxed);
+        util::Logger::instance().warn("[MarketScanner] getMarkets failed: ",
+            std::get<api::rest::RestError>(result).message);
+        return !universe_.empty();  // 기존 목록이 있으면 그대로 스캔
+    }
+
+    std::vector<std::string> universe;
+    for (const auto& m : std::get<std::vector<core::MarketInfo>>(result))
+    {
+        if (!m.market.starts_with(cfg_.quote_prefix)) continue;
+        if (cfg_.exclude_warning && m.is_warning) continue;
+        universe.push_back(m.market);
+    }
+
+    universe_ = std::move(universe);
+    universe_at_ = Clock::now();
+    stats_.universe_size.store(universe_.size(), std::memory_order_relaxed);
+    return !universe_.empty();
+}
+
+// ========== fetchTickers_ ==========
+bool MarketScanner::fetchTickers_()
+{
+    table_.clear();
+    table_.reserve(universe_.size());
+
+    std::vector<std::string> batch;
+    batch.reserve(cfg_.batch_size);
+    for (std::size_t begin = 0; begin < universe_.size(); begin += cfg_.batch_size)
+    {
+        const std::size_t end = std::min(universe_.size(), begin + cfg_.batch_size);
+        batch.assign(universe_.begin() + static_cast<std::ptrdiff_t>(begin),
+                     universe_.begin() + static_cast<std::ptrdiff_t>(end));
+
+        stats_.requests.fetch_add(1, std::memory_order_relaxed);
+        auto result = api_.getTickers(batch);
+        if (!std::holds_alternative<std::vector<core::Ticker>>(result))
+        {
+            // 일부 마켓만으로 순위를 매기면 선택이 출렁임 → 이번 스캔은 폐기
+            stats_.request_errors.fetch_add(1, std::memory_order_relaxed);
+            util::Logger::instance().warn("[MarketScanner] getTickers failed (", batch.size(),
+                " markets): ", std::get<api::rest::RestError>(result).message);
+            return false;
+        }
+
+        for (auto& t : std::get<std::vector<core::Ticker>>(result))
+        {
+            // acc_trade_price_24h가 없는 응답이면 24h 거래량 × 현재가로 근사
+            const double turnover = t.acc_trade_price_24h > 0.0
+                ? t.acc_trade_price_24h
+                : t.acc_trade_volume_24h * t.ticker_trade_price;
+            const double vol = t.prev_closing_price > 0.0
+                ? (t.ticker_high_price - t.ticker_low_price) / t.prev_closing_price
+                : 0.0;
+            table_.push(std::move(t.market), turnover, vol);
+        }
+    }
+    return table_.size() > 0;
+}
+
+// ========== rank ==========
+std::vector<std::string> MarketScanner::rank(UniverseTable& table, const Config& cfg,
+                                             const std::vector<std::string>& previous)
+{
+    const std::size_t n = table.size();
+    const std::size_t top_n = std::max<std::size_t>(1, cfg.top_n);
+    const std::size_t retain_rank = std::max(cfg.retain_rank, top_n);
+    const double w = std::clamp(cfg.volatility_weight, 0.0, 1.0);
+
+    std::vector<std::size_t> candidates;
+    candidates.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (table.turnover_24h[i] >= cfg.min_turnover_krw_24h)
+            candidates.push_back(i);
+        else
+            table.score[i] = -1.0;
+    }
+    if (candidates.empty()) return {};
+
+    std::vector<double> turnover_pct(n, 0.0);
+    std::vector<double> vol_pct(n, 0.0);
+    percentiles(table.turnover_24h, candidates, turnover_pct);
+    percentiles(table.volatility, candidates, vol_pct);
+
+    for (const std::size_t i : candidates)
+        table.score[i] = (1.0 - w) * turnover_pct[i] + w * vol_pct[i];
+
+    // 점수 내림차순 (동점은 거래대금 큰 쪽)
+    std::sort(candidates.begin(), candidates.end(), [&](std::size_t a, std::size_t b) {
+        if (table.score[a] != table.score[b]) return table.score[a] > table.score[b];
+        return table.turnover_24h[a] > table.turnover_24h[b];
+    });
+
+    std::unordered_map<std::string_view, std::size_t> position;
+    position.reserve(candidates.size());
+    for (std::size_t r = 0; r < candidates.size(); ++r)
+        position.emplace(table.market[candidates[r]], r);
+
+    // 1) 기존 선택 중 retain_rank 안에 남은 마켓 유지  2) 남는 자리는 상위부터
+    std::vector<bool> chosen(candidates.size(), false);
+    std::size_t count = 0;
+    for (const auto& m : previous)
+    {
+        if (count >= top_n) break;
+        const auto it = position.find(m);
+        if (it == position.end() || it->second >= retain_rank || chosen[it->second]) continue;
+        chosen[it->second] = true;
+        ++count;
+    }
+    for (std::size_t r = 0; r < candidates.size() && count < top_n; ++r)
+    {
+        if (chosen[r]) continue;
+        chosen[r] = true;
+        ++count;
+    }
+
+    std::vector<std::string> out;
+    out.reserve(count);
+    for (std::size_t r = 0; r < candidates.size(); ++r)
+        if (chosen[r]) out.push_back(table.market[candidates[r]]);
+    return out;
+}
+
+} // namespace app
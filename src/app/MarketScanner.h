@@ -0,0 +1,140 @@
+// app/MarketScanner.h
+//
+// 거래 마켓 유니버스 스캐너
+// - 전용 스레드가 주기적으로 대상 마켓 전체 시세를 일괄 조회 (GET /v1/ticker, 1회 최대 batch_size개)
+//   → 주기당 REST 호출 = ceil(유니버스 / batch_size) (KRW 마켓 ~200개 → 2회), 마켓 목록은 universe_refresh마다 1회
+// - 결과를 열 단위 표(UniverseTable)에 채워 24h 거래대금/변동성 백분위 점수로 순위 산정
+// - 상위 top_n 선택 (기존 선택은 retain_rank 안이면 유지 → 순위 출렁임에 따른 마켓 교체 최소화)
+// - 선택이 바뀌면 version 증가 → 제어 스레드가 selection()을 읽어 MarketEngineManager에 반영
+//
+// 생명주기: 생성 → (seed) → start() → stop() (소멸자에서도 자동 호출)
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "api/upbit/UpbitPublicRestClient.h"
+#include "util/Config.h"
+
+namespace app {
+
+// 스캔 1회분 열 단위 표 (행 = 마켓)
+// 순위 계산은 숫자 열만 연속 순회 → 마켓 수백 개도 캐시 안에서 처리
+struct UniverseTable {
+    std::vector<std::string> market;
+    std::vector<double> turnover_24h;   // 24h 거래대금 (KRW)
+    std::vector<double> volatility;     // 당일 (고가 - 저가) / 전일 종가 (UTC 0시 기준)
+    std::vector<double> score;          // MarketScanner::rank가 채움 (후보 제외 = -1)
+
+    std::size_t size() const noexcept { return market.size(); }
+
+    void clear() noexcept
+    {
+        market.clear();
+        turnover_24h.clear();
+        volatility.clear();
+        score.clear();
+    }
+
+    void reserve(std::size_t n)
+    {
+        market.reserve(n);
+        turnover_24h.reserve(n);
+        volatility.reserve(n);
+        score.reserve(n);
+    }
+
+    void push(std::string m, double turnover, double vol)
+    {
+        market.push_back(std::move(m));
+        turnover_24h.push_back(turnover);
+        volatility.push_back(vol);
+        score.push_back(0.0);
+    }
+};
+
+class MarketScanner final {
+public:
+    using Config = util::ScannerConfig;
+
+    // 선택 결과 (version: 선택이 바뀔 때마다 증가, 0 = 첫 스캔 전)
+    struct Selection {
+        std::uint64_t version{0};
+        std::vector<std::string> markets;   // 순위순
+    };
+
+    // api는 스캐너보다 오래 살아야 함 (스캐너 스레드에서만 호출)
+    MarketScanner(const api::upbit::UpbitPublicRestClient& api, Config cfg);
+    ~MarketScanner();
+
+    MarketScanner(const MarketScanner&) = delete;
+    MarketScanner& operator=(const MarketScanner&) = delete;
+
+    // 시작 시 운용 중인 마켓을 기존 선택으로 등록 (히스테리시스 기준, start 전 호출)
+    void seed(std::vector<std::string> markets);
+
+    void start();
+
+    // 스캐너 스레드 정지 + join (진행 중인 조회 1회는 완료 후 종료)
+    void stop();
+
+    Selection selection() const;
+    std::uint64_t selectionVersion() const noexcept { return version_.load(std::memory_order_acquire); }
+
+    // 점수 계산 + 상위 선택 (상태 없음)
+    // - 후보: turnover ≥ min_turnover_krw_24h
+    // - score = (1-w)·거래대금 백분위 + w·변동성 백분위 (후보 내 순위 기준 → 단위/분포 무관)
+    // - previous 중 retain_rank 안의 마켓을 먼저 유지, 남는 자리는 높은 점수순
+    // @return 순위순 최대 top_n개
+    static std::vector<std::string> rank(UniverseTable& table, const Config& cfg,
+                                         const std::vector<std::string>& previous);
+
+    // 기록은 스캐너 스레드만, 읽기는 락 없이
+    struct Stats {
+        std::atomic<std::uint64_t> scans{0};            // 완료된 스캔 수
+        std::atomic<std::uint64_t> requests{0};         // REST 호출 수 (market/all + ticker)
+        std::atomic<std::uint64_t> request_errors{0};   // 그 중 RestError (해당 스캔은 폐기)
+        std::atomic<std::uint64_t> selection_changes{0};
+        std::atomic<std::uint64_t> universe_size{0};    // 필터 후 대상 마켓 수
+        std::atomic<std::int64_t> last_scan_ns{0};      // 마지막 스캔 소요 시간
+    };
+
+    const Stats& stats() const noexcept { return stats_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void run_(std::stop_token stoken);
+
+    // /v1/market/all 재조회 → universe_ 갱신 (실패 시 false, 기존 목록 유지)
+    bool refreshUniverse_();
+
+    // 전체 시세 일괄 조회 → table_ 채움 (한 배치라도 실패하면 false)
+    bool fetchTickers_();
+
+    const api::upbit::UpbitPublicRestClient& api_;
+    Config cfg_;
+
+    // 스캐너 스레드 전용
+    std::vector<std::string> universe_;
+    Clock::time_point universe_at_{};
+    UniverseTable table_;
+
+    mutable std::mutex mtx_;
+    std::condition_variable_any cv_;
+    std::vector<std::string> selected_;     // mtx_ 보호
+    std::atomic<std::uint64_t> version_{0};
+
+    Stats stats_;
+
+    std::jthread thread_;
+};
+
+} // namespace app
@@ -0,0 +1,215 @@
+// app/MetricsExporter.cpp
+#include "app/MetricsExporter.h"
+
+#include <cstdint>
+
+#include "api/net/ResolverCache.h"
+#include "api/net/TlsSessionCache.h"
+#include "api/upbit/SharedOrderApi.h"
+#include "api/ws/UpbitWebSocketClient.h"
+#include "app/EventRouter.h"
+#include "app/MarketEngineManager.h"
+#include "app/MarketScanner.h"
+#include "database/Database.h"
+#include "trading/allocation/AccountManager.h"
+#include "util/PrometheusText.h"
+
+namespace app {
+
+namespace {
+
+    std::uint64_t get(const std::atomic<std::uint64_t>& a)
+    {
+        return a.load(std::memory_order_relaxed);
+    }
+
+    void writeRouter(util::PrometheusText& out, const EventRouter& router)
+    {
+        const auto& st = router.stats();
+
+        out.family("coinbot_router_events_total", "counter", "EventRouter routing results");
+        out.sample("coinbot_router_events_total", { { "result", "routed" } },         get(st.total_routed));
+        out.sample("coinbot_router_events_total", { { "result", "fast_path" } },      get(st.fast_path_success));
+        out.sample("coinbot_router_events_total", { { "result", "fallback" } },       get(st.fallback_used));
+        out.sample("coinbot_router_events_total", { { "result", "parse_failure" } },  get(st.parse_failures));
+        out.sample("coinbot_router_events_total", { { "result", "conflict" } },       get(st.conflict_detected));
+        out.sample("coinbot_router_events_total", { { "result", "unknown_market" } }, get(st.unknown_market));
+    }
+
+    void writeAccount(util::PrometheusText& out, const trading::allocation::AccountManager& am)
+    {
+        const auto& st = am.stats();
+
+        out.family("coinbot_account_ops_total", "counter", "AccountManager budget operations");
+        out.sample("coinbot_account_ops_total", { { "op", "reserve" } },         get(st.total_reserves));
+        out.sample("coinbot_account_ops_total", { { "op", "release" } },         get(st.total_releases));
+        out.sample("coinbot_account_ops_total", { { "op", "fill_buy" } },        get(st.total_fills_buy));
+        out.sample("coinbot_account_ops_total", { { "op", "fill_sell" } },       get(st.total_fills_sell));
+        out.sample("coinbot_account_ops_total", { { "op", "reserve_failure" } }, get(st.reserve_failures));
+    }
+
+    void writeRest(util::PrometheusText& out, const api::upbit::SharedOrderApi& api)
+    {
+        using Api = api::upbit::SharedOrderApi;
+
+        out.family("coinbot_rest_requests_total", "counter", "REST calls per endpoint");
+        for (std::size_t i = 0; i < Api::kEndpointCount; ++i)
+        {
+            const auto e = static_cast<Api::Endpoint>(i);
+            out.sample("coinbot_rest_requests_total", { { "endpoint", Api::toString(e) } },
+                get(api.endpointStats(e).calls));
+        }
+
+        out.family("coinbot_rest_errors_total", "counter", "REST calls that returned RestError");
+        for (std::size_t i = 0; i < Api::kEndpointCount; ++i)
+        {
+            const auto e = static_cast<Api::Endpoint>(i);
+            out.sample("coinbot_rest_errors_total", { { "endpoint", Api::toString(e) } },
+                get(api.endpointStats(e).errors));
+        }
+
+        out.family("coinbot_rest_latency_seconds", "summary", "REST round trip per endpoint (retries included)");
+        for (std::size_t i = 0; i < Api::kEndpointCount; ++i)
+        {
+            const auto e = static_cast<Api::Endpoint>(i);
+            out.summary("coinbot_rest_latency_seconds", { { "endpoint", Api::toString(e) } },
+                api.endpointStats(e).latency.snapshot());
+        }
+
+        out.family("coinbot_rest_max_in_flight", "gauge", "Max concurrent calls observed inside SharedOrderApi");
+        out.sample("coinbot_rest_max_in_flight", {},
+            static_cast<std::uint64_t>(api.debugMaxInFlight()));
+    }
+
+    void writeWs(util::PrometheusText& out,
+        const api::ws::UpbitWebSocketClient* pub, const api::ws::UpbitWebSocketClient* priv)
+    {
+        struct Item { const char* name; const api::ws::UpbitWebSocketClient* ws; };
+        const Item items[] = { { "public", pub }, { "private", priv } };
+
+        out.family("coinbot_ws_connected", "gauge", "1 if the WebSocket is connected");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_connected", { { "channel", it.name } },
+                std::uint64_t{ it.ws->stats().connected.load(std::memory_order_relaxed) ? 1u : 0u });
+
+        out.family("coinbot_ws_messages_total", "counter", "WebSocket domain messages received");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_messages_total", { { "channel", it.name } },
+                get(it.ws->stats().messages_rx));
+
+        out.family("coinbot_ws_reconnect_attempts_total", "counter", "WebSocket reconnect attempts");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_reconnect_attempts_total", { { "channel", it.name } },
+                get(it.ws->stats().reconnect_attempts));
+
+        out.family("coinbot_ws_reconnects_total", "counter", "Successful WebSocket reconnects");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_reconnects_total", { { "channel", it.name } },
+                get(it.ws->stats().reconnect_success));
+
+        out.family("coinbot_ws_standby_ready", "gauge", "1 if a handshaken standby connection is ready");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_standby_ready", { { "channel", it.name } },
+                std::uint64_t{ it.ws->stats().standby_ready.load(std::memory_order_relaxed) ? 1u : 0u });
+
+        out.family("coinbot_ws_standby_promotions_total", "counter", "Failovers served by the standby connection");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_standby_promotions_total", { { "channel", it.name } },
+                get(it.ws->stats().standby_promotions));
+
+        out.family("coinbot_ws_failover_duplicates_total", "counter", "Duplicate messages dropped right after failover");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_failover_duplicates_total", { { "channel", it.name } },
+                get(it.ws->stats().duplicates_suppressed));
+
+        out.family("coinbot_ws_last_failover_seconds", "gauge", "Last standby failover time (error to resubscribed)");
+        for (const auto& it : items)
+            if (it.ws) out.sample("coinbot_ws_last_failover_seconds", { { "channel", it.name } },
+                static_cast<double>(get(it.ws->stats().last_failover_us)) / 1e6);
+    }
+
+    void writeNet(util::PrometheusText& out,
+        const api::net::ResolverCache* dns, const api::net::TlsSessionCache* tls)
+    {
+        if (dns)
+        {
+            const auto& st = dns->stats();
+            out.family("coinbot_dns_cache_total", "counter", "Shared DNS cache lookups by result");
+            out.sample("coinbot_dns_cache_total", { { "result", "hit" } },              get(st.hits));
+            out.sample("coinbot_dns_cache_total", { { "result", "miss" } },             get(st.misses));
+            out.sample("coinbot_dns_cache_total", { { "result", "stale" } },            get(st.stale_served));
+            out.sample("coinbot_dns_cache_total", { { "result", "refresh" } },          get(st.refreshes));
+            out.sample("coinbot_dns_cache_total", { { "result", "refresh_failure" } },  get(st.refresh_failures));
+        }
+
+        if (tls)
+        {
+            const auto& st = tls->stats();
+            out.family("coinbot_tls_handshakes_total", "counter", "TLS client handshakes (full vs session resumed)");
+            out.sample("coinbot_tls_handshakes_total", { { "kind", "full" } },    get(st.full_handshakes));
+            out.sample("coinbot_tls_handshakes_total", { { "kind", "resumed" } }, get(st.resumed_handshakes));
+
+            out.family("coinbot_tls_handshake_seconds", "summary", "TLS handshake time (TCP connect excluded)");
+            out.summary("coinbot_tls_handshake_seconds", { { "kind", "full" } },    st.full_latency.snapshot());
+            out.summary("coinbot_tls_handshake_seconds", { { "kind", "resumed" } }, st.resumed_latency.snapshot());
+        }
+    }
+
+    void writeDb(util::PrometheusText& out, const db::Database& db)
+    {
+        const auto& st = db.stats();
+
+        out.family("coinbot_db_writes_total", "counter", "SQLite insert calls");
+        out.sample("coinbot_db_writes_total", {}, get(st.writes));
+
+        out.family("coinbot_db_write_failures_total", "counter", "SQLite insert failures");
+        out.sample("coinbot_db_write_failures_total", {}, get(st.write_failures));
+
+        out.family("coinbot_db_write_seconds_total", "counter", "Time spent in synchronous SQLite inserts");
+        out.sample("coinbot_db_write_seconds_total", {}, static_cast<double>(get(st.write_ns_total)) / 1e9);
+
+        out.family("coinbot_db_write_max_seconds", "gauge", "Slowest SQLite insert observed");
+        out.sample("coinbot_db_write_max_seconds", {}, static_cast<double>(get(st.write_ns_max)) / 1e9);
+    }
+
+    void writeScanner(util::PrometheusText& out, const MarketScanner& scanner)
+    {
+        const auto& st = scanner.stats();
+
+        out.family("coinbot_scanner_scans_total", "counter", "Completed market universe scans");
+        out.sample("coinbot_scanner_scans_total", {}, get(st.scans));
+
+        out.family("coinbot_scanner_requests_total", "counter", "Scanner REST calls by result");
+        out.sample("coinbot_scanner_requests_total", { { "result", "ok" } },    get(st.requests) - get(st.request_errors));
+        out.sample("coinbot_scanner_requests_total", { { "result", "error" } }, get(st.request_errors));
+
+        out.family("coinbot_scanner_selection_changes_total", "counter", "Times the selected market set changed");
+        out.sample("coinbot_scanner_selection_changes_total", {}, get(st.selection_changes));
+
+        out.family("coinbot_scanner_universe_size", "gauge", "Markets in the scanned universe after filtering");
+        out.sample("coinbot_scanner_universe_size", {}, get(st.universe_size));
+
+        out.family("coinbot_scanner_last_scan_seconds", "gauge", "Duration of the last scan (REST calls included)");
+        out.sample("coinbot_scanner_last_scan_seconds", {},
+            static_cast<double>(st.last_scan_ns.load(std::memory_order_relaxed)) / 1e9);
+    }
+
+} // anonymous namespace
+
+std::string renderMetrics(const MetricsSources& src)
+{
+    util::PrometheusText out;
+
+    if (src.router)      writeRouter(out, *src.router);
+    if (src.engine_mgr)  src.engine_mgr->writeMetrics(out);
+    if (src.account_mgr) writeAccount(out, *src.account_mgr);
+    if (src.order_api)   writeRest(out, *src.order_api);
+    if (src.ws_public || src.ws_private) writeWs(out, src.ws_public, src.ws_private);
+    if (src.db)          writeDb(out, *src.db);
+    if (src.dns || src.tls) writeNet(out, src.dns, src.tls);
+    if (src.scanner)     writeScanner(out, *src.scanner);
+
+    return out.release();
+}
+
+} // namespace app
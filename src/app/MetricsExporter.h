@@ -0,0 +1,37 @@
+// app/MetricsExporter.h
+// 각 컴포넌트의 통계(atomic)를 모아 Prometheus 텍스트로 변환
+#pragma once
+
+#include <string>
+
+namespace api::net { class ResolverCache; class TlsSessionCache; }
+namespace api::upbit { class SharedOrderApi; }
+namespace api::ws { class UpbitWebSocketClient; }
+namespace trading::allocation { class AccountManager; }
+namespace db { class Database; }
+
+namespace app {
+
+class EventRouter;
+class MarketEngineManager;
+class MarketScanner;
+
+// 수집 대상 (nullptr이면 해당 섹션 생략)
+// 수명 계약: MetricsServer가 멈출 때까지 모두 살아있어야 함
+struct MetricsSources {
+    const EventRouter* router = nullptr;
+    const MarketEngineManager* engine_mgr = nullptr;
+    const trading::allocation::AccountManager* account_mgr = nullptr;
+    const api::upbit::SharedOrderApi* order_api = nullptr;
+    const api::ws::UpbitWebSocketClient* ws_public = nullptr;
+    const api::ws::UpbitWebSocketClient* ws_private = nullptr;
+    const db::Database* db = nullptr;
+    const api::net::ResolverCache* dns = nullptr;
+    const api::net::TlsSessionCache* tls = nullptr;
+    const MarketScanner* scanner = nullptr;
+};
+
+// atomic 읽기만 수행 (거래 경로의 mutex를 잡지 않음)
+std::string renderMetrics(const MetricsSources& src);
+
+} // namespace app
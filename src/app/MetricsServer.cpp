@@ -0,0 +1,161 @@
+// app/MetricsServer.cpp
+#include "app/MetricsServer.h"
+
+#include <chrono>
+#include <exception>
+#include <utility>
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+
+#include "util/Logger.h"
+
+namespace app {
+
+namespace beast = boost::beast;
+namespace http  = beast::http;
+namespace net   = boost::asio;
+using tcp       = net::ip::tcp;
+
+// 연결 1개 = 요청 1개 처리 후 종료 (스크레이프 주기가 길어 keep-alive 불필요)
+class MetricsServer::Session : public std::enable_shared_from_this<Session> {
+public:
+    Session(tcp::socket socket, const Renderer& renderer)
+        : stream_(std::move(socket))
+        , renderer_(renderer)
+    {}
+
+    void run()
+    {
+        stream_.expires_after(std::chrono::seconds(5));
+        http::async_read(stream_, buffer_, req_,
+            [self = shared_from_this()](beast::error_code ec, std::size_t) {
+                self->onRead_(ec);
+            });
+    }
+
+private:
+    void onRead_(beast::error_code ec)
+    {
+        if (ec) return;  // 타임아웃/클라이언트 종료 → 세션 폐기
+
+        res_.version(req_.version());
+        res_.keep_alive(false);
+        res_.set(http::field::server, "CoinBot-metrics");
+
+        if (req_.method() != http::verb::get || req_.target() != "/metrics")
+        {
+            res_.result(http::status::not_found);
+            res_.set(http::field::content_type, "text/plain");
+            res_.body() = "not found\n";
+        }
+        else
+        {
+            try
+            {
+                res_.body() = renderer_();
+                res_.result(http::status::ok);
+                res_.set(http::field::content_type, "text/plain; version=0.0.4; charset=utf-8");
+            }
+            catch (const std::exception& e)
+            {
+                res_.result(http::status::internal_server_error);
+                res_.set(http::field::content_type, "text/plain");
+                res_.body() = e.what();
+            }
+        }
+        res_.prepare_payload();
+
+        http::async_write(stream_, res_,
+            [self = shared_from_this()](beast::error_code, std::size_t) {
+                beast::error_code ignore;
+                self->stream_.socket().shutdown(tcp::socket::shutdown_send, ignore);
+            });
+    }
+
+    beast::tcp_stream stream_;
+    beast::flat_buffer buffer_;
+    http::request<http::string_body> req_;
+    http::response<http::string_body> res_;
+    const Renderer& renderer_;
+};
+
+MetricsServer::MetricsServer(std::string bind_address, unsigned short port, Renderer renderer)
+    : bind_address_(std::move(bind_address))
+    , port_(port)
+    , renderer_(std::move(renderer))
+    , acceptor_(ioc_)
+{}
+
+MetricsServer::~MetricsServer()
+{
+    stop();
+}
+
+bool MetricsServer::start()
+{
+    if (thread_.joinable()) return true;
+
+    auto& logger = util::Logger::instance();
+
+    beast::error_code ec;
+    const auto addr = net::ip::make_address(bind_address_, ec);
+    if (ec)
+    {
+        logger.warn("[Metrics] invalid bind address=", bind_address_, ": ", ec.message());
+        return false;
+    }
+
+    const tcp::endpoint ep{ addr, port_ };
+    acceptor_.open(ep.protocol(), ec);
+    if (!ec) acceptor_.set_option(net::socket_base::reuse_address(true), ec);
+    if (!ec) acceptor_.bind(ep, ec);
+    if (!ec) acceptor_.listen(net::socket_base::max_listen_connections, ec);
+    if (ec)
+    {
+        logger.warn("[Metrics] listen failed on ", bind_address_, ":", port_, ": ", ec.message());
+        beast::error_code ignore;
+        acceptor_.close(ignore);
+        return false;
+    }
+
+    doAccept_();
+
+    thread_ = std::jthread([this] {
+        ioc_.run();
+    });
+
+    logger.info("[Metrics] serving http://", bind_address_, ":", port_, "/metrics");
+    return true;
+}
+
+void MetricsServer::stop()
+{
+    if (!thread_.joinable()) return;
+
+    // io 스레드를 먼저 멈춘 뒤 acceptor 정리 (asio 객체는 스레드 안전하지 않음)
+    ioc_.stop();
+    thread_.join();
+
+    beast::error_code ignore;
+    acceptor_.close(ignore);
+}
+
+void MetricsServer::doAccept_()
+{
+    acceptor_.async_accept(ioc_,
+        [this](beast::error_code ec, tcp::socket socket) {
+            // close()로 인한 취소면 accept 루프 종료
+            if (ec == net::error::operation_aborted || !acceptor_.is_open())
+                return;
+
+            if (!ec)
+            {
+                std::make_shared<Session>(std::move(socket), renderer_)->run();
+            }
+            doAccept_();
+        });
+}
+
+} // namespace app
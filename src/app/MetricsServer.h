@@ -0,0 +1,51 @@
+// app/MetricsServer.h
+//
+// 로컬 Prometheus 스크레이프용 HTTP 서버 (GET /metrics)
+// - 전용 io_context + 스레드 1개 (거래 경로의 io_context/스레드와 분리)
+// - 요청마다 renderer를 호출해 본문 생성 → renderer는 atomic 읽기만 수행해야 함
+// - bind 실패는 경고만 남기고 비활성 (메트릭 때문에 봇이 죽지 않도록)
+//
+// 생명주기: 생성 → start() → stop() (소멸자에서도 자동 호출)
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+namespace app {
+
+class MetricsServer final {
+public:
+    using Renderer = std::function<std::string()>;
+
+    MetricsServer(std::string bind_address, unsigned short port, Renderer renderer);
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    // listen 시작 + 서버 스레드 가동. bind 실패 시 false
+    bool start();
+
+    // accept 중단 + 서버 스레드 join
+    void stop();
+
+private:
+    class Session;
+
+    void doAccept_();
+
+    std::string bind_address_;
+    unsigned short port_;
+    Renderer renderer_;
+
+    boost::asio::io_context ioc_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    std::jthread thread_;
+};
+
+} // namespace app
@@ -0,0 +1,64 @@
+// app/PipelineLatency.h
+// 마켓 파이프라인 단계별 지연 히스토그램 묶음
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "util/LatencyHistogram.h"
+
+namespace app {
+
+// 측정 단계
+// - WsToRoute:      WS 프레임 수신 → EventRouter 큐 push
+// - RouteToDequeue: 큐 push → 워커 pop
+// - Parse:          WS JSON 파싱(parseCandle/parseMyOrder)
+// - Strategy:       전략 onCandle
+// - SubmitRest:     MarketEngine::submit (REST 왕복 포함)
+// - MyOrderToTrade: myOrder 프레임 수신 → onMyTrade 반영 완료
+enum class LatencyStage : std::size_t {
+    WsToRoute = 0,
+    RouteToDequeue,
+    Parse,
+    Strategy,
+    SubmitRest,
+    MyOrderToTrade,
+    Count
+};
+
+inline constexpr std::size_t kLatencyStageCount = static_cast<std::size_t>(LatencyStage::Count);
+
+inline const char* toString(LatencyStage s) noexcept
+{
+    switch (s) {
+    case LatencyStage::WsToRoute:      return "ws_to_route";
+    case LatencyStage::RouteToDequeue: return "route_to_dequeue";
+    case LatencyStage::Parse:          return "parse";
+    case LatencyStage::Strategy:       return "strategy";
+    case LatencyStage::SubmitRest:     return "submit_rest";
+    case LatencyStage::MyOrderToTrade: return "myorder_to_trade";
+    default:                           return "unknown";
+    }
+}
+
+// 마켓 1개분 단계 히스토그램 (기록은 해당 마켓 워커 스레드만, 읽기는 어디서나)
+class PipelineLatency final {
+public:
+    util::LatencyHistogram& at(LatencyStage s) noexcept
+    {
+        return stages_[static_cast<std::size_t>(s)];
+    }
+
+    const util::LatencyHistogram& at(LatencyStage s) const noexcept
+    {
+        return stages_[static_cast<std::size_t>(s)];
+    }
+
+    void record(LatencyStage s, std::int64_t ns) noexcept { at(s).record(ns); }
+
+private:
+    std::array<util::LatencyHistogram, kLatencyStageCount> stages_{};
+};
+
+} // namespace app
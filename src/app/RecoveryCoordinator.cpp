@@ -0,0 +1,281 @@
+// app/RecoveryCoordinator.cpp
+#include "app/RecoveryCoordinator.h"
+
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include "util/Logger.h"
+
+namespace app {
+
+RecoveryCoordinator::RecoveryCoordinator(api::upbit::IOrderApi& api, Deliver deliver, Config cfg)
+    : api_(api)
+    , deliver_(std::move(deliver))
+    , cfg_(cfg)
+{
+    cfg_.max_batch = std::max<std::size_t>(1, cfg_.max_batch);
+    cfg_.max_attempts = std::max(1, cfg_.max_attempts);
+}
+
+RecoveryCoordinator::~RecoveryCoordinator()
+{
+    stop();
+}
+
+void RecoveryCoordinator::start()
+{
+    if (thread_.joinable()) return;
+    thread_ = std::jthread([this](std::stop_token stoken) { run_(stoken); });
+}
+
+void RecoveryCoordinator::stop()
+{
+    if (!thread_.joinable()) return;
+    thread_.request_stop();     // condition_variable_any 대기도 stop_token으로 깨어남
+    thread_.join();
+
+    std::lock_guard lock(mtx_);
+    pending_.clear();
+    in_flight_.clear();
+}
+
+void RecoveryCoordinator::submit(std::string_view market, const std::vector<std::string>& order_uuids)
+{
+    {
+        std::lock_guard lock(mtx_);
+        const auto due = Clock::now() + cfg_.coalesce_window;
+        for (const auto& order_uuid : order_uuids)
+        {
+            if (order_uuid.empty()) continue;
+
+            const auto same = [&](const Entry& e) { return e.order_uuid == order_uuid; };
+            if (std::any_of(pending_.begin(), pending_.end(), same) ||
+                std::any_of(in_flight_.begin(), in_flight_.end(), same))
+                continue;
+
+            pending_.push_back(Entry{ std::string(market), order_uuid, 0, due });
+        }
+        changed_ = true;
+    }
+    cv_.notify_one();
+}
+
+// ========== run_ ==========
+// 대기열에서 가장 이른 due까지 잠들었다가, due가 된 항목(+ 묶음 창 안의 항목)을 최대 max_batch개씩 조회
+void RecoveryCoordinator::run_(std::stop_token stoken)
+{
+    auto& logger = util::Logger::instance();
+    logger.info("[RecoveryCoordinator] Started");
+
+    std::unique_lock lock(mtx_);
+    while (!stoken.stop_requested())
+    {
+        changed_ = false;
+
+        if (pending_.empty())
+        {
+            cv_.wait(lock, stoken, [&] { return changed_; });
+            continue;
+        }
+
+        const auto next_due = std::min_element(pending_.begin(), pending_.end(),
+            [](const Entry& a, const Entry& b) { return a.due < b.due; })->due;
+
+        if (next_due > Clock::now())
+        {
+            cv_.wait_until(lock, stoken, next_due, [&] { return changed_; });
+            continue;
+        }
+
+        // 같은 재연결로 조금 늦게 들어온 다른 마켓 요청까지 한 번에 묶음
+        const auto horizon = Clock::now() + cfg_.coalesce_window;
+        std::vector<Entry> batch;
+        for (auto it = pending_.begin(); it != pending_.end() && batch.size() < cfg_.max_batch; )
+        {
+            if (it->due <= horizon)
+            {
+                batch.push_back(std::move(*it));
+                it = pending_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        in_flight_ = batch;
+
+        lock.unlock();
+        bool failed = false;
+        try
+        {
+            resolve_(std::move(batch));
+        }
+        catch (const std::exception& e)
+        {
+            logger.error("[RecoveryCoordinator] resolve failed: ", e.what());
+            failed = true;
+        }
+        lock.lock();
+
+        if (failed)
+            failInFlight_(lock);
+        in_flight_.clear();
+    }
+
+    logger.info("[RecoveryCoordinator] Stopped");
+}
+
+// ========== failInFlight_ ==========
+// 배치 도중 예외 → 결과 없이 사라지지 않도록 uuid마다 재예약 (이미 재예약된 uuid는 건너뜀)
+void RecoveryCoordinator::failInFlight_(std::unique_lock<std::mutex>& lock)
+{
+    auto& logger = util::Logger::instance();
+    stats_.batch_errors.fetch_add(1, std::memory_order_relaxed);
+
+    std::map<std::string, engine::input::RecoveredOrders, std::less<>> exhausted;
+    const auto now = Clock::now();
+
+    for (auto& e : in_flight_)
+    {
+        const bool requeued = std::any_of(pending_.begin(), pending_.end(),
+            [&](const Entry& p) { return p.order_uuid == e.order_uuid; });
+        if (requeued) continue;
+
+        if (++e.attempts < cfg_.max_attempts)
+        {
+            e.due = now + cfg_.base_backoff * (1 << (e.attempts - 1));
+            stats_.retries.fetch_add(1, std::memory_order_relaxed);
+            pending_.push_back(std::move(e));
+        }
+        else
+        {
+            stats_.unresolved.fetch_add(1, std::memory_order_relaxed);
+            exhausted[e.market].unresolved.push_back(std::move(e.order_uuid));
+        }
+    }
+    in_flight_.clear();
+
+    if (exhausted.empty()) return;
+
+    lock.unlock();
+    for (auto& [market, rec] : exhausted)
+    {
+        logger.warn("[RecoveryCoordinator][", market, "] Order query exhausted after failure, orders=",
+            rec.unresolved.size());
+        try
+        {
+            deliver_(market, std::move(rec));
+        }
+        catch (const std::exception& ex)
+        {
+            logger.error("[RecoveryCoordinator][", market, "] deliver failed: ", ex.what());
+        }
+    }
+    lock.lock();
+}
+
+// ========== resolve_ ==========
+void RecoveryCoordinator::resolve_(std::vector<Entry> batch)
+{
+    auto& logger = util::Logger::instance();
+
+    std::vector<std::string> order_uuids;
+    order_uuids.reserve(batch.size());
+    for (const auto& e : batch)
+        order_uuids.push_back(e.order_uuid);
+
+    stats_.batches.fetch_add(1, std::memory_order_relaxed);
+
+    std::optional<std::vector<core::Order>> found;
+    try
+    {
+        auto result = api_.getOrdersByUuids(order_uuids);
+        if (std::holds_alternative<std::vector<core::Order>>(result))
+            found = std::move(std::get<std::vector<core::Order>>(result));
+        else
+            logger.warn("[RecoveryCoordinator] getOrdersByUuids failed (", order_uuids.size(),
+                " orders): ", std::get<api::rest::RestError>(result).message);
+    }
+    catch (const std::exception& e)
+    {
+        logger.warn("[RecoveryCoordinator] getOrdersByUuids threw: ", e.what());
+    }
+    if (!found)
+        stats_.batch_errors.fetch_add(1, std::memory_order_relaxed);
+
+    std::unordered_map<std::string_view, core::Order*> by_uuid;
+    if (found)
+    {
+        by_uuid.reserve(found->size());
+        for (auto& o : *found)
+            by_uuid.emplace(o.id, &o);
+    }
+
+    std::map<std::string, engine::input::RecoveredOrders, std::less<>> results;
+    std::vector<Entry> retry;
+    const auto now = Clock::now();
+
+    for (auto& e : batch)
+    {
+        const auto it = by_uuid.find(e.order_uuid);
+        if (it != by_uuid.end())
+        {
+            core::Order& order = *it->second;
+
+            // 목록 응답에는 trades가 없어 체결 금액을 보강할 수 없음 → 단건 조회로 대체
+            // (보강 실패 시 그대로 전달: reconcileFromSnapshot이 unknown_funds로 거부하고 pending 유지)
+            if (order.executed_volume > 0.0 && order.executed_funds <= 0.0)
+            {
+                stats_.single_fallbacks.fetch_add(1, std::memory_order_relaxed);
+                try
+                {
+                    auto single = api_.getOrder(e.order_uuid);
+                    if (std::holds_alternative<core::Order>(single))
+                        order = std::move(std::get<core::Order>(single));
+                }
+                catch (const std::exception& ex)
+                {
+                    logger.warn("[RecoveryCoordinator][", e.market, "] getOrder threw: ", ex.what(),
+                        " order=", e.order_uuid);
+                }
+            }
+
+            stats_.resolved.fetch_add(1, std::memory_order_relaxed);
+            results[e.market].orders.push_back(std::move(order));
+            continue;
+        }
+
+        // 호출 실패 또는 응답 누락 → 백오프 후 재조회, 시도 소진 시 미확인으로 전달
+        if (++e.attempts < cfg_.max_attempts)
+        {
+            e.due = now + cfg_.base_backoff * (1 << (e.attempts - 1));
+            stats_.retries.fetch_add(1, std::memory_order_relaxed);
+            retry.push_back(std::move(e));
+        }
+        else
+        {
+            logger.warn("[RecoveryCoordinator][", e.market,
+                "] Order query exhausted (", cfg_.max_attempts, " attempts), order=", e.order_uuid);
+            stats_.unresolved.fetch_add(1, std::memory_order_relaxed);
+            results[e.market].unresolved.push_back(std::move(e.order_uuid));
+        }
+    }
+
+    if (!retry.empty())
+    {
+        std::lock_guard lock(mtx_);
+        for (auto& e : retry)
+            pending_.push_back(std::move(e));
+    }
+
+    for (auto& [market, rec] : results)
+        deliver_(market, std::move(rec));
+}
+
+} // namespace app
@@ -0,0 +1,103 @@
+// app/RecoveryCoordinator.h
+//
+// pending 주문 복구 코디네이터
+// - 마켓 워커들이 submit()한 pending order_uuid를 마켓 구분 없이 모아
+//   GET /v1/orders/uuids 일괄 조회 (재연결 시 N개 마켓 → 1회 호출)
+// - 실패/누락 uuid는 지수 백오프로 재시도 (전용 스레드에서 대기 → 마켓 워커는 블로킹 없음)
+// - 결과는 마켓별 RecoveredOrders로 묶어 Deliver 콜백으로 전달 (→ 각 마켓 큐)
+//
+// 생명주기: 생성 → start() → stop() (소멸자에서도 자동 호출)
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "api/upbit/IOrderApi.h"
+#include "engine/input/EngineInput.h"
+
+namespace app {
+
+struct RecoveryCoordinatorConfig {
+    std::size_t max_batch = 100;                    // 1회 조회 최대 uuid 수 (Upbit 제한)
+    int max_attempts = 3;                           // uuid당 최대 조회 횟수
+    std::chrono::milliseconds base_backoff{500};    // 재시도 간격 (시도마다 2배)
+    std::chrono::milliseconds coalesce_window{20};  // 첫 요청 후 다른 마켓 요청을 모으는 시간
+};
+
+class RecoveryCoordinator final {
+public:
+    using Config = RecoveryCoordinatorConfig;
+
+    // 코디네이터 스레드에서 호출됨 (마켓 큐 push 정도만 수행할 것)
+    using Deliver = std::function<void(const std::string& market, engine::input::RecoveredOrders&&)>;
+
+    RecoveryCoordinator(api::upbit::IOrderApi& api, Deliver deliver, Config cfg = Config{});
+    ~RecoveryCoordinator();
+
+    RecoveryCoordinator(const RecoveryCoordinator&) = delete;
+    RecoveryCoordinator& operator=(const RecoveryCoordinator&) = delete;
+
+    void start();
+
+    // 코디네이터 스레드 정지 + join (대기 중인 요청은 폐기)
+    void stop();
+
+    // 마켓 워커에서 호출: 큐에 넣고 즉시 반환
+    // - 이미 대기 중이거나 조회 중인 order_uuid는 병합 (시도 횟수/재시도 시각 유지)
+    void submit(std::string_view market, const std::vector<std::string>& order_uuids);
+
+    // 기록은 코디네이터 스레드만, 읽기는 락 없이
+    struct Stats {
+        std::atomic<std::uint64_t> batches{0};          // getOrdersByUuids 호출 수
+        std::atomic<std::uint64_t> batch_errors{0};     // 그 중 RestError/예외
+        std::atomic<std::uint64_t> retries{0};          // 백오프 후 재조회 예약된 uuid 수
+        std::atomic<std::uint64_t> resolved{0};         // 스냅샷 전달된 주문 수
+        std::atomic<std::uint64_t> unresolved{0};       // 재시도 소진 주문 수
+        std::atomic<std::uint64_t> single_fallbacks{0}; // executed_funds 보강용 getOrder 호출 수
+    };
+
+    const Stats& stats() const noexcept { return stats_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::string market;
+        std::string order_uuid;
+        int attempts{0};
+        Clock::time_point due{};
+    };
+
+    void run_(std::stop_token stoken);
+
+    // 락 밖에서 호출: 일괄 조회 → 재시도 예약 / 마켓별 전달
+    void resolve_(std::vector<Entry> batch);
+
+    // resolve_가 예외로 끝난 배치: 시도 1회로 치고 재예약, 소진된 uuid는 미확인으로 전달
+    void failInFlight_(std::unique_lock<std::mutex>& lock);
+
+    api::upbit::IOrderApi& api_;
+    Deliver deliver_;
+    Config cfg_;
+
+    std::mutex mtx_;
+    std::condition_variable_any cv_;
+    std::vector<Entry> pending_;    // 조회 대기 (수십 개 수준 → 선형 탐색)
+    std::vector<Entry> in_flight_;  // 지금 resolve_ 중인 배치 (중복 submit 병합 + 예외 시 재예약용)
+    bool changed_{false};           // submit 이후 대기 시각 재계산 필요
+
+    Stats stats_;
+
+    std::jthread thread_;
+};
+
+} // namespace app
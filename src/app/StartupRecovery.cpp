@@ -35,15 +35,22 @@ namespace app {
         void cancelBotOpenOrdersImpl(ApiT& api, std::string_view market,
             const StartupRecovery::Options& opt)
         {
-            if (opt.bot_identifier_prefix.empty()) {
-                util::Logger::instance().warn("[Startup] bot_identifier_prefix is empty. skip cancel.");
+            // 마켓별 병렬 실행 시 로그 구분을 위해 market 태그를 붙인다
+            if (opt.bot_identifier_prefixes.empty()) {
+                util::Logger::instance().warn("[Startup][", market, "] bot_identifier_prefixes is empty. skip cancel.");
                 return;
             }
 
+            const auto isBotOrder = [&opt](const core::Order& o) {
+                return o.identifier.has_value()
+                    && std::any_of(opt.bot_identifier_prefixes.begin(), opt.bot_identifier_prefixes.end(),
+                        [&o](const std::string& prefix) { return startsWithImpl(*o.identifier, prefix); });
+            };
+
             auto r = api.getOpenOrders(market);
             if (std::holds_alternative<api::rest::RestError>(r)) {
                 const auto& e = std::get<api::rest::RestError>(r);
-                util::Logger::instance().warn("[Startup] getOpenOrders failed: ", e.message);
+                util::Logger::instance().warn("[Startup][", market, "] getOpenOrders failed: ", e.message);
                 return;
             }
 
@@ -52,10 +59,7 @@ namespace app {
 
             for (const auto& o : open)
             {
-                if (!o.identifier.has_value())
-                    continue;
-
-                if (!startsWithImpl(*o.identifier, opt.bot_identifier_prefix))
+                if (!isBotOrder(o))
                     continue;
 
                 const std::optional<std::string> order_uuid =
@@ -73,11 +77,11 @@ namespace app {
 
                 if (ok) {
                     ++cancel_count;
-                    util::Logger::instance().info("[Startup] cancel ok: order_uuid=", o.id,
+                    util::Logger::instance().info("[Startup][", market, "] cancel ok: order_uuid=", o.id,
                                                   " identifier=", *o.identifier);
                 }
                 else {
-                    util::Logger::instance().warn("[Startup] cancel failed: order_uuid=", o.id,
+                    util::Logger::instance().warn("[Startup][", market, "] cancel failed: order_uuid=", o.id,
                                                   " identifier=", *o.identifier);
                 }
             }
@@ -90,35 +94,21 @@ namespace app {
 
                 const auto remain = std::get<std::vector<core::Order>>(std::move(rr));
 
-                const bool anyBotRemain = std::any_of(remain.begin(), remain.end(),
-                    [&](const core::Order& o) {
-                        return o.identifier.has_value()
-                            && startsWithImpl(*o.identifier, opt.bot_identifier_prefix);
-                    });
+                const bool anyBotRemain = std::any_of(remain.begin(), remain.end(), isBotOrder);
 
                 if (!anyBotRemain)
                     break;
 
-                util::Logger::instance().info("[Startup] bot open orders remain. re-check #", (v + 1));
+                util::Logger::instance().info("[Startup][", market, "] bot open orders remain. re-check #", (v + 1));
             }
 
-            util::Logger::instance().info("[Startup] cancelBotOpenOrders done. cancel_count=", cancel_count);
+            util::Logger::instance().info("[Startup][", market, "] cancelBotOpenOrders done. cancel_count=", cancel_count);
         }
 
-        template <class ApiT>
-        trading::PositionSnapshot buildPositionSnapshotImpl(ApiT& api, std::string_view market)
+        trading::PositionSnapshot positionFromAccount(const core::Account& acc, std::string_view market)
         {
             trading::PositionSnapshot pos{};
 
-            auto ar = api.getMyAccount();
-            if (std::holds_alternative<api::rest::RestError>(ar)) {
-                const auto& e = std::get<api::rest::RestError>(ar);
-                util::Logger::instance().warn("[Startup] getMyAccount failed: ", e.message);
-                return pos;
-            }
-
-            const auto acc = std::get<core::Account>(std::move(ar));
-
             const std::string_view base = baseCurrencyImpl(market);
             const std::string_view unit = unitCurrencyImpl(market);
 
@@ -144,6 +134,19 @@ namespace app {
             return pos;
         }
 
+        template <class ApiT>
+        trading::PositionSnapshot buildPositionSnapshotImpl(ApiT& api, std::string_view market)
+        {
+            auto ar = api.getMyAccount();
+            if (std::holds_alternative<api::rest::RestError>(ar)) {
+                const auto& e = std::get<api::rest::RestError>(ar);
+                util::Logger::instance().warn("[Startup] getMyAccount failed: ", e.message);
+                return trading::PositionSnapshot{};
+            }
+
+            return positionFromAccount(std::get<core::Account>(ar), market);
+        }
+
     } // anonymous namespace
 
     // 클래스 메서드는 내부 헬퍼에 위임
@@ -190,5 +193,12 @@ namespace app {
         return buildPositionSnapshotImpl(api, market);
     }
 
+    // 이미 조회한 계좌 재사용 (마켓 수만큼 getMyAccount 반복 방지)
+    trading::PositionSnapshot StartupRecovery::buildPositionSnapshot(
+        const core::Account& account, std::string_view market)
+    {
+        return positionFromAccount(account, market);
+    }
+
 } // namespace app
 
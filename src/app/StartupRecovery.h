@@ -2,9 +2,11 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "api/upbit/UpbitExchangeRestClient.h"
 #include "api/upbit/IOrderApi.h"
+#include "core/domain/Account.h"
 #include "trading/strategies/StrategyTypes.h"
 
 namespace app {
@@ -22,10 +24,10 @@ namespace app {
     class StartupRecovery final {
     public:
         struct Options {
-            // 봇 주문만 취소하기 위한 prefix
+            // 봇 주문만 취소하기 위한 prefix (마켓의 전략마다 1개, 하나라도 맞으면 봇 주문)
             // 예) "rsi_mean_reversion:KRW-BTC:"
             // strategy_id + ":" + market + ":" 형태로 고정
-            std::string bot_identifier_prefix;
+            std::vector<std::string> bot_identifier_prefixes;
 
             int cancel_retry = 1;
             int verify_retry = 1;
@@ -58,12 +60,21 @@ namespace app {
             strategy.syncOnStart(pos);
         }
 
-    private:
-        // 미체결 주문 중 "봇 prefix"가 붙은 주문만 취소한다
-        static void cancelBotOpenOrders(api::rest::UpbitExchangeRestClient& api,
+        // 단계 분리 사용 (MarketEngineManager 병렬 시작):
+        //   1) 마켓별 cancelBotOpenOrders를 동시에 실행
+        //   2) 계좌를 1회만 조회
+        //   3) 같은 Account로 마켓별 buildPositionSnapshot → syncOnStart
+        // 미체결 주문 중 "봇 prefix"가 붙은 주문만 취소한다 (여러 스레드에서 호출 가능, api가 thread-safe면)
+        static void cancelBotOpenOrders(api::upbit::IOrderApi& api,
             std::string_view market,
             const Options& opt);
-        static void cancelBotOpenOrders(api::upbit::IOrderApi& api,
+
+        // 이미 조회한 계좌에서 해당 market의 포지션 스냅샷 생성 (REST 호출 없음)
+        static trading::PositionSnapshot buildPositionSnapshot(const core::Account& account,
+            std::string_view market);
+
+    private:
+        static void cancelBotOpenOrders(api::rest::UpbitExchangeRestClient& api,
             std::string_view market,
             const Options& opt);
 
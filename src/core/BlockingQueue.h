@@ -1,7 +1,9 @@
 ﻿// core/concurrency/BlockingQueue.h
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <mutex>
 #include <optional>
@@ -11,6 +13,8 @@ namespace core
     // 스레드 안전 블로킹 큐(Blocking Queue)
     // - pop()은 데이터가 들어올 때까지 대기한다.
     // - max_size_가 설정되어 있으면, 초과 시 가장 오래된 데이터를 버린다(FIFO drop-oldest).
+    // - push_priority: 별도 우선 레인(크기 제한/drop 없음), pop 시 일반 레인보다 먼저 나감
+    // - push_latest: 아직 큐에 남은 이전 push_latest 원소를 제자리에서 덮어씀 (최신값만 의미 있는 스냅샷용)
     template <typename T>
     class BlockingQueue final
     {
@@ -28,27 +32,49 @@ namespace core
             {
                 std::lock_guard<std::mutex> lk(mu_);
 
-                // 최대 크기를 초과하면 가장 오래된 원소를 제거
-                if (max_size_ > 0 && q_.size() >= max_size_)
+                pushBack_(std::move(v));
+            }
+            cv_.notify_one();
+        }
+
+        // 우선 레인 push: drop-oldest 대상이 아니며 일반 레인보다 먼저 pop됨
+        // (유실되면 안 되는 소량 이벤트 전용 - 크기 제한 없음)
+        void push_priority(T v)
+        {
+            {
+                std::lock_guard<std::mutex> lk(mu_);
+                urgent_.push_back(std::move(v));
+                updateSizeHint_();
+            }
+            cv_.notify_one();
+        }
+
+        // 최신값 push: 이전 push_latest 원소가 아직 일반 레인에 있으면 그 자리를 덮어씀 (큐 길이 불변)
+        // 없으면(이미 pop/drop됨) 일반 push와 동일
+        void push_latest(T v)
+        {
+            {
+                std::lock_guard<std::mutex> lk(mu_);
+                if (latest_seq_ && *latest_seq_ >= head_seq_)
                 {
-                    q_.pop_front();  // FIFO: 가장 먼저 들어온 요소를 제거
+                    q_[static_cast<std::size_t>(*latest_seq_ - head_seq_)] = std::move(v);
+                    coalesced_.fetch_add(1, std::memory_order_relaxed);
+                    return;     // 대기 중인 원소 수는 그대로 → 깨울 필요 없음
                 }
-
-                q_.push_back(std::move(v));
+                pushBack_(std::move(v));
+                latest_seq_ = head_seq_ + q_.size() - 1;
             }
             cv_.notify_one();
         }
 
         // 즉시 꺼내기(대기하지 않음)
         // - 비어 있으면 nullopt 반환
-        // - 비어 있지 않으면 front를 꺼내서 반환
+        // - 비어 있지 않으면 front를 꺼내서 반환 (우선 레인 먼저)
         std::optional<T> try_pop()
         {
             std::lock_guard<std::mutex> lk(mu_);
-            if (q_.empty()) return std::nullopt;
-            T v = std::move(q_.front());
-            q_.pop_front();
-            return v;
+            if (empty_()) return std::nullopt;
+            return popFront_();
         }
 
         // 블로킹 pop: 데이터가 들어올 때까지 대기 후 1개 반환
@@ -69,35 +95,99 @@ namespace core
         {
             std::unique_lock<std::mutex> lk(mu_);
 
-            if (!cv_.wait_for(lk, timeout, [&] { return !q_.empty(); }))
+            if (!cv_.wait_for(lk, timeout, [&] { return !empty_(); }))
             {
                 // timeout
                 return std::nullopt;
             }
 
-            T v = std::move(q_.front());
-            q_.pop_front();
-            return v;
+            return popFront_();
         }
 
         std::size_t size() const
         {
             std::lock_guard<std::mutex> lk(mu_);
-            return q_.size();
+            return urgent_.size() + q_.size();
         }
 
         void clear()
         {
             std::lock_guard<std::mutex> lk(mu_);
+            head_seq_ += q_.size();
             q_.clear();
+            urgent_.clear();
+            size_hint_.store(0, std::memory_order_relaxed);
+        }
+
+        // 락 없이 읽는 근사 크기 (모니터링/메트릭 전용 - 생산/소비 경로와 경합하지 않음)
+        std::size_t approxSize() const noexcept
+        {
+            return size_hint_.load(std::memory_order_relaxed);
+        }
+
+        // drop-oldest로 버려진 누적 개수
+        std::uint64_t droppedCount() const noexcept
+        {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+        // push_latest가 대기 중 원소를 덮어쓴 누적 개수
+        std::uint64_t coalescedCount() const noexcept
+        {
+            return coalesced_.load(std::memory_order_relaxed);
         }
 
     private:
+        // 이하 mu_ 보유 상태에서 호출
+
+        bool empty_() const noexcept { return urgent_.empty() && q_.empty(); }
+
+        void updateSizeHint_() noexcept
+        {
+            size_hint_.store(urgent_.size() + q_.size(), std::memory_order_relaxed);
+        }
+
+        // 일반 레인 push (최대 크기를 초과하면 가장 오래된 원소를 제거)
+        void pushBack_(T v)
+        {
+            if (max_size_ > 0 && q_.size() >= max_size_)
+            {
+                q_.pop_front();  // FIFO: 가장 먼저 들어온 요소를 제거
+                ++head_seq_;
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            q_.push_back(std::move(v));
+            updateSizeHint_();
+        }
+
+        // 비어 있지 않을 때만 호출: 우선 레인 → 일반 레인 순
+        T popFront_()
+        {
+            std::deque<T>& lane = urgent_.empty() ? q_ : urgent_;
+            T v = std::move(lane.front());
+            lane.pop_front();
+            if (&lane == &q_) ++head_seq_;
+            updateSizeHint_();
+            return v;
+        }
+
         mutable std::mutex mu_;
         std::condition_variable cv_;
         std::deque<T> q_;
+        std::deque<T> urgent_;      // push_priority 전용 (drop 없음)
 
         // 0 = 무제한, >0 = 최대 크기(초과 시 오래된 요소 제거)
         const std::size_t max_size_;
+
+        // push_latest 위치 추적: head_seq_ = 일반 레인에서 빠져나간(pop/drop) 누적 수
+        // latest_seq_ = 마지막 push_latest 원소의 누적 순번 (< head_seq_이면 이미 빠져나감)
+        std::uint64_t head_seq_{ 0 };
+        std::optional<std::uint64_t> latest_seq_;
+
+        // 메트릭용 카운터 (mu_ 안에서만 갱신, 읽기는 락 없이)
+        std::atomic<std::size_t> size_hint_{ 0 };
+        std::atomic<std::uint64_t> dropped_{ 0 };
+        std::atomic<std::uint64_t> coalesced_{ 0 };
     };
 }
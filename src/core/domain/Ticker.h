@@ -34,6 +34,7 @@ namespace core {
         Volume				trade_volume;			        // 해당 페어의 최근 거래량
         Volume				acc_trade_volume;		        // 해당 페어의 누적 거래량 (UTC 0시부터 누적)
         Volume				acc_trade_volume_24h;	        // 해당 페어의 24시간 누적 거래량
+        Amount				acc_trade_price_24h{ 0 };	    // 해당 페어의 24시간 누적 거래대금 (KRW)
 
 
         std::chrono::system_clock::time_point timestamp; // 정보가 들어온 시각
@@ -1,5 +1,6 @@
 ﻿#include "database/Database.h"
 #include "database/sqlite3.h"
+#include "util/LatencyHistogram.h"
 #include "util/Logger.h"
 
 #include <algorithm>
@@ -10,6 +11,29 @@
 
 namespace db {
 
+namespace {
+
+// insert 1회의 소요 시간/성공 여부를 Stats에 반영 (조기 return은 실패로 집계)
+struct WriteScope {
+    Database::Stats& st;
+    const int64_t start_ns = util::monoNowNs();
+    bool ok = false;
+
+    ~WriteScope()
+    {
+        const auto elapsed = static_cast<uint64_t>(std::max<int64_t>(0, util::monoNowNs() - start_ns));
+        st.writes.fetch_add(1, std::memory_order_relaxed);
+        st.write_ns_total.fetch_add(elapsed, std::memory_order_relaxed);
+        if (!ok) st.write_failures.fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t prev = st.write_ns_max.load(std::memory_order_relaxed);
+        while (prev < elapsed &&
+            !st.write_ns_max.compare_exchange_weak(prev, elapsed, std::memory_order_relaxed)) {}
+    }
+};
+
+} // namespace
+
 // ─── 스키마 (schema.sql의 embed 버전 — 런타임 파일 의존 없음) ────────────────
 // schema.sql과 동기화를 유지할 것. 변경 시 두 파일 모두 수정
 static constexpr const char* kSchema = R"SQL(
@@ -61,6 +85,8 @@ CREATE TABLE IF NOT EXISTS signals (
     trend_strength REAL,
     is_partial     INTEGER NOT NULL DEFAULT 0 CHECK (is_partial IN (0, 1)),
     exit_reason  TEXT,               -- SELL 청산 사유. 단일/복합 조합 가능 (ex. exit_stop_target). BUY는 NULL
+    expected_price        REAL,      -- 제출 전 호가 기반 예상 VWAP (호가 미구독 시 NULL)
+    expected_slippage_bps REAL,      -- 제출 전 예상 슬리피지 (최우선 호가 대비 bps)
     ts_ms        INTEGER NOT NULL
 );
 
@@ -150,6 +176,10 @@ void Database::initSchema()
                  nullptr, nullptr, nullptr);
     sqlite3_exec(db_, "ALTER TABLE signals ADD COLUMN trend_strength REAL;",
                  nullptr, nullptr, nullptr);
+    sqlite3_exec(db_, "ALTER TABLE signals ADD COLUMN expected_price REAL;",
+                 nullptr, nullptr, nullptr);
+    sqlite3_exec(db_, "ALTER TABLE signals ADD COLUMN expected_slippage_bps REAL;",
+                 nullptr, nullptr, nullptr);
 
     // candles unit 마이그레이션:
     // unit 컬럼이 없으면 테이블 재작성 — UNIQUE 제약 변경은 ALTER TABLE로 불가
@@ -255,6 +285,8 @@ int64_t Database::normalizeToEpochMs(const std::string& s)
 
 bool Database::insertCandle(const std::string& market, const core::Candle& c, int unit) 
 {
+    WriteScope scope{ stats_ };
+
     if (!db_) {
         util::log().warn("[DB] insertCandle: DB is not open");
         return false;
@@ -292,6 +324,7 @@ bool Database::insertCandle(const std::string& market, const core::Candle& c, in
 
 	// stmt 객체를 해제한다 (메모리 누수 방지)
     sqlite3_finalize(stmt);
+    scope.ok = ok;
     return ok;
 }
 
@@ -299,6 +332,8 @@ bool Database::insertCandle(const std::string& market, const core::Candle& c, in
 
 bool Database::insertOrder(const core::Order& o) 
 {
+    WriteScope scope{ stats_ };
+
     if (!db_) 
     {
         util::log().warn("[DB] insertOrder: DB is not open");
@@ -355,6 +390,7 @@ bool Database::insertOrder(const core::Order& o)
     if (!ok) util::log().warn("[DB] insertOrder step failed: ", sqlite3_errmsg(db_));
 
     sqlite3_finalize(stmt);
+    scope.ok = ok;
     return ok;
 }
 
@@ -362,6 +398,8 @@ bool Database::insertOrder(const core::Order& o)
 
 bool Database::insertSignal(const trading::SignalRecord& sig)       
 {
+    WriteScope scope{ stats_ };
+
     if (!db_) 
     {
         util::log().warn("[DB] insertSignal: DB is not open");
@@ -371,8 +409,9 @@ bool Database::insertSignal(const trading::SignalRecord& sig)
     static constexpr const char* sql =
         "INSERT INTO signals "
         "(market, identifier, side, price, volume, krw_amount, "
-        " stop_price, target_price, rsi, volatility, trend_strength, is_partial, exit_reason, ts_ms) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+        " stop_price, target_price, rsi, volatility, trend_strength, is_partial, exit_reason, ts_ms,"
+        " expected_price, expected_slippage_bps) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
 
     sqlite3_stmt* stmt = nullptr;
     if (sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr) != SQLITE_OK)
@@ -406,10 +445,14 @@ bool Database::insertSignal(const trading::SignalRecord& sig)
 
     sqlite3_bind_int64(stmt, 14, sig.ts_ms);
 
+    sig.expected_price        ? sqlite3_bind_double(stmt, 15, *sig.expected_price)        : sqlite3_bind_null(stmt, 15);
+    sig.expected_slippage_bps ? sqlite3_bind_double(stmt, 16, *sig.expected_slippage_bps) : sqlite3_bind_null(stmt, 16);
+
     const bool ok = (sqlite3_step(stmt) == SQLITE_DONE);
     if (!ok) util::log().warn("[DB] insertSignal step failed: ", sqlite3_errmsg(db_));
 
     sqlite3_finalize(stmt);
+    scope.ok = ok;
     return ok;
 }
 
@@ -5,6 +5,7 @@
 // - WAL 모드: Streamlit 읽기와 봇 쓰기가 서로 차단하지 않음
 // - 모든 write는 이벤트 처리 완료 후 inter-event 구간에서 동기 수행
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 
@@ -47,9 +48,22 @@ public:
     // 반환: true=성공, false=prepare/step 실패
     bool insertSignal(const trading::SignalRecord& sig);
 
+    // 쓰기 통계 (여러 워커가 동시 호출 → atomic RMW, 읽기는 락 없이)
+    // write는 이벤트 처리 경로에서 동기 수행되므로 write 소요 시간이 곧 DB 지연
+    struct Stats {
+        std::atomic<uint64_t> writes{0};          // insert 호출 수
+        std::atomic<uint64_t> write_failures{0};  // 미오픈/prepare/step 실패 수
+        std::atomic<uint64_t> write_ns_total{0};  // 누적 소요 시간 (ns)
+        std::atomic<uint64_t> write_ns_max{0};    // 최대 소요 시간 (ns)
+    };
+
+    const Stats& stats() const noexcept { return stats_; }
+
 private:
     sqlite3* db_{ nullptr };
 
+    Stats stats_;
+
     // 단순 SQL 실행 (스키마 초기화·PRAGMA 전용)
     void exec(const char* sql);
 
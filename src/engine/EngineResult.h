@@ -6,6 +6,7 @@
 #include "core/domain/Order.h"
 #include "core/domain/MyTrade.h"
 #include "core/domain/Account.h"
+#include "marketdata/SlippageEstimator.h"
 
 /*
 * 주문 엔진 처리 결과 객체
@@ -48,6 +49,10 @@ namespace engine
 		// -- 메시지 (디버그/로그) --
 		std::string message;
 
+		// -- 시장가 사전 추정 (호가 구독 시, 실제 제출 크기 기준) --
+		std::optional<marketdata::SlippageEstimate> slippage;
+		bool clipped{ false };							// 슬리피지 예산으로 주문 크기를 줄였는지
+
 		// 성공과 실패를 쉽게 생성하는 헬퍼
 		// - 의미적으로 올바른 상태를 강제
 		// - 엔진 구현 코드가 압도적으로 읽기 쉬워짐
@@ -66,7 +71,9 @@ namespace engine
 				std::move(order),
 				std::move(trade),
 				std::move(account),
-				{}
+				{},
+				std::nullopt,
+				false
 			};
 		}
 
@@ -83,7 +90,9 @@ namespace engine
 				std::nullopt,
 				std::nullopt,
 				std::nullopt,
-				std::move(msg)
+				std::move(msg),
+				std::nullopt,
+				false
 			};
 		}
 	};
@@ -5,6 +5,7 @@
 #include <variant>
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -20,8 +21,14 @@ namespace engine
                                trading::allocation::AccountManager& account_mgr)
         : market_(std::move(market))
         , api_(api)
-        , store_(store)
+        , orders_(store.forMarket(market_))
         , account_mgr_(account_mgr)
+        , balances_(account_mgr.publishedBalances(market_))
+        , seen_trades_(util::AppConfig::instance().engine.max_seen_trades)
+        , max_slippage_bps_(util::AppConfig::instance().engine.max_slippage_bps)
+        , slippage_clip_(util::AppConfig::instance().engine.slippage_clip)
+        , max_book_age_ms_(util::AppConfig::instance().engine.max_book_age_ms)
+        , min_notional_krw_(util::AppConfig::instance().strategy.min_notional_krw)
     {
     }
 
@@ -40,25 +47,37 @@ namespace engine
         if (owner_thread_ == std::thread::id{} || std::this_thread::get_id() != owner_thread_)
         {
             util::Logger::instance().error("[Fatal] MarketEngine[", market_, "] called from non-owner thread");
+            util::Logger::instance().flush();   // 비동기 로거: terminate 전에 출력 보장
             std::terminate();
         }
 #endif
     }
 
     // ========== submit ==========
-    EngineResult MarketEngine::submit(const core::OrderRequest& req)
+    EngineResult MarketEngine::submit(const core::OrderRequest& request)
     {
         assertOwner_();
 
         // 1) 주문 요청(req) 검증
         std::string reason;
-        if (!validateRequest(req, reason))
+        if (!validateRequest(request, reason))
             return EngineResult::Fail(EngineErrorCode::OrderRejected, reason);
 
         // 2) 마켓 범위 검증
-        if (req.market != market_)
+        if (request.market != market_)
             return EngineResult::Fail(EngineErrorCode::MarketNotSupported,
-                "market mismatch: expected " + market_ + ", got " + req.market);
+                "market mismatch: expected " + market_ + ", got " + request.market);
+
+        // 2-1) 시장가: 호가 기반 슬리피지 추정 + 예산 적용 (예약 금액 계산 전에 크기 확정)
+        std::optional<core::OrderRequest> clipped;
+        std::optional<marketdata::SlippageEstimate> slippage;
+        if (!applySlippageBudget_(request, clipped, slippage, reason))
+        {
+            auto fail = EngineResult::Fail(EngineErrorCode::OrderRejected, reason);
+            fail.slippage = slippage;
+            return fail;
+        }
+        const core::OrderRequest& req = clipped ? *clipped : request;
 
         // 3) BUY: KRW 예약, SELL: 중복 체크
         if (req.position == core::OrderPosition::BID)
@@ -145,9 +164,90 @@ namespace engine
         o.status = core::OrderStatus::Pending;
         o.created_at = "";
 
-        store_.upsert(o);
+        orders_.upsert(o);
+
+        auto ok = EngineResult::Success(std::move(o));
+        ok.slippage = slippage;
+        ok.clipped = clipped.has_value();
+        return ok;
+    }
+
+    // ========== applySlippageBudget_ ==========
+    bool MarketEngine::applySlippageBudget_(const core::OrderRequest& req,
+                                            std::optional<core::OrderRequest>& clipped,
+                                            std::optional<marketdata::SlippageEstimate>& estimate,
+                                            std::string& reason) const
+    {
+        if (req.type != core::OrderType::Market || !book_ || !book_->valid())
+            return true;
+
+        // 북 시각은 거래소 timestamp(epoch ms) → 로컬 wall clock과 비교
+        const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        if (max_book_age_ms_ > 0 && now_ms - book_->timestampMs() > max_book_age_ms_)
+            return true;
+
+        const bool buy = req.position == core::OrderPosition::BID;
+        const bool by_amount = std::holds_alternative<core::AmountSize>(req.size);
+        const double size = by_amount ? std::get<core::AmountSize>(req.size).value
+                                      : std::get<core::VolumeSize>(req.size).value;
+
+        // 시장가 매수 = 금액 기준, 매도 = 수량 기준 (validateRequest에서 보장)
+        estimate = buy ? marketdata::estimateBuyByAmount(*book_, size)
+                       : marketdata::estimateSellByVolume(*book_, size);
+
+        if (max_slippage_bps_ <= 0.0 || (estimate->slippage_bps <= max_slippage_bps_ && !estimate->exhausted))
+            return true;
+
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(1)
+            << "slippage budget exceeded: est=" << estimate->slippage_bps << "bps max=" << max_slippage_bps_
+            << "bps levels=" << estimate->levels_used << (estimate->exhausted ? " (book exhausted)" : "");
+
+        // 매도 = 청산 (전량 거래 모델) → 예산 초과여도 거절하지 않음 (줄일 수 있으면 줄여서 제출)
+        // 진입(매수)만 거절 대상
+        if (!slippage_clip_)
+        {
+            if (buy)
+            {
+                reason = oss.str();
+                return false;
+            }
+            util::Logger::instance().warn("[MarketEngine][", market_, "] ", oss.str(),
+                " -> exit submitted unclipped");
+            return true;
+        }
+
+        // 예산 안에서 체결 가능한 최대 크기로 축소 (남은 물량은 전략의 다음 신호에서 다시 판단)
+        const double within = buy ? marketdata::maxBuyAmountWithin(*book_, max_slippage_bps_)
+                                  : marketdata::maxSellVolumeWithin(*book_, max_slippage_bps_);
+        const double clipped_size = std::min(size, within);
+        const double clipped_notional = buy ? clipped_size : clipped_size * book_->bestBid();
+        if (clipped_notional < min_notional_krw_)
+        {
+            oss << ", clipped size below min notional";
+            if (buy)
+            {
+                reason = oss.str();
+                return false;
+            }
+            util::Logger::instance().warn("[MarketEngine][", market_, "] ", oss.str(),
+                " -> exit submitted unclipped");
+            return true;
+        }
+
+        clipped = req;
+        if (by_amount)
+            clipped->size = core::AmountSize{ clipped_size };
+        else
+            clipped->size = core::VolumeSize{ clipped_size };
 
-        return EngineResult::Success(std::move(o));
+        estimate = buy ? marketdata::estimateBuyByAmount(*book_, clipped_size)
+                       : marketdata::estimateSellByVolume(*book_, clipped_size);
+
+        util::Logger::instance().warn("[MarketEngine][", market_, "] ", oss.str(),
+            " -> clipped ", size, " to ", clipped_size);
+        return true;
     }
 
     // ========== onMyTrade ==========
@@ -160,13 +260,25 @@ namespace engine
             return;
 
         // 중복 방지
-        const std::string dedupeKey = makeTradeDedupeKey_(t);
+        // trade_uuid가 있으면 복사 없이 그대로 사용, 없을 때만 fallback 키 생성
+        std::string fallbackKey;
+        std::string_view dedupeKey = t.trade_uuid;
+        if (dedupeKey.empty())
+        {
+            fallbackKey = makeTradeDedupeKey_(t);
+            dedupeKey = fallbackKey;
+        }
         if (!markTradeOnce(dedupeKey))
             return;
 
         // 1) OrderStore에서 주문 조회 (외부 주문 거부 정책)
-        auto ordOpt = store_.get(t.order_uuid);
-        if (!ordOpt.has_value())
+        // identifier 확인 (EngineFillEvent 발행용) - Order 복사 없이 필요한 필드만 읽음
+        std::optional<std::string> id = t.identifier;
+        const bool known = orders_.visit(t.order_uuid, [&](const core::Order& o) {
+            if (!id.has_value())
+                id = o.identifier;
+        });
+        if (!known)
         {
             // 이 엔진이 제출하지 않은 주문 (외부 주문)
             util::Logger::instance().warn(
@@ -175,18 +287,13 @@ namespace engine
             return;
         }
 
-        // identifier 확인 (EngineFillEvent 발행용)
-        std::optional<std::string> id = t.identifier;
-        if (!id.has_value())
-            id = ordOpt->identifier;
-
         // 2) EngineFillEvent 발행
         if (id.has_value() && !id->empty())
         {
             EngineFillEvent ev;
             ev.identifier = *id;
             ev.order_uuid = t.order_uuid;
-            ev.trade_uuid = t.trade_uuid.empty() ? dedupeKey : t.trade_uuid;
+            ev.trade_uuid = std::string(dedupeKey);
             ev.position = t.side;
             ev.fill_price = t.price;
             ev.filled_volume = t.volume;
@@ -229,102 +336,94 @@ namespace engine
         if (!snapshot.market.empty() && snapshot.market != market_)
             return;
 
-		// 바로 체결되어 store에 없으면 그냥 데이터 넣고 종료
-        auto ordOpt = store_.get(snapshot.id);
-        if (!ordOpt.has_value())
-        {
-			// store에 없는 주문은 이 엔진이 제출한 주문이 아닐 가능성이 높음 (외부 주문 또는 store 누락)
-            return;
-        }
+        // 기존에 부분 체결된 주문을 스냅샷으로 제자리 업데이트 (Order 복사 없음)
+        // 터미널 도달 시에만 이벤트/정산용으로 복사본을 남긴다
+        core::OrderStatus old_status{};
+        std::optional<core::Order> terminal;
 
-        // 기존에 부분 체결된 주문을 스냅샷으로 업데이트
-        auto o = *ordOpt;
-        const core::OrderStatus old_status = o.status;
+        const bool known = orders_.modify(snapshot.id, [&](core::Order& o) {
+            old_status = o.status;
 
-        // 스냅샷 필드 동기화
-        if (!snapshot.market.empty()) o.market = snapshot.market;
-        o.position = snapshot.position;
-        o.type = snapshot.type;
+            // 스냅샷 필드 동기화 (market은 shard 키이므로 변경하지 않음)
+            o.position = snapshot.position;
+            o.type = snapshot.type;
 
-        // price: 지정가에서만 업데이트 허용, 이미 있으면 유지 (요청 원본 불변 정책)
-        // Market 주문은 wait 스냅샷에서 price=주문총액이 오더라도 차단 (requested_amount로 관리)
-        if (!o.price.has_value() && snapshot.price.has_value()
-            && o.type == core::OrderType::Limit)
-            o.price = snapshot.price;
+            // price: 지정가에서만 업데이트 허용, 이미 있으면 유지 (요청 원본 불변 정책)
+            // Market 주문은 wait 스냅샷에서 price=주문총액이 오더라도 차단 (requested_amount로 관리)
+            if (!o.price.has_value() && snapshot.price.has_value()
+                && o.type == core::OrderType::Limit)
+                o.price = snapshot.price;
 
-        // volume: 최초 설정 후 유지
-        if (!o.volume.has_value() && snapshot.volume.has_value())
-            o.volume = snapshot.volume;
+            // volume: 최초 설정 후 유지
+            if (!o.volume.has_value() && snapshot.volume.has_value())
+                o.volume = snapshot.volume;
 
-        o.executed_volume = snapshot.executed_volume;
-        o.remaining_volume = snapshot.remaining_volume;
-        o.trades_count = snapshot.trades_count;
+            o.executed_volume = snapshot.executed_volume;
+            o.remaining_volume = snapshot.remaining_volume;
+            o.trades_count = snapshot.trades_count;
 
-        o.reserved_fee = snapshot.reserved_fee;
-        o.remaining_fee = snapshot.remaining_fee;
-        o.paid_fee = snapshot.paid_fee;
-        o.locked = snapshot.locked;
-        o.executed_funds = snapshot.executed_funds;  // 누적 체결 금액 동기화
+            o.reserved_fee = snapshot.reserved_fee;
+            o.remaining_fee = snapshot.remaining_fee;
+            o.paid_fee = snapshot.paid_fee;
+            o.locked = snapshot.locked;
+            o.executed_funds = snapshot.executed_funds;  // 누적 체결 금액 동기화
 
-        o.status = snapshot.status;
+            o.status = snapshot.status;
 
-        // identifier: 기존 유지, 없으면 스냅샷에서 채움
-        if (!o.identifier.has_value() && snapshot.identifier.has_value())
-            o.identifier = snapshot.identifier;
+            // identifier: 기존 유지, 없으면 스냅샷에서 채움
+            if (!o.identifier.has_value() && snapshot.identifier.has_value())
+                o.identifier = snapshot.identifier;
 
-        if (!snapshot.created_at.empty())
-            o.created_at = snapshot.created_at;
+            if (!snapshot.created_at.empty())
+                o.created_at = snapshot.created_at;
 
-        if (!store_.update(o))
-        {
-            util::Logger::instance().warn(
-                "[MarketEngine][", market_, "] update miss in onOrderSnapshot, skip: order_uuid=", o.id);
+            if (o.isDone())
+                terminal = o;
+        });
+
+		// 바로 체결되어 store에 없으면 그냥 종료
+        // store에 없는 주문은 이 엔진이 제출한 주문이 아닐 가능성이 높음 (외부 주문 또는 store 누락)
+        if (!known || !terminal.has_value())
             return;
-        }
 
-        // 터미널 상태 도달 시 자산 정리 + 이벤트 발행 + store 제거
-        const bool isTerminal = (o.status == core::OrderStatus::Filled
-            || o.status == core::OrderStatus::Canceled
-            || o.status == core::OrderStatus::Rejected);
+        const core::Order& o = *terminal;
 
-        if (isTerminal)
+        // 터미널 상태 도달 시 자산 정리 + 이벤트 발행 + store 제거
+		// 동일 종결 상태 업데이트는 무시 (이벤트 중복 방지)
+        if (o.status != old_status)
         {
-			// 동일 종결 상태 업데이트는 무시 (이벤트 중복 방지)
-            if (o.status != old_status)
-            {
-                // BID 주문 터미널 → 현재 활성 주문인 경우에만 토큰 정리
-                if (o.position == core::OrderPosition::BID && o.id == active_buy_order_uuid_)
-                    finalizeBuyToken_(o.id);
+            // BID 주문 터미널 → 현재 활성 주문인 경우에만 토큰 정리
+            if (o.position == core::OrderPosition::BID && o.id == active_buy_order_uuid_)
+                finalizeBuyToken_(o.id);
 
-                // ASK 주문 터미널 → 현재 활성 주문인 경우에만 ID 정리
-                if (o.position == core::OrderPosition::ASK && o.id == active_sell_order_uuid_)
-                {
-                    // 매도 주문 종료 시점에만 dust/실현손익을 확정한다.
-                    // last_mark_price_가 0이면 nullopt로 전달 → 가치 기준 판정 생략 (수량 기준만 적용)
-                    std::optional<core::Price> mark =
-                        (last_mark_price_ > 0.0) ? std::optional<core::Price>(last_mark_price_) : std::nullopt;
-                    account_mgr_.finalizeSellOrder(market_, mark);
-                    active_sell_order_uuid_.clear();
-                }
-
-                if (o.identifier.has_value() && !o.identifier->empty())
-                {
-                    EngineOrderStatusEvent ev;
-                    ev.identifier = *o.identifier;
-                    ev.order_uuid = o.id;
-                    ev.status = o.status;
-                    ev.position = o.position;
-                    ev.executed_volume = o.executed_volume;
-                    ev.remaining_volume = o.remaining_volume;
-                    ev.executed_funds = o.executed_funds;  // WS 유실 시 전략 vwap 폴백용
-                    ev.position_effect = resolvePositionEffect_(o);
-                    pushEvent_(EngineEvent{ std::move(ev) });
-                }
+            // ASK 주문 터미널 → 현재 활성 주문인 경우에만 ID 정리
+            if (o.position == core::OrderPosition::ASK && o.id == active_sell_order_uuid_)
+            {
+                // 매도 주문 종료 시점에만 dust/실현손익을 확정한다.
+                // last_mark_price_가 0이면 nullopt로 전달 → 가치 기준 판정 생략 (수량 기준만 적용)
+                std::optional<core::Price> mark =
+                    (last_mark_price_ > 0.0) ? std::optional<core::Price>(last_mark_price_) : std::nullopt;
+                account_mgr_.finalizeSellOrder(market_, mark);
+                active_sell_order_uuid_.clear();
             }
 
-            // 터미널 주문은 store에서 즉시 제거 (활성 주문만 store에 유지하는 정책)
-            store_.erase(o.id);
+            if (o.identifier.has_value() && !o.identifier->empty())
+            {
+                EngineOrderStatusEvent ev;
+                ev.identifier = *o.identifier;
+                ev.order_uuid = o.id;
+                ev.status = o.status;
+                ev.position = o.position;
+                ev.executed_volume = o.executed_volume;
+                ev.remaining_volume = o.remaining_volume;
+                ev.executed_funds = o.executed_funds;  // WS 유실 시 전략 vwap 폴백용
+                ev.position_effect = resolvePositionEffect_(o);
+                pushEvent_(EngineEvent{ std::move(ev) });
+            }
         }
+
+        // 터미널 주문은 store에서 즉시 제거 (활성 주문만 store에 유지하는 정책)
+        orders_.erase(o.id);
     }
 
     // ========== pollEvents ==========
@@ -346,7 +445,7 @@ namespace engine
     std::optional<core::Order> MarketEngine::get(std::string_view order_uuid) const
     {
         assertOwner_();
-        return store_.get(order_uuid);
+        return orders_.get(order_uuid);
     }
 
     // ========== validateRequest ==========
@@ -451,9 +550,9 @@ namespace engine
         if (order.executed_volume <= 0.0)
             return core::PositionEffect::None;
 
-        const auto budget = account_mgr_.getBudget(market_);
         const auto& cfg = util::AppConfig::instance().account;
-        const bool has_coin = budget->coin_balance >= cfg.coin_epsilon;
+        const bool has_coin = balances_ != nullptr
+            && balances_->load().coin_balance >= cfg.coin_epsilon;
 
         if (order.position == core::OrderPosition::BID)
             return core::PositionEffect::Opened;  // executed_volume > 0 이면 진입 확정
@@ -505,8 +604,13 @@ namespace engine
             return false;
 
         // OrderStore에서 이전 누적값 조회
-        auto prev = store_.get(snapshot.id);
-        if (!prev.has_value())
+        double prev_volume = 0.0, prev_funds = 0.0, prev_paid_fee = 0.0;
+        const bool known = orders_.visit(snapshot.id, [&](const core::Order& o) {
+            prev_volume = o.executed_volume;
+            prev_funds = o.executed_funds;
+            prev_paid_fee = o.paid_fee;
+        });
+        if (!known)
         {
             util::Logger::instance().warn(
                 "[MarketEngine][", market_, "] reconcile: order not in store, id=", snapshot.id);
@@ -515,11 +619,11 @@ namespace engine
 
         // delta 계산 (음수 방어: 데이터 불일치 시 역정산 방지)
         const double delta_volume = std::max(0.0,
-            snapshot.executed_volume - prev->executed_volume);
+            snapshot.executed_volume - prev_volume);
         const double delta_funds = std::max(0.0,
-            snapshot.executed_funds - prev->executed_funds);
+            snapshot.executed_funds - prev_funds);
         const double delta_paid_fee = std::max(0.0,
-            snapshot.paid_fee - prev->paid_fee);
+            snapshot.paid_fee - prev_paid_fee);
 
         // delta > 0인 경우에만 AccountManager 정산
         if (delta_volume > 0.0)
@@ -629,20 +733,8 @@ namespace engine
         if (trade_uuid.empty())
             return false;
 
-		// unordeded_set에 trade_uuid 삽입 시도, 이미 존재하면 false 반환
-        auto [it, inserted] = seen_trade_uuids_.emplace(trade_uuid);
-        if (!inserted)
-            return false;
-
-        seen_trade_uuid_fifo_.push_back(*it);
-
-        while (seen_trade_uuid_fifo_.size() > util::AppConfig::instance().engine.max_seen_trades)
-        {
-            const std::string& oldest = seen_trade_uuid_fifo_.front();
-            seen_trade_uuids_.erase(oldest);
-            seen_trade_uuid_fifo_.pop_front();
-        }
-        return true;
+        // 고정 용량 테이블에 기록 (가득 차면 가장 오래된 키 제거), 이미 존재하면 false 반환
+        return seen_trades_.insert(trade_uuid);
     }
 }
 
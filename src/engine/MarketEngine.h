@@ -4,7 +4,6 @@
 #include <string>
 #include <string_view>
 #include <optional>
-#include <unordered_set>
 #include <deque>
 #include <vector>
 #include <thread>
@@ -13,8 +12,10 @@
 #include "core/domain/MyTrade.h"
 #include "core/domain/Order.h"
 #include "OrderStore.h"
+#include "TradeDedupeTable.h"
 #include "EngineResult.h"
 #include "EngineEvents.h"
+#include "marketdata/OrderBook.h"
 #include "api/upbit/IOrderApi.h"
 #include "trading/allocation/AccountManager.h"
 
@@ -77,11 +78,23 @@ namespace engine
         // finalizeSellOrder의 가치 기준 dust 판정에 사용된다
         void setMarkPrice(core::Price p) noexcept { last_mark_price_ = p; }
 
+        // 마켓 L2 북 주입 (호가 구독 시 MarketEngineManager가 1회 설정, 같은 워커 스레드에서만 갱신됨)
+        // 설정되면 시장가 submit 전에 슬리피지를 추정하고 EngineConfig 예산을 적용한다
+        void setOrderBook(const marketdata::OrderBook* book) noexcept { book_ = book; }
+
     private:
 		// 내부 주문 요청 검증 헬퍼(시장 스코프, 매수 토큰 중복 방지, 지정가 가격/수량 검증 등)
         // 주문 요청 최소 검증
         static bool validateRequest(const core::OrderRequest& req, std::string& reason) noexcept;
 
+        // 시장가 주문 슬리피지 추정 + 예산 적용
+        // 예산 초과 시 clipped에 축소된 요청을 채움, 거부해야 하면 false (reason 기록)
+        // 매도(청산)는 거부하지 않음: 줄일 수 없으면 원래 크기로 제출
+        bool applySlippageBudget_(const core::OrderRequest& req,
+                                  std::optional<core::OrderRequest>& clipped,
+                                  std::optional<marketdata::SlippageEstimate>& estimate,
+                                  std::string& reason) const;
+
         // 시장가 매수(AmountSize) / 지정가(price*volume)에서 예약 금액 계산
         static core::Amount computeReserveAmount(const core::OrderRequest& req);
 
@@ -97,7 +110,7 @@ namespace engine
         // 중복 체결 방지용 키 생성
         static std::string makeTradeDedupeKey_(const core::MyTrade& t);
 
-        // trade_uuid 중복 수신 방지 (FIFO 기반)
+        // trade_uuid 중복 수신 방지 (고정 용량 FIFO)
         bool markTradeOnce(std::string_view trade_uuid);
 
         // 매수 토큰 정리 (터미널 상태 도달 시 미사용 KRW 복구)
@@ -111,15 +124,15 @@ namespace engine
     private:
         std::string market_;
         api::upbit::IOrderApi& api_;
-        OrderStore& store_;
+        OrderStore::MarketOrders orders_;   // 공유 OrderStore 중 이 마켓 shard 핸들
         trading::allocation::AccountManager& account_mgr_;
+        const trading::allocation::PublishedBalances* balances_;  // 이 마켓 잔고 (락 없는 조회)
 
         // 엔진 단일 소유권을 위한 owner thread (thread id를 저장)
         std::thread::id owner_thread_{};
 
-        // 이미 처리한 trade_uuid 집합 (중복 방어)
-        std::unordered_set<std::string> seen_trade_uuids_;
-        std::deque<std::string> seen_trade_uuid_fifo_;
+        // 이미 처리한 trade_uuid 집합 (중복 방어, 최근 max_seen_trades개 FIFO)
+        TradeDedupeTable seen_trades_;
 
         // 이벤트 큐
         std::deque<EngineEvent> events_;
@@ -135,6 +148,13 @@ namespace engine
 
         // 가장 최근에 확정된 캔들의 close 가격 (finalizeSellOrder dust 판정용)
         core::Price last_mark_price_{0.0};
+
+        // 슬리피지 추정용 북 (nullptr이면 추정 생략) + EngineConfig 스냅샷
+        const marketdata::OrderBook* book_{nullptr};
+        double max_slippage_bps_{0.0};
+        bool slippage_clip_{true};
+        std::int64_t max_book_age_ms_{0};
+        double min_notional_krw_{0.0};
     };
 }
 
@@ -1,130 +1,188 @@
 #include "OrderStore.h"
-#include <mutex>
 
 namespace engine
 {
-	// "활성중인 주문" 판별 (업비트 스펙에 맞춘)
-		// - New/Open/Pending : 활성 중
-		// - Filled/Canceled/Rejected : 완료
-	constexpr bool isOpenStatus(core::OrderStatus s) noexcept
+	// ========== Shard (호출자가 unique lock 보유) ==========
+
+	// 새 주문을 빈 slot에 배치하고 인덱스 등록
+	bool OrderStore::Shard::insert(const core::Order& order)
 	{
-		using S = core::OrderStatus;
-		switch (s)
-		{
-		case S::New:
-		case S::Open:
-		case S::Pending:
-			return true;
-
-		case S::Filled:
-		case S::Canceled:
-		case S::Rejected:
+		// order_uuid는 반드시 키이므로, 비어있으면 추가 불가 (비어있는 값을 저장하는 건 이상함)
+		if (order.id.empty())
 			return false;
+
+		if (index.find(order.id) != index.end())
+			return false;	// 이미 존재하면 false
+
+		std::uint32_t slot_idx;
+		if (!free_slots.empty())
+		{
+			slot_idx = free_slots.back();
+			free_slots.pop_back();
+			slots[slot_idx].order = order;	// 기존 문자열 버퍼 재사용
+		}
+		else
+		{
+			slot_idx = static_cast<std::uint32_t>(slots.size());
+			slots.push_back(Slot{ order, false });
 		}
-		return false; // enum 확장 대비
+		slots[slot_idx].used = true;
+
+		index.emplace(order.id, slot_idx);
+		return true;
 	}
 
-	// 새 주문 추가
-	bool OrderStore::add(const core::Order& order)
+	// slot을 free list로 반환 (Order 객체는 다음 insert가 덮어씀)
+	bool OrderStore::Shard::erase(std::string_view order_uuid)
 	{
-		// 쓰기 작업이니 unique lock
-		std::unique_lock lock(mtx_);
-
-		// order_uuid는 반드시 키이므로, 비어있으면 추가 불가 (비어있는 값을 저장하는 건 이상함)
-		// 여기서는 Store의 책임범위로 판단함.
-		if (order.id.empty())
+		auto it = index.find(order_uuid);
+		if (it == index.end())
 			return false;
 
-		// it - 새로 추가된 요소의 iterator, inserted - 실제로 추가됐는지 여부
-		auto [it, inserted] = orders_.emplace(order.id, order);
-		return inserted;	// 이미 존재하면 false
+		const std::uint32_t slot_idx = it->second;
+		slots[slot_idx].used = false;
+		free_slots.push_back(slot_idx);
+		index.erase(it);
+		return true;
 	}
 
-	// order_uuid로 주문 조회(복사본)
-	std::optional<core::Order> OrderStore::get(const std::string_view& order_uuid) const
+	// ========== MarketOrders ==========
+
+	bool OrderStore::MarketOrders::add(const core::Order& order)
+	{
+		// 쓰기 작업이니 unique lock
+		std::unique_lock lock(shard_->mtx);
+		return shard_->insert(order);
+	}
+
+	std::optional<core::Order> OrderStore::MarketOrders::get(std::string_view order_uuid) const
 	{
 		// 읽기 작업이니 shared lock
-		std::shared_lock lock(mtx_);
+		std::shared_lock lock(shard_->mtx);
 
-		auto it = orders_.find(std::string(order_uuid));
-		if (it == orders_.end()) // 컨테이너에서 마지막 다음(즉 범위의 끝)
+		const core::Order* o = std::as_const(*shard_).find(order_uuid);
+		if (!o)
 			return std::nullopt;
 
 		// "복사본" 반환: 외부가 내부 Order를 임의로 변경할 수 없게 함
-		return it->second;
+		return *o;
 	}
 
-	// 주문 상태를 교체(update)
-	bool OrderStore::update(const core::Order& order)
+	bool OrderStore::MarketOrders::update(const core::Order& order)
 	{
-		// 쓰기 작업이니 unique lock
-		std::unique_lock lock(mtx_);
+		std::unique_lock lock(shard_->mtx);
 
-		auto it = orders_.find(order.id);
-		if (it == orders_.end())
+		core::Order* o = shard_->find(order.id);
+		if (!o)
 			return false;
 
-		// 전체 교체 - 지금 단계에서는 "부분 수정"보다 "통째 교체"가 단순하고 명확한 의미.
-		it->second = order;
-
+		// 전체 교체 - "부분 수정"이 필요하면 modify() 사용
+		*o = order;
 		return true;
 	}
 
-	// order_uuid로 주문 삭제
-	bool OrderStore::erase(const std::string_view& order_uuid)
+	bool OrderStore::MarketOrders::erase(std::string_view order_uuid)
 	{
-		// 쓰기 작업이니 unique lock
-		std::unique_lock lock(mtx_);
-
-		auto it = orders_.find(std::string(order_uuid));
-		if (it == orders_.end())
-			return false;
-
-		orders_.erase(it);
-		return true;
+		std::unique_lock lock(shard_->mtx);
+		return shard_->erase(order_uuid);
 	}
 
-	void OrderStore::upsert(const core::Order& order)
+	void OrderStore::MarketOrders::upsert(const core::Order& order)
 	{
 		// 없으면 추가, 있으면 교체함
 		// - 멱등성보장 - 재연결/REST 초기화/WS 순서꼬임 등을 안전하게 처리하기 위한 방식
-		std::unique_lock lock(mtx_);
+		std::unique_lock lock(shard_->mtx);
 		if (order.id.empty()) return;
 
-		orders_[order.id] = order;
+		if (core::Order* o = shard_->find(order.id))
+			*o = order;
+		else
+			shard_->insert(order);
 	}
 
-	// 특정 마켓에 활성중인(New/Open) 주문들 조회
-	std::vector<core::Order> OrderStore::getOpenOrdersByMarket(const std::string_view& market) const
+	std::vector<core::Order> OrderStore::MarketOrders::openOrders() const
 	{
-		// 읽기 작업이니 shared lock
-		std::shared_lock lock(mtx_);
-
 		std::vector<core::Order> result;
-		result.reserve(orders_.size()); // 넉넉하게 크기 예약
+		forEachOpen([&](const core::Order& o) { result.push_back(o); });
+		return result;
+	}
 
-		for (const auto& [id, order] : orders_)
-		{
-			// 1) 마켓 필터링 : "KRW-BTC" 같은 것만 뽑을 때 문자열 비교
-			if (std::string_view(order.market) != market)
-				continue;
+	std::size_t OrderStore::MarketOrders::size() const
+	{
+		std::shared_lock lock(shard_->mtx);
+		return shard_->index.size();
+	}
 
-			// 2) 아직 활성중인 주문만 반환
-			if(!isOpenStatus(order.status))
-				continue;
+	// ========== OrderStore ==========
 
-			// 3) 복사하여(복사본) 반환
-			result.push_back(order);
-		}
-		return result;
+	OrderStore::MarketOrders OrderStore::forMarket(std::string_view market)
+	{
+		// 대부분은 이미 존재 → shared lock으로 먼저 확인
+		if (Shard* s = findShard_(market))
+			return MarketOrders(s);
+
+		std::unique_lock lock(shards_mtx_);
+		auto [it, inserted] = shards_.try_emplace(std::string(market));
+		if (inserted)
+			it->second = std::make_unique<Shard>();
+		return MarketOrders(it->second.get());
+	}
+
+	OrderStore::Shard* OrderStore::findShard_(std::string_view market) const
+	{
+		std::shared_lock lock(shards_mtx_);
+		auto it = shards_.find(market);
+		return it == shards_.end() ? nullptr : it->second.get();
+	}
+
+	bool OrderStore::add(const core::Order& order)
+	{
+		if (order.id.empty() || order.market.empty())
+			return false;
+		return forMarket(order.market).add(order);
+	}
+
+	bool OrderStore::update(const core::Order& order)
+	{
+		Shard* s = findShard_(order.market);
+		return s ? MarketOrders(s).update(order) : false;
 	}
 
+	void OrderStore::upsert(const core::Order& order)
+	{
+		if (order.id.empty() || order.market.empty())
+			return;
+		forMarket(order.market).upsert(order);
+	}
+
+	std::optional<core::Order> OrderStore::get(std::string_view market, std::string_view order_uuid) const
+	{
+		Shard* s = findShard_(market);
+		return s ? MarketOrders(s).get(order_uuid) : std::nullopt;
+	}
+
+	bool OrderStore::erase(std::string_view market, std::string_view order_uuid)
+	{
+		Shard* s = findShard_(market);
+		return s ? MarketOrders(s).erase(order_uuid) : false;
+	}
+
+	// 특정 마켓에 활성중인(New/Open) 주문들 조회
+	// - 해당 마켓 shard만 순회 (다른 마켓 주문 문자열 비교 없음)
+	std::vector<core::Order> OrderStore::getOpenOrdersByMarket(std::string_view market) const
+	{
+		Shard* s = findShard_(market);
+		return s ? MarketOrders(s).openOrders() : std::vector<core::Order>{};
+	}
 
 	// 전체 주문 수
 	std::size_t OrderStore::size() const
 	{
-		// 읽기 작업이니 shared lock
-		std::shared_lock lock(mtx_);
-		return orders_.size();
+		std::shared_lock lock(shards_mtx_);
+
+		std::size_t total = 0;
+		for (const auto& [market, shard] : shards_)
+			total += MarketOrders(shard.get()).size();
+		return total;
 	}
 }
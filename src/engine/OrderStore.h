@@ -1,10 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "core/domain/Order.h"
@@ -17,49 +22,169 @@ namespace engine
 	 *
 	 * 설계 요구사항:
 	 * 1) 여러 외부(app/strategy)에서 동일 컨테이너에 접근 가능해야 함
-	 * 2) order_uuid 를 기준으로 찾을 수 있어야 함 (unordered_map)
+	 * 2) order_uuid 를 기준으로 찾을 수 있어야 함 (uuid -> slot 인덱스)
 	 * 3) get()은 "복사본"을 반환하여 외부가 내부 상태를 망가뜨릴 수 없게 함
+	 *    - 핫패스는 visit()/modify()로 복사 없이 제자리 접근
 	 * 4) update는 "전체 Order 객체" 교체 (단순하고 명확 의도)
-	 * 5) 멀티스레드 환경 대비 shared_mutex 사용(읽기 병렬, 쓰기 배타)
+	 * 5) 마켓별 shard: 각 마켓 주문은 해당 마켓 워커만 변경하므로 shard마다 독립 락
+	 *    (마켓 간 락 경합 없음, 읽기 병렬/쓰기 배타는 shard 단위 shared_mutex)
 	 *
-	 * 생명주기 정책: orders_에 존재 = 활성(New/Open/Pending) 주문
+	 * 생명주기 정책: shard에 존재 = 활성(New/Open/Pending) 주문
 	 * 터미널 상태 도달 시 호출자(MarketEngine::onOrderSnapshot)가 erase()로 즉시 제거
+	 * 제거된 slot은 free list로 재사용 (Order 문자열 capacity 재활용)
 	 */
 	class OrderStore
 	{
+	private:
+		// string_view 조회 시 std::string 임시 객체를 만들지 않기 위한 투명 해시
+		struct TransparentHash
+		{
+			using is_transparent = void;
+			std::size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+		};
+
+		// 마켓 1개의 주문 저장 단위
+		struct Shard
+		{
+			struct Slot
+			{
+				core::Order order;
+				bool used{ false };
+			};
+
+			std::vector<Slot> slots;                      // slot 배열 (인덱스 안정)
+			std::vector<std::uint32_t> free_slots;        // 재사용 가능한 slot
+			std::unordered_map<std::string, std::uint32_t, TransparentHash, std::equal_to<>> index;  // order_uuid -> slot
+
+			// 동시성 제어용 뮤텍스 (shard 단위)
+			mutable std::shared_mutex mtx;
+
+			// 호출자가 락을 잡은 상태에서 사용
+			core::Order* find(std::string_view order_uuid) noexcept
+			{
+				auto it = index.find(order_uuid);
+				return it == index.end() ? nullptr : &slots[it->second].order;
+			}
+			const core::Order* find(std::string_view order_uuid) const noexcept
+			{
+				auto it = index.find(order_uuid);
+				return it == index.end() ? nullptr : &slots[it->second].order;
+			}
+			bool insert(const core::Order& order);
+			bool erase(std::string_view order_uuid);
+		};
+
 	public:
+		/*
+		 * MarketOrders - 마켓 1개 shard에 대한 핸들
+		 * - MarketEngine이 생성 시 1회 받아 보관 (이후 마켓 이름 조회 없이 shard 직접 접근)
+		 * - 복사 가능, 수명은 OrderStore와 동일 (shard는 제거되지 않음)
+		 */
+		class MarketOrders
+		{
+		public:
+			// 새 주문 추가 (이미 존재/빈 uuid면 false)
+			[[nodiscard]] bool add(const core::Order& order);
+
+			// order_uuid로 주문 조회(복사본)
+			[[nodiscard]] std::optional<core::Order> get(std::string_view order_uuid) const;
+
+			// 복사 없이 읽기: fn(const core::Order&) 을 shared lock 안에서 호출
+			// - 없으면 false (fn 호출 안 함)
+			// - fn 안에서 OrderStore를 다시 호출하지 말 것 (재진입 시 데드락)
+			template <class Fn>
+			bool visit(std::string_view order_uuid, Fn&& fn) const
+			{
+				std::shared_lock lock(shard_->mtx);
+				const core::Order* o = std::as_const(*shard_).find(order_uuid);
+				if (!o) return false;
+				std::forward<Fn>(fn)(*o);
+				return true;
+			}
+
+			// 제자리 갱신: fn(core::Order&) 을 unique lock 안에서 호출
+			// - id/market은 인덱스 키이므로 fn에서 변경 금지
+			template <class Fn>
+			bool modify(std::string_view order_uuid, Fn&& fn)
+			{
+				std::unique_lock lock(shard_->mtx);
+				core::Order* o = shard_->find(order_uuid);
+				if (!o) return false;
+				std::forward<Fn>(fn)(*o);
+				return true;
+			}
+
+			// 주문 전체 교체 (없으면 false)
+			[[nodiscard]] bool update(const core::Order& order);
+
+			// order_uuid로 주문 삭제
+			bool erase(std::string_view order_uuid);
+
+			// 있으면 덮어쓰고, 없으면 추가(멱등성)
+			void upsert(const core::Order& order);
+
+			// 활성중인(New/Open/Pending) 주문 순회 (shared lock 안에서 fn(const core::Order&))
+			template <class Fn>
+			void forEachOpen(Fn&& fn) const
+			{
+				std::shared_lock lock(shard_->mtx);
+				for (const auto& slot : shard_->slots)
+				{
+					if (slot.used && slot.order.isOpen())
+						fn(slot.order);
+				}
+			}
+
+			// 활성중인 주문 복사본
+			[[nodiscard]] std::vector<core::Order> openOrders() const;
+
+			// 이 마켓의 주문 수
+			[[nodiscard]] std::size_t size() const;
+
+		private:
+			friend class OrderStore;
+			explicit MarketOrders(Shard* shard) noexcept : shard_(shard) {}
+
+			Shard* shard_;
+		};
+
 		OrderStore() = default;
+		OrderStore(const OrderStore&) = delete;
+		OrderStore& operator=(const OrderStore&) = delete;
 
-		// 새 주문을 추가
-		// - 이미 존재 order_uuid면 실패하고 false 반환
-		[[nodiscard]] bool add(const core::Order& order);
+		// 마켓 shard 핸들 (없으면 생성)
+		[[nodiscard]] MarketOrders forMarket(std::string_view market);
 
-		// order_uuid로 주문 조회(복사본)
-		[[nodiscard]] std::optional<core::Order> get(const std::string_view& order_uuid) const;
+		// 새 주문을 추가 (order.market의 shard로)
+		// - 이미 존재 order_uuid거나 uuid/market이 비어 있으면 false 반환
+		[[nodiscard]] bool add(const core::Order& order);
 
-		// 주문의 상태를 교체(update)
+		// 주문의 상태를 교체(update) - order.market의 shard에서 찾음
 		// - 성공하면 교체 후 true
 		// - 없으면 false
 		[[nodiscard]] bool update(const core::Order& order);
 
-		// order_uuid로 주문 삭제
-		bool erase(const std::string_view& order_uuid);
-
 		// 이미 order 있으면 덮어쓰고, 없으면 추가(멱등성)
 		void upsert(const core::Order& order);
 
+		// (market, order_uuid)로 주문 조회(복사본)
+		[[nodiscard]] std::optional<core::Order> get(std::string_view market, std::string_view order_uuid) const;
+
+		// (market, order_uuid)로 주문 삭제
+		bool erase(std::string_view market, std::string_view order_uuid);
+
 		// 특정 마켓에 활성중인(New/Open) 주문들 조회
-		[[nodiscard]] std::vector<core::Order> getOpenOrdersByMarket(const std::string_view& market) const;
+		[[nodiscard]] std::vector<core::Order> getOpenOrdersByMarket(std::string_view market) const;
 
-		// 전체 주문 수
+		// 전체 주문 수 (모든 shard 합)
 		[[nodiscard]] std::size_t size() const;
 
 	private:
-		// 주문 저장소 : order_uuid -> Order
-		std::unordered_map<std::string, core::Order> orders_;
+		Shard* findShard_(std::string_view market) const;
 
-		// 동시성 제어용 뮤텍스
-		// 읽기(get/size/list)는 shared lock, 쓰기(add/update/erase)는 unique lock
-		mutable std::shared_mutex mtx_;
+		// market -> shard (shard 포인터는 생성 후 불변)
+		// shards_mtx_는 shard 생성/탐색에만 사용 (MarketOrders 경로는 잡지 않음)
+		std::unordered_map<std::string, std::unique_ptr<Shard>, TransparentHash, std::equal_to<>> shards_;
+		mutable std::shared_mutex shards_mtx_;
 	};
 }
@@ -0,0 +1,217 @@
+// engine/TradeDedupeTable.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace engine
+{
+	/*
+	 * TradeDedupeTable - 체결 중복 수신 방지용 고정 용량 집합
+	 *
+	 * - 키: 128bit
+	 *   - trade_uuid가 표준 UUID 문자열(8-4-4-4-12)이면 그대로 파싱 (충돌 없음)
+	 *   - 그 외(FALLBACK 키 등)는 서로 다른 64bit 해시 2개를 결합 (충돌 확률 2^-128 수준)
+	 * - 저장: open addressing(선형 탐사) 해시 테이블, 적재율 <= 0.5
+	 * - 제거: FIFO 링(capacity개) - 가득 차면 가장 오래된 키를 테이블에서 backward-shift 삭제
+	 * - 생성 이후 할당 없음 (문자열 보관 안 함)
+	 *
+	 * 스레드 안전하지 않음 (MarketEngine 소유 스레드 전용)
+	 */
+	class TradeDedupeTable
+	{
+	public:
+		struct Key
+		{
+			std::uint64_t hi{ 0 };
+			std::uint64_t lo{ 0 };
+
+			friend bool operator==(const Key&, const Key&) = default;
+		};
+
+		explicit TradeDedupeTable(std::size_t capacity)
+			: capacity_(capacity == 0 ? 1 : capacity)
+			, ring_(capacity_)
+		{
+			std::size_t n = 16;
+			while (n < capacity_ * 2) n <<= 1;
+			table_.assign(n, Key{});
+			mask_ = n - 1;
+		}
+
+		// 처음 보는 키면 기록하고 true, 이미 본 키면 false
+		bool insert(std::string_view trade_uuid) { return insert(keyOf(trade_uuid)); }
+
+		bool insert(Key key)
+		{
+			std::size_t i = home_(key);
+			while (!isEmpty_(table_[i]))
+			{
+				if (table_[i] == key) return false;
+				i = (i + 1) & mask_;
+			}
+
+			// 가득 찼으면 가장 오래된 키를 먼저 제거 (제거로 인한 shift 후 빈 칸을 다시 찾음)
+			if (size_ == capacity_)
+			{
+				erase_(ring_[head_]);
+				ring_[head_] = key;
+				head_ = next_(head_);
+
+				i = home_(key);
+				while (!isEmpty_(table_[i])) i = (i + 1) & mask_;
+			}
+			else
+			{
+				std::size_t tail = head_ + size_;
+				if (tail >= capacity_) tail -= capacity_;
+				ring_[tail] = key;
+				++size_;
+			}
+
+			table_[i] = key;
+			return true;
+		}
+
+		[[nodiscard]] bool contains(std::string_view trade_uuid) const { return contains(keyOf(trade_uuid)); }
+
+		[[nodiscard]] bool contains(Key key) const
+		{
+			for (std::size_t i = home_(key); !isEmpty_(table_[i]); i = (i + 1) & mask_)
+			{
+				if (table_[i] == key) return true;
+			}
+			return false;
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept { return size_; }
+		[[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+		// 문자열 → 128bit 키
+		static Key keyOf(std::string_view s) noexcept
+		{
+			Key k{};
+			if (!parseUuid_(s, k))
+			{
+				// FNV-1a 64 + std::hash(murmur) - 서로 독립적인 해시 2개
+				std::uint64_t h = 0xcbf29ce484222325ULL;
+				for (const unsigned char c : s)
+				{
+					h ^= c;
+					h *= 0x100000001b3ULL;
+				}
+				k.hi = h;
+				k.lo = static_cast<std::uint64_t>(std::hash<std::string_view>{}(s));
+			}
+
+			// {0,0}은 빈 칸 표시로 사용
+			if (k.hi == 0 && k.lo == 0) k.lo = 1;
+			return k;
+		}
+
+	private:
+		static bool isEmpty_(const Key& k) noexcept { return k.hi == 0 && k.lo == 0; }
+
+		std::size_t home_(const Key& k) const noexcept
+		{
+			// UUID v4의 랜덤 비트도 섞어서 사용 (버전/variant 고정 비트 영향 제거)
+			std::uint64_t x = k.hi ^ (k.lo * 0x9E3779B97F4A7C15ULL);
+			x ^= x >> 31;
+			x *= 0xBF58476D1CE4E5B9ULL;
+			x ^= x >> 29;
+			return static_cast<std::size_t>(x) & mask_;
+		}
+
+		std::size_t next_(std::size_t i) const noexcept { return (i + 1 == capacity_) ? 0 : i + 1; }
+
+		// 선형 탐사 backward-shift 삭제 (tombstone 없이 탐사 체인 유지)
+		void erase_(const Key& key) noexcept
+		{
+			std::size_t i = home_(key);
+			while (!(table_[i] == key))
+			{
+				if (isEmpty_(table_[i])) return;
+				i = (i + 1) & mask_;
+			}
+
+			std::size_t j = i;
+			for (;;)
+			{
+				j = (j + 1) & mask_;
+				if (isEmpty_(table_[j])) break;
+
+				// j의 원래 위치 h가 (i, j] 구간 밖이면 i로 당겨도 탐사 체인이 유지됨
+				const std::size_t h = home_(table_[j]);
+				const bool between = (i <= j) ? (i < h && h <= j) : (i < h || h <= j);
+				if (!between)
+				{
+					table_[i] = table_[j];
+					i = j;
+				}
+			}
+			table_[i] = Key{};
+		}
+
+		// 16진수 문자 → 값 (그 외 문자는 -1)
+		static constexpr std::array<std::int8_t, 256> kHexTable_ = [] {
+			std::array<std::int8_t, 256> t{};
+			for (auto& v : t) v = -1;
+			for (int c = 0; c < 10; ++c) t['0' + c] = static_cast<std::int8_t>(c);
+			for (int c = 0; c < 6; ++c)
+			{
+				t['a' + c] = static_cast<std::int8_t>(10 + c);
+				t['A' + c] = static_cast<std::int8_t>(10 + c);
+			}
+			return t;
+		}();
+
+		// UUID 문자열에서 hex 숫자 32개의 위치 (하이픈 제외)
+		static constexpr std::array<std::uint8_t, 32> kUuidDigitPos_ = [] {
+			std::array<std::uint8_t, 32> pos{};
+			std::size_t n = 0;
+			for (std::uint8_t p = 0; p < 36; ++p)
+				if (p != 8 && p != 13 && p != 18 && p != 23) pos[n++] = p;
+			return pos;
+		}();
+
+		// "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" 형식만 허용 (분기 없이 32자리 변환 후 한 번에 검증)
+		static bool parseUuid_(std::string_view s, Key& out) noexcept
+		{
+			if (s.size() != 36 || s[8] != '-' || s[13] != '-' || s[18] != '-' || s[23] != '-')
+				return false;
+
+			std::uint64_t hi = 0, lo = 0;
+			int bad = 0;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				const int v = kHexTable_[static_cast<unsigned char>(s[kUuidDigitPos_[i]])];
+				bad |= v;
+				hi = (hi << 4) | static_cast<std::uint64_t>(v & 0xF);
+			}
+			for (std::size_t i = 16; i < 32; ++i)
+			{
+				const int v = kHexTable_[static_cast<unsigned char>(s[kUuidDigitPos_[i]])];
+				bad |= v;
+				lo = (lo << 4) | static_cast<std::uint64_t>(v & 0xF);
+			}
+			if (bad < 0) return false;
+
+			out.hi = hi;
+			out.lo = lo;
+			return true;
+		}
+
+	private:
+		std::size_t capacity_;          // FIFO 보관 개수 (max_seen_trades)
+		std::vector<Key> ring_;         // 삽입 순서 (가장 오래된 것 = head_)
+		std::size_t head_{ 0 };
+		std::size_t size_{ 0 };
+
+		std::vector<Key> table_;        // open addressing 슬롯 ({0,0} = 빈 칸)
+		std::size_t mask_{ 0 };
+	};
+}
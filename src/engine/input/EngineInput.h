@@ -1,25 +1,43 @@
 ﻿// engine/input/EngineInput.h
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <variant>
+#include <vector>
+
+#include "core/domain/Order.h"
 
 namespace engine::input
 {
     // WS에서 받은 원문(myOrder)
+    // recv_ns/route_ns: util::monoNowNs() 기준 WS 프레임 수신/라우팅 시각 (0이면 미측정)
     struct MyOrderRaw
     {
         std::string json;
+        std::int64_t recv_ns{ 0 };
+        std::int64_t route_ns{ 0 };
     };
 
     // WS에서 받은 원문(candle 등 마켓데이터) - 지금은 candle만 예시로 둠
     struct MarketDataRaw
     {
         std::string json;
+        std::int64_t recv_ns{ 0 };
+        std::int64_t route_ns{ 0 };
     };
 
     // WS 재연결 등으로 인한 계좌 동기화 요청
     struct AccountSyncRequest {};
 
-    using EngineInput = std::variant<MyOrderRaw, MarketDataRaw, AccountSyncRequest>;
+    // 복구 코디네이터(app::RecoveryCoordinator)가 일괄 조회한 pending 주문 결과
+    // - orders: 조회 성공한 스냅샷 (이 마켓 주문만)
+    // - unresolved: 재시도 소진 후에도 확인하지 못한 order_uuid (pending 유지)
+    struct RecoveredOrders
+    {
+        std::vector<core::Order> orders;
+        std::vector<std::string> unresolved;
+    };
+
+    using EngineInput = std::variant<MyOrderRaw, MarketDataRaw, AccountSyncRequest, RecoveredOrders>;
 }
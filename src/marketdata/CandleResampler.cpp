@@ -0,0 +1,237 @@
+// marketdata/CandleResampler.cpp
+#include "marketdata/CandleResampler.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+
+namespace marketdata {
+
+    namespace {
+
+        // start_timestamp는 KST(UTC+9) → UTC 0시 정렬을 위해 보정
+        // (240m 봉: KST 01/05/09/13/17/21시 시작)
+        constexpr std::int64_t kKstOffsetMinutes = 9 * 60;
+
+        // Howard Hinnant days_from_civil (proleptic Gregorian, 1970-01-01 = 0)
+        constexpr std::int64_t daysFromCivil(std::int64_t y, unsigned m, unsigned d) noexcept
+        {
+            y -= m <= 2;
+            const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+            const unsigned yoe = static_cast<unsigned>(y - era * 400);
+            const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+            const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+        }
+
+        struct Civil { std::int64_t y; unsigned m, d; };
+
+        constexpr Civil civilFromDays(std::int64_t z) noexcept
+        {
+            z += 719468;
+            const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+            const unsigned doe = static_cast<unsigned>(z - era * 146097);
+            const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+            const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+            const unsigned mp = (5 * doy + 2) / 153;
+            const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+            const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+            return Civil{ static_cast<std::int64_t>(yoe) + era * 400 + (m <= 2), m, d };
+        }
+
+        bool parseField(std::string_view s, std::size_t pos, std::size_t len, int& out) noexcept
+        {
+            const char* b = s.data() + pos;
+            const auto [ptr, ec] = std::from_chars(b, b + len, out);
+            return ec == std::errc{} && ptr == b + len;
+        }
+
+        // 음수 구간에서도 내림 나눗셈
+        constexpr std::int64_t floorDiv(std::int64_t a, std::int64_t b) noexcept
+        {
+            const std::int64_t q = a / b;
+            return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+        }
+
+    } // anonymous namespace
+
+    CandleResampler::CandleResampler(int base_unit, const std::vector<int>& units)
+        : base_unit_(base_unit)
+    {
+        std::vector<int> sorted(units);
+        std::sort(sorted.begin(), sorted.end());
+        sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+        for (const int u : sorted)
+        {
+            if (!canDerive(base_unit_, u)) continue;
+            Frame f;
+            f.unit = u;
+            frames_.push_back(std::move(f));
+        }
+    }
+
+    std::vector<int> CandleResampler::units() const
+    {
+        std::vector<int> out;
+        out.reserve(frames_.size());
+        for (const auto& f : frames_)
+            out.push_back(f.unit);
+        return out;
+    }
+
+    bool CandleResampler::update(const core::Candle& bar, std::vector<ResampledBar>& closed)
+    {
+        // 같은 봉 갱신: 누적은 그대로, 진행 중 봉만 교체
+        if (live_ && live_->start_timestamp == bar.start_timestamp)
+        {
+            *live_ = bar;
+            return true;
+        }
+
+        const auto minutes = parseMinutes(bar.start_timestamp);
+        if (!minutes || (live_ && *minutes < live_minutes_))
+            return false;
+
+        for (auto& f : frames_)
+        {
+            // 직전 기본 봉 확정 → 그 봉이 속한 구간 누적에 반영
+            if (live_) fold_(f, *live_);
+
+            const std::int64_t b = bucketOf_(f, *minutes);
+            if (!f.start_timestamp.empty() && b == f.bucket) continue;
+
+            // 구간 변경 → 직전 구간 완성
+            if (f.count > 0 && f.complete)
+            {
+                core::Candle c = combine_(f, nullptr);
+                f.last_closed = c;
+                closed.push_back(ResampledBar{ f.unit, std::move(c) });
+            }
+
+            const std::int64_t start = b * f.unit + kKstOffsetMinutes;
+            f.complete = !f.start_timestamp.empty() || *minutes == start;
+            f.bucket = b;
+            f.start_timestamp = formatMinutes(start);
+            f.count = 0;
+        }
+
+        live_ = bar;
+        live_minutes_ = *minutes;
+        return true;
+    }
+
+    std::optional<core::Candle> CandleResampler::current(int unit) const
+    {
+        const Frame* f = find_(unit);
+        if (!f || f->start_timestamp.empty()) return std::nullopt;
+        return combine_(*f, live_ ? &*live_ : nullptr);
+    }
+
+    const core::Candle* CandleResampler::lastClosed(int unit) const noexcept
+    {
+        const Frame* f = find_(unit);
+        return (f && f->last_closed) ? &*f->last_closed : nullptr;
+    }
+
+    std::int64_t CandleResampler::bucketOf_(const Frame& f, std::int64_t minutes) const noexcept
+    {
+        return floorDiv(minutes - kKstOffsetMinutes, f.unit);
+    }
+
+    void CandleResampler::fold_(Frame& f, const core::Candle& bar) noexcept
+    {
+        if (f.count == 0)
+        {
+            f.open = bar.open_price;
+            f.high = bar.high_price;
+            f.low = bar.low_price;
+            f.volume = 0.0;
+        }
+        else
+        {
+            f.high = std::max<double>(f.high, bar.high_price);
+            f.low = std::min<double>(f.low, bar.low_price);
+        }
+        f.close = bar.close_price;
+        f.volume += bar.volume;
+        ++f.count;
+    }
+
+    core::Candle CandleResampler::combine_(const Frame& f, const core::Candle* live) const
+    {
+        core::Candle c;
+        c.start_timestamp = f.start_timestamp;
+
+        if (f.count > 0)
+        {
+            c.open_price = f.open;
+            c.high_price = f.high;
+            c.low_price = f.low;
+            c.close_price = f.close;
+            c.volume = f.volume;
+        }
+
+        if (live)
+        {
+            c.market = live->market;
+            if (f.count == 0)
+            {
+                c.open_price = live->open_price;
+                c.high_price = live->high_price;
+                c.low_price = live->low_price;
+                c.volume = 0.0;
+            }
+            else
+            {
+                c.high_price = std::max(c.high_price, live->high_price);
+                c.low_price = std::min(c.low_price, live->low_price);
+            }
+            c.close_price = live->close_price;
+            c.volume += live->volume;
+        }
+        else if (live_)
+        {
+            c.market = live_->market;
+        }
+        return c;
+    }
+
+    const CandleResampler::Frame* CandleResampler::find_(int unit) const noexcept
+    {
+        for (const auto& f : frames_)
+            if (f.unit == unit) return &f;
+        return nullptr;
+    }
+
+    std::optional<std::int64_t> CandleResampler::parseMinutes(std::string_view ts) noexcept
+    {
+        // YYYY-MM-DDTHH:MM[:SS...]
+        if (ts.size() < 16 || ts[4] != '-' || ts[7] != '-' || (ts[10] != 'T' && ts[10] != ' ') ||
+            ts[13] != ':')
+            return std::nullopt;
+
+        int y = 0, mo = 0, d = 0, h = 0, mi = 0;
+        if (!parseField(ts, 0, 4, y) || !parseField(ts, 5, 2, mo) || !parseField(ts, 8, 2, d) ||
+            !parseField(ts, 11, 2, h) || !parseField(ts, 14, 2, mi))
+            return std::nullopt;
+        if (mo < 1 || mo > 12 || d < 1 || d > 31 || h > 23 || mi > 59)
+            return std::nullopt;
+
+        return daysFromCivil(y, static_cast<unsigned>(mo), static_cast<unsigned>(d)) * 1440
+            + h * 60 + mi;
+    }
+
+    std::string CandleResampler::formatMinutes(std::int64_t minutes)
+    {
+        const std::int64_t days = floorDiv(minutes, 1440);
+        const auto rem = static_cast<unsigned>(minutes - days * 1440);    // 0..1439
+        const Civil c = civilFromDays(days);
+
+        char buf[48];
+        std::snprintf(buf, sizeof(buf), "%04lld-%02u-%02uT%02u:%02u:00",
+            static_cast<long long>(c.y), c.m, c.d, rem / 60, rem % 60);
+        return buf;
+    }
+
+} // namespace marketdata
@@ -0,0 +1,96 @@
+// marketdata/CandleResampler.h
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/domain/Candle.h"
+
+namespace marketdata {
+
+    // 리샘플러가 완성한 상위 단위 봉
+    struct ResampledBar {
+        int unit_minutes{0};
+        core::Candle candle;
+    };
+
+    /*
+     * CandleResampler - 마켓 1개의 기본 단위 분봉 스트림 → 상위 단위 분봉 (3/5/15/30/60/240m 등)
+     *
+     * 입력: WS 분봉 메시지 그대로 (같은 ts 반복 = 진행 중 봉 갱신, 새 ts = 직전 봉 확정)
+     * - 단위마다 "구간 내 확정된 기본 봉 누적(시/고/저/종/거래량)"만 유지 → 업데이트당 O(단위 수), 재계산 없음
+     * - 진행 중 상위 봉 = 누적 + 현재 기본 봉 (current)
+     * - 새 기본 봉이 다른 구간에 들어오면 직전 구간 봉을 완성 처리 (기본 단위의 확정 시점과 동일)
+     *
+     * 구간 정렬: Upbit 분봉과 동일하게 UTC 0시 기준 (start_timestamp는 KST → 9시간 보정)
+     * 시작 직후 구간 중간부터 받은 첫 구간은 불완전하므로 내보내지 않음
+     * 거래가 없는 분은 메시지도 없음 → 빈 분은 건너뛰고 구간 경계만 판단
+     *
+     * 스레드: 소유 워커 스레드 전용
+     */
+    class CandleResampler final {
+    public:
+        // base_unit의 배수가 아닌 단위, base_unit 이하 단위, 중복은 제외
+        CandleResampler(int base_unit, const std::vector<int>& units);
+
+        // base에서 unit 봉을 만들 수 있는지 (unit > base, 배수)
+        static bool canDerive(int base_unit, int unit) noexcept
+        {
+            return base_unit > 0 && unit > base_unit && unit % base_unit == 0;
+        }
+
+        int baseUnit() const noexcept { return base_unit_; }
+
+        // 실제 생성하는 단위 (오름차순)
+        std::vector<int> units() const;
+
+        /*
+         * update(bar)
+         * - 기본 단위 봉 업데이트 1건 입력
+         * - 이번 입력으로 완성된 상위 봉을 closed 뒤에 추가 (단위 오름차순, 대부분 0개)
+         * - 직전 봉보다 이른 ts / 형식 오류 ts는 무시하고 false
+         */
+        bool update(const core::Candle& bar, std::vector<ResampledBar>& closed);
+
+        // 진행 중 상위 봉 (현재 기본 봉 포함), 해당 단위 없음/입력 전이면 nullopt
+        std::optional<core::Candle> current(int unit) const;
+
+        // 마지막으로 완성된 상위 봉
+        const core::Candle* lastClosed(int unit) const noexcept;
+
+        // "YYYY-MM-DDTHH:MM:SS" → epoch 기준 분 (초는 버림), 형식 오류 시 nullopt
+        static std::optional<std::int64_t> parseMinutes(std::string_view ts) noexcept;
+
+        // parseMinutes의 역변환 (초는 00)
+        static std::string formatMinutes(std::int64_t minutes);
+
+    private:
+        struct Frame {
+            int unit{0};
+            std::int64_t bucket{0};         // (분 - 정렬 보정) / unit
+            std::string start_timestamp;    // 구간 시작 시각 (KST 문자열)
+            bool complete{false};           // 구간 첫 분부터 받았는지 (시작 직후 첫 구간만 false 가능)
+
+            // 구간 내 확정된 기본 봉 누적 (count == 0이면 비어 있음)
+            std::size_t count{0};
+            double open{0}, high{0}, low{0}, close{0}, volume{0};
+
+            std::optional<core::Candle> last_closed;
+        };
+
+        std::int64_t bucketOf_(const Frame& f, std::int64_t minutes) const noexcept;
+        void fold_(Frame& f, const core::Candle& bar) noexcept;
+        core::Candle combine_(const Frame& f, const core::Candle* live) const;
+        const Frame* find_(int unit) const noexcept;
+
+        int base_unit_;
+        std::vector<Frame> frames_;         // 단위 오름차순
+
+        std::optional<core::Candle> live_;  // 진행 중 기본 봉
+        std::int64_t live_minutes_{0};
+    };
+
+} // namespace marketdata
@@ -0,0 +1,105 @@
+// marketdata/OrderBook.cpp
+#include "marketdata/OrderBook.h"
+
+#include <algorithm>
+
+namespace marketdata {
+
+    bool OrderBook::update(std::int64_t timestamp_ms, core::Volume total_ask_size, core::Volume total_bid_size,
+                           std::span<const core::OrderbookLevel> levels) noexcept
+    {
+        if (timestamp_ms < timestamp_ms_)
+        {
+            stats_.stale.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const std::size_t n = std::min(levels.size(), kMaxLevels);
+        std::size_t asks = 0;
+        std::size_t bids = 0;
+
+        // 한 단에 양방향이 같이 들어옴 → 방향별로 빈 단(가격/잔량 0) 전까지만 유효
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto& lv = levels[i];
+            if (asks == i && lv.ask_price > 0.0 && lv.ask_size > 0.0)
+            {
+                ask_price_[i] = lv.ask_price;
+                ask_size_[i] = lv.ask_size;
+                ++asks;
+            }
+            if (bids == i && lv.bid_price > 0.0 && lv.bid_size > 0.0)
+            {
+                bid_price_[i] = lv.bid_price;
+                bid_size_[i] = lv.bid_size;
+                ++bids;
+            }
+        }
+
+        timestamp_ms_ = timestamp_ms;
+        total_ask_size_ = total_ask_size;
+        total_bid_size_ = total_bid_size;
+        ask_levels_ = asks;
+        bid_levels_ = bids;
+
+        stats_.updates.fetch_add(1, std::memory_order_relaxed);
+        if (valid() && bid_price_[0] >= ask_price_[0])
+            stats_.crossed.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    core::Price OrderBook::price(Side side, std::size_t i) const noexcept
+    {
+        if (i >= levels(side)) return 0.0;
+        return side == Side::Bid ? bid_price_[i] : ask_price_[i];
+    }
+
+    core::Volume OrderBook::size(Side side, std::size_t i) const noexcept
+    {
+        if (i >= levels(side)) return 0.0;
+        return side == Side::Bid ? bid_size_[i] : ask_size_[i];
+    }
+
+    double OrderBook::spreadBps() const noexcept
+    {
+        const core::Price m = mid();
+        return m > 0.0 ? spread() / m * 10'000.0 : 0.0;
+    }
+
+    core::Amount OrderBook::depthNotional(Side side, std::size_t max_levels) const noexcept
+    {
+        const bool bid = side == Side::Bid;
+        const core::Price* px = bid ? bid_price_.data() : ask_price_.data();
+        const core::Volume* sz = bid ? bid_size_.data() : ask_size_.data();
+        const std::size_t n = std::min(max_levels, bid ? bid_levels_ : ask_levels_);
+
+        core::Amount sum = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+            sum += px[i] * sz[i];
+        return sum;
+    }
+
+    core::Amount OrderBook::notionalWithinBps(Side side, double bps) const noexcept
+    {
+        const core::Price m = mid();
+        if (m <= 0.0 || bps < 0.0) return 0.0;
+
+        // 가격이 단조(ask 증가 / bid 감소) → 한계 가격을 넘는 첫 단에서 중단
+        const double band = m * bps / 10'000.0;
+        core::Amount sum = 0.0;
+        if (side == Side::Ask)
+        {
+            const core::Price limit = m + band;
+            for (std::size_t i = 0; i < ask_levels_ && ask_price_[i] <= limit; ++i)
+                sum += ask_price_[i] * ask_size_[i];
+        }
+        else
+        {
+            const core::Price limit = m - band;
+            for (std::size_t i = 0; i < bid_levels_ && bid_price_[i] >= limit; ++i)
+                sum += bid_price_[i] * bid_size_[i];
+        }
+        return sum;
+    }
+
+} // namespace marketdata
@@ -0,0 +1,98 @@
+// marketdata/OrderBook.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "core/domain/Orderbook.h"
+
+namespace marketdata {
+
+    /*
+     * OrderBook - 마켓 1개의 L2 호가 (상위 kMaxLevels단)
+     *
+     * - Upbit orderbook 메시지는 매번 상위 N단 전체 스냅샷 → 델타 병합 없이 같은 배열에 덮어씀
+     * - 저장: 방향별 가격/잔량을 각각 고정 배열(SoA)로 → 깊이 합산은 연속 메모리 순회, 힙 할당 없음
+     * - 0번 = 최우선 호가 (ask 오름차순, bid 내림차순)
+     * - 조회(spread/mid/깊이 금액)는 O(단 수), 스냅샷이 없거나 한쪽이 비면 0 반환
+     *
+     * 스레드: update/조회 모두 소유 워커 스레드 전용, stats()만 어느 스레드에서나 읽기 가능
+     */
+    class OrderBook final {
+    public:
+        // Upbit WS 호가 최대 단 수 (구독 시 코드 뒤 ".15" 등으로 줄일 수 있음)
+        static constexpr std::size_t kMaxLevels = 30;
+
+        enum class Side : std::uint8_t { Bid, Ask };
+
+        /*
+         * update
+         * - 스냅샷 1건 반영 (kMaxLevels 초과분은 버림)
+         * - timestamp_ms가 직전 스냅샷보다 이르면 무시하고 false (재연결/대기 연결 교체 시 지연 도착분)
+         * - 잔량 0인 단은 그 단까지만 유효 (Upbit는 빈 단을 0으로 채움)
+         */
+        bool update(std::int64_t timestamp_ms, core::Volume total_ask_size, core::Volume total_bid_size,
+                    std::span<const core::OrderbookLevel> levels) noexcept;
+
+        bool valid() const noexcept { return bid_levels_ > 0 && ask_levels_ > 0; }
+        std::int64_t timestampMs() const noexcept { return timestamp_ms_; }
+
+        std::size_t levels(Side side) const noexcept { return side == Side::Bid ? bid_levels_ : ask_levels_; }
+        core::Price price(Side side, std::size_t i) const noexcept;
+        core::Volume size(Side side, std::size_t i) const noexcept;
+
+        // 유효 단 전체 (0번 = 최우선), 호가 순회용
+        std::span<const core::Price> prices(Side side) const noexcept
+        {
+            return side == Side::Bid ? std::span<const core::Price>(bid_price_.data(), bid_levels_)
+                                     : std::span<const core::Price>(ask_price_.data(), ask_levels_);
+        }
+        std::span<const core::Volume> sizes(Side side) const noexcept
+        {
+            return side == Side::Bid ? std::span<const core::Volume>(bid_size_.data(), bid_levels_)
+                                     : std::span<const core::Volume>(ask_size_.data(), ask_levels_);
+        }
+
+        core::Price bestBid() const noexcept { return bid_levels_ ? bid_price_[0] : 0.0; }
+        core::Price bestAsk() const noexcept { return ask_levels_ ? ask_price_[0] : 0.0; }
+        core::Volume totalAskSize() const noexcept { return total_ask_size_; }
+        core::Volume totalBidSize() const noexcept { return total_bid_size_; }
+
+        core::Price spread() const noexcept { return valid() ? ask_price_[0] - bid_price_[0] : 0.0; }
+        core::Price mid() const noexcept { return valid() ? (ask_price_[0] + bid_price_[0]) * 0.5 : 0.0; }
+        double spreadBps() const noexcept;
+
+        // 최우선부터 max_levels단까지 잔량 × 가격 합 (KRW)
+        core::Amount depthNotional(Side side, std::size_t max_levels = kMaxLevels) const noexcept;
+
+        // mid에서 bps 이내 가격대의 잔량 × 가격 합 (KRW) — "x bps 안에서 소화 가능한 금액"
+        core::Amount notionalWithinBps(Side side, double bps) const noexcept;
+
+        // 기록은 워커 스레드만, 읽기는 락 없이 (메트릭)
+        struct Stats {
+            std::atomic<std::uint64_t> updates{0};
+            std::atomic<std::uint64_t> stale{0};        // 직전보다 이른 스냅샷
+            std::atomic<std::uint64_t> crossed{0};      // bid >= ask 스냅샷 (반영은 함)
+        };
+
+        const Stats& stats() const noexcept { return stats_; }
+
+    private:
+        std::int64_t timestamp_ms_{0};
+        core::Volume total_ask_size_{0};
+        core::Volume total_bid_size_{0};
+        std::size_t ask_levels_{0};
+        std::size_t bid_levels_{0};
+
+        alignas(64) std::array<core::Price, kMaxLevels> ask_price_{};
+        alignas(64) std::array<core::Volume, kMaxLevels> ask_size_{};
+        alignas(64) std::array<core::Price, kMaxLevels> bid_price_{};
+        alignas(64) std::array<core::Volume, kMaxLevels> bid_size_{};
+
+        Stats stats_;
+    };
+
+} // namespace marketdata
@@ -0,0 +1,45 @@
+// marketdata/PriceSeries.cpp
+#include "marketdata/PriceSeries.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "marketdata/CandleResampler.h"
+
+namespace marketdata {
+
+    PriceSeries::PriceSeries(std::size_t min_capacity)
+    {
+        const std::size_t cap = std::bit_ceil(std::max<std::size_t>(min_capacity, 2));
+        mask_ = cap - 1;
+
+        open_.assign(cap, 0.0);
+        high_.assign(cap, 0.0);
+        low_.assign(cap, 0.0);
+        close_.assign(cap, 0.0);
+        volume_.assign(cap, 0.0);
+        ts_.assign(cap, 0);
+    }
+
+    void PriceSeries::push(std::int64_t ts_minutes, double open, double high, double low, double close,
+                           double volume) noexcept
+    {
+        const std::size_t i = static_cast<std::size_t>(count_) & mask_;
+        open_[i] = open;
+        high_[i] = high;
+        low_[i] = low;
+        close_[i] = close;
+        volume_[i] = volume;
+        ts_[i] = ts_minutes;
+        ++count_;
+    }
+
+    void PriceSeries::push(const core::Candle& c) noexcept
+    {
+        push(CandleResampler::parseMinutes(c.start_timestamp).value_or(0),
+             static_cast<double>(c.open_price), static_cast<double>(c.high_price),
+             static_cast<double>(c.low_price), static_cast<double>(c.close_price),
+             static_cast<double>(c.volume));
+    }
+
+} // namespace marketdata
@@ -0,0 +1,67 @@
+// marketdata/PriceSeries.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/domain/Candle.h"
+
+namespace marketdata {
+
+    /*
+     * PriceSeries - 마켓 1개의 확정 봉 시계열 (최근 capacity개)
+     *
+     * - 마켓 컨텍스트가 소유, 지표는 자기 버퍼 없이 이 시계열을 조회하는 뷰로 동작
+     *   (close[N], 윈도우에서 빠지는 값 등은 전부 여기서 읽음 → 같은 종가를 지표마다 따로 들고 있지 않음)
+     * - 저장: 시/고/저/종/거래량/ts 열별 배열(SoA), 용량은 2의 거듭제곱으로 올림 → 인덱스는 마스크 1번
+     * - 조회: back = 0이 최신 봉, O(1). back < size() 보장은 호출자 책임
+     * - 가득 차면 가장 오래된 봉을 덮어씀 (push 이후 재할당 없음)
+     *
+     * 스레드: 소유 워커 스레드 전용
+     */
+    class PriceSeries final {
+    public:
+        // min_capacity 이상인 가장 작은 2의 거듭제곱 (최소 2)
+        explicit PriceSeries(std::size_t min_capacity);
+
+        // ts_minutes: epoch 기준 분 (CandleResampler::parseMinutes와 같은 기준)
+        void push(std::int64_t ts_minutes, double open, double high, double low, double close, double volume) noexcept;
+
+        // start_timestamp 형식 오류면 ts는 0으로 기록 (가격 열은 그대로 반영)
+        void push(const core::Candle& c) noexcept;
+
+        void clear() noexcept { count_ = 0; }
+
+        std::size_t capacity() const noexcept { return mask_ + 1; }
+        std::size_t size() const noexcept { return count_ < capacity() ? count_ : capacity(); }
+        bool empty() const noexcept { return count_ == 0; }
+
+        // clear 이후 누적 push 수 (덮어쓴 봉 포함)
+        std::uint64_t pushed() const noexcept { return count_; }
+
+        double open(std::size_t back) const noexcept { return open_[slot(back)]; }
+        double high(std::size_t back) const noexcept { return high_[slot(back)]; }
+        double low(std::size_t back) const noexcept { return low_[slot(back)]; }
+        double close(std::size_t back) const noexcept { return close_[slot(back)]; }
+        double volume(std::size_t back) const noexcept { return volume_[slot(back)]; }
+        std::int64_t tsMinutes(std::size_t back) const noexcept { return ts_[slot(back)]; }
+
+    private:
+        std::size_t slot(std::size_t back) const noexcept
+        {
+            return static_cast<std::size_t>(count_ - 1 - back) & mask_;
+        }
+
+        std::size_t mask_{0};
+        std::uint64_t count_{0};
+
+        std::vector<double> open_;
+        std::vector<double> high_;
+        std::vector<double> low_;
+        std::vector<double> close_;
+        std::vector<double> volume_;
+        std::vector<std::int64_t> ts_;
+    };
+
+} // namespace marketdata
@@ -0,0 +1,123 @@
+// marketdata/SlippageEstimator.cpp
+#include "marketdata/SlippageEstimator.h"
+
+#include <algorithm>
+
+namespace marketdata {
+
+    namespace {
+
+        using Side = OrderBook::Side;
+
+        // 누적 수량/금액 → VWAP·bps 계산 (매수는 가격이 높을수록, 매도는 낮을수록 불리)
+        void finish(SlippageEstimate& e, const OrderBook& book, Side side) noexcept
+        {
+            if (e.volume <= 0.0) return;
+
+            e.vwap = e.notional / e.volume;
+            const double sign = side == Side::Ask ? 1.0 : -1.0;
+            e.slippage_bps = std::max(0.0, sign * (e.vwap - e.touch) / e.touch * 10'000.0);
+
+            const core::Price mid = book.mid();
+            e.cost_bps = std::max(0.0, sign * (e.vwap - mid) / mid * 10'000.0);
+        }
+
+        // 한계 VWAP(limit)를 넘지 않는 최대 (수량, 금액)
+        // 한 단 안에서 vwap(q) = (N + p·q) / (V + q) = limit → q = (limit·V - N) / (p - limit)
+        void consumeWithin(const OrderBook& book, Side side, double max_bps,
+                           core::Volume& volume, core::Amount& notional) noexcept
+        {
+            volume = 0.0;
+            notional = 0.0;
+            if (!book.valid() || max_bps < 0.0) return;
+
+            const auto px = book.prices(side);
+            const auto sz = book.sizes(side);
+            const bool buy = side == Side::Ask;
+            const double limit = px[0] * (buy ? 1.0 + max_bps / 10'000.0 : 1.0 - max_bps / 10'000.0);
+
+            for (std::size_t i = 0; i < px.size(); ++i)
+            {
+                const bool within = buy ? px[i] <= limit : px[i] >= limit;
+                if (within)
+                {
+                    volume += sz[i];
+                    notional += px[i] * sz[i];
+                    continue;
+                }
+
+                // 이 단을 다 먹어도 한계 안이면 다음 단으로, 아니면 한계 지점에서 종료
+                const double q = std::clamp((limit * volume - notional) / (px[i] - limit), 0.0, sz[i]);
+                volume += q;
+                notional += px[i] * q;
+                if (q < sz[i]) return;
+            }
+        }
+
+    } // anonymous namespace
+
+    SlippageEstimate estimateBuyByAmount(const OrderBook& book, core::Amount krw) noexcept
+    {
+        SlippageEstimate e;
+        if (!book.valid() || krw <= 0.0) return e;
+
+        const auto px = book.prices(Side::Ask);
+        const auto sz = book.sizes(Side::Ask);
+        e.touch = px[0];
+
+        core::Amount remaining = krw;
+        for (std::size_t i = 0; i < px.size() && remaining > 0.0; ++i)
+        {
+            const core::Amount take = std::min(remaining, px[i] * sz[i]);
+            e.volume += take / px[i];
+            e.notional += take;
+            remaining -= take;
+            ++e.levels_used;
+        }
+
+        e.exhausted = remaining > krw * 1e-12;
+        finish(e, book, Side::Ask);
+        return e;
+    }
+
+    SlippageEstimate estimateSellByVolume(const OrderBook& book, core::Volume volume) noexcept
+    {
+        SlippageEstimate e;
+        if (!book.valid() || volume <= 0.0) return e;
+
+        const auto px = book.prices(Side::Bid);
+        const auto sz = book.sizes(Side::Bid);
+        e.touch = px[0];
+
+        core::Volume remaining = volume;
+        for (std::size_t i = 0; i < px.size() && remaining > 0.0; ++i)
+        {
+            const core::Volume take = std::min(remaining, sz[i]);
+            e.volume += take;
+            e.notional += px[i] * take;
+            remaining -= take;
+            ++e.levels_used;
+        }
+
+        e.exhausted = remaining > volume * 1e-12;
+        finish(e, book, Side::Bid);
+        return e;
+    }
+
+    core::Amount maxBuyAmountWithin(const OrderBook& book, double max_bps) noexcept
+    {
+        core::Volume v = 0.0;
+        core::Amount n = 0.0;
+        consumeWithin(book, Side::Ask, max_bps, v, n);
+        return n;
+    }
+
+    core::Volume maxSellVolumeWithin(const OrderBook& book, double max_bps) noexcept
+    {
+        core::Volume v = 0.0;
+        core::Amount n = 0.0;
+        consumeWithin(book, Side::Bid, max_bps, v, n);
+        return v;
+    }
+
+} // namespace marketdata
@@ -0,0 +1,40 @@
+// marketdata/SlippageEstimator.h
+#pragma once
+
+#include <cstddef>
+
+#include "core/domain/Types.h"
+#include "marketdata/OrderBook.h"
+
+namespace marketdata {
+
+    // 시장가 주문 1건을 현재 호가로 체결했다고 가정한 예상치
+    struct SlippageEstimate {
+        core::Price vwap{0};            // 예상 평균 체결가
+        core::Volume volume{0};         // 예상 체결 수량
+        core::Amount notional{0};       // 예상 체결 금액 (KRW, 수수료 제외)
+        core::Price touch{0};           // 기준 최우선 호가 (매수 = best ask, 매도 = best bid)
+        double slippage_bps{0};         // 최우선 호가 대비 불리한 방향 (0 이상)
+        double cost_bps{0};             // 중간가 대비 불리한 방향 (스프레드 절반 포함)
+        std::size_t levels_used{0};
+        bool exhausted{false};          // 수신한 호가 단을 모두 소진해도 요청 크기 미달
+    };
+
+    /*
+     * 시장가 주문 사전 추정 (호가 단 순회, O(단 수), 할당 없음)
+     * - 매수는 금액(AmountSize), 매도는 수량(VolumeSize) 기준 — 전략의 시장가 주문 형태와 동일
+     * - 북이 비었으면(valid() == false) 기본값(volume 0) 반환
+     * - exhausted면 수신한 단까지만 반영한 값 (실제 슬리피지는 더 클 수 있음)
+     */
+    SlippageEstimate estimateBuyByAmount(const OrderBook& book, core::Amount krw) noexcept;
+    SlippageEstimate estimateSellByVolume(const OrderBook& book, core::Volume volume) noexcept;
+
+    /*
+     * 최우선 호가 대비 슬리피지가 max_bps 이하인 최대 주문 크기
+     * - VWAP는 크기에 대해 단조 → 한계 가격을 넘는 단 안에서 방정식으로 바로 계산
+     * - 수신한 단을 모두 소진해도 한계 미달이면 소진 크기 반환
+     */
+    core::Amount maxBuyAmountWithin(const OrderBook& book, double max_bps) noexcept;
+    core::Volume maxSellVolumeWithin(const OrderBook& book, double max_bps) noexcept;
+
+} // namespace marketdata
@@ -0,0 +1,59 @@
+// marketdata/TickAggregator.cpp
+#include "marketdata/TickAggregator.h"
+
+#include <algorithm>
+
+namespace marketdata {
+
+    TickAggregator::Result TickAggregator::update(
+        double price, double volume, std::int64_t ts_ms, std::int64_t sequential_id) noexcept
+    {
+        if (sequential_id != 0 && seen_(sequential_id))
+        {
+            stats_.duplicates.fetch_add(1, std::memory_order_relaxed);
+            return Result::Duplicate;
+        }
+
+        // epoch ms는 양수 → 단순 나눗셈이 곧 내림
+        const std::int64_t start = ts_ms - ts_ms % bar_ms_;
+        if (current_.trades > 0 && start < current_.start_ms)
+        {
+            stats_.stale.fetch_add(1, std::memory_order_relaxed);
+            return Result::Stale;
+        }
+
+        if (sequential_id != 0) remember_(sequential_id);
+        stats_.applied.fetch_add(1, std::memory_order_relaxed);
+
+        Result result = Result::Applied;
+        if (current_.trades == 0 || start != current_.start_ms)
+        {
+            if (current_.trades > 0)
+            {
+                closed_ = current_;
+                stats_.bars.fetch_add(1, std::memory_order_relaxed);
+                result = Result::BarClosed;
+            }
+            current_ = TickBar{ start, price, price, price, price, 0.0, 0 };
+        }
+
+        current_.high = std::max(current_.high, price);
+        current_.low = std::min(current_.low, price);
+        current_.close = price;
+        current_.volume += volume;
+        ++current_.trades;
+        return result;
+    }
+
+    bool TickAggregator::seen_(std::int64_t sequential_id) const noexcept
+    {
+        return std::find(recent_ids_.begin(), recent_ids_.end(), sequential_id) != recent_ids_.end();
+    }
+
+    void TickAggregator::remember_(std::int64_t sequential_id) noexcept
+    {
+        recent_ids_[recent_pos_] = sequential_id;
+        recent_pos_ = (recent_pos_ + 1) % kRecentIds;
+    }
+
+} // namespace marketdata
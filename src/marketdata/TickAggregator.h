@@ -0,0 +1,82 @@
+// marketdata/TickAggregator.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace marketdata {
+
+    // 체결로 만든 로컬 봉 (문자열 없음 → 복사/갱신에 할당 없음)
+    struct TickBar {
+        std::int64_t start_ms{0};   // 구간 시작 (epoch ms, UTC 정렬)
+        double open{0};
+        double high{0};
+        double low{0};
+        double close{0};
+        double volume{0};
+        std::uint32_t trades{0};
+    };
+
+    /*
+     * TickAggregator - 마켓 1개의 체결 스트림 → 고정 길이 봉 (bar_ms 단위, UTC 0시 정렬)
+     *
+     * - 체결마다 O(1): 현재 봉 시/고/저/종/거래량 갱신, 구간이 바뀌면 직전 봉을 lastClosed로 확정
+     * - 중복 제거: 최근 sequential_id kRecentIds개를 고정 배열에 보관 (재연결/대기 연결 교체 시 재전송분)
+     * - 현재 봉보다 이른 체결(지연 도착)은 Stale로 버림 → 이미 확정한 봉/intrabar 가격에 반영하지 않음
+     * - 힙 할당 없음 (생성 이후 모든 상태가 객체 내부 고정 크기)
+     *
+     * 스레드: update는 소유 워커 스레드 전용, stats()는 어느 스레드에서나 읽기 가능
+     */
+    class TickAggregator final {
+    public:
+        static constexpr std::size_t kRecentIds = 32;
+
+        enum class Result : std::uint8_t {
+            Applied,        // 현재 봉에 반영
+            BarClosed,      // 새 구간 시작 → 직전 봉 확정(lastClosed) 후 반영
+            Duplicate,      // 이미 반영한 sequential_id
+            Stale,          // 현재 봉 시작보다 이른 체결
+        };
+
+        explicit TickAggregator(std::int64_t bar_ms) noexcept
+            : bar_ms_(bar_ms > 0 ? bar_ms : 60'000)
+        {}
+
+        // 체결 1건 반영 (sequential_id == 0이면 중복 판정 생략)
+        Result update(double price, double volume, std::int64_t ts_ms, std::int64_t sequential_id) noexcept;
+
+        bool hasCurrent() const noexcept { return current_.trades > 0; }
+        const TickBar& current() const noexcept { return current_; }
+
+        bool hasClosed() const noexcept { return closed_.trades > 0; }
+        const TickBar& lastClosed() const noexcept { return closed_; }
+
+        std::int64_t barMs() const noexcept { return bar_ms_; }
+
+        // 기록은 워커 스레드만, 읽기는 락 없이 (메트릭)
+        struct Stats {
+            std::atomic<std::uint64_t> applied{0};
+            std::atomic<std::uint64_t> duplicates{0};
+            std::atomic<std::uint64_t> stale{0};
+            std::atomic<std::uint64_t> bars{0};     // 확정된 봉 수
+        };
+
+        const Stats& stats() const noexcept { return stats_; }
+
+    private:
+        bool seen_(std::int64_t sequential_id) const noexcept;
+        void remember_(std::int64_t sequential_id) noexcept;
+
+        std::int64_t bar_ms_;
+        TickBar current_{};
+        TickBar closed_{};
+
+        std::array<std::int64_t, kRecentIds> recent_ids_{};
+        std::size_t recent_pos_{0};
+
+        Stats stats_;
+    };
+
+} // namespace marketdata
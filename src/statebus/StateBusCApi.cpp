@@ -0,0 +1,68 @@
+// statebus/StateBusCApi.cpp
+#include "statebus/StateBusCApi.h"
+
+#include <new>
+
+#include "statebus/StateBusReader.h"
+
+extern "C" {
+
+    std::uint32_t cbsb_layout_version(void)
+    {
+        return statebus::kVersion;
+    }
+
+    std::size_t cbsb_state_size(void)
+    {
+        return sizeof(statebus::MarketState);
+    }
+
+    void* cbsb_open(const char* name)
+    {
+        if (!name) return nullptr;
+
+        auto* reader = new (std::nothrow) statebus::StateBusReader(name);
+        if (!reader) return nullptr;
+        if (!reader->open()) {
+            delete reader;
+            return nullptr;
+        }
+        return reader;
+    }
+
+    void cbsb_close(void* handle)
+    {
+        delete static_cast<statebus::StateBusReader*>(handle);
+    }
+
+    int cbsb_reopen(void* handle)
+    {
+        if (!handle) return 0;
+        return static_cast<statebus::StateBusReader*>(handle)->reopen() ? 1 : 0;
+    }
+
+    std::uint32_t cbsb_market_count(void* handle)
+    {
+        if (!handle) return 0;
+        return static_cast<std::uint32_t>(static_cast<statebus::StateBusReader*>(handle)->marketCount());
+    }
+
+    int cbsb_read(void* handle, std::uint32_t index, void* out, std::size_t out_size)
+    {
+        if (!handle || !out || out_size != sizeof(statebus::MarketState)) return 0;
+        return static_cast<statebus::StateBusReader*>(handle)->read(
+            index, *static_cast<statebus::MarketState*>(out)) ? 1 : 0;
+    }
+
+    int cbsb_info(void* handle, std::int64_t* writer_pid, std::int64_t* started_at_ms,
+                  std::int64_t* heartbeat_ms)
+    {
+        if (!handle) return 0;
+        const auto info = static_cast<statebus::StateBusReader*>(handle)->info();
+        if (writer_pid) *writer_pid = info.writer_pid;
+        if (started_at_ms) *started_at_ms = info.started_at_ms;
+        if (heartbeat_ms) *heartbeat_ms = info.heartbeat_ms;
+        return 1;
+    }
+
+}
@@ -0,0 +1,28 @@
+// statebus/StateBusCApi.h
+//
+// StateBusReader C ABI (Python ctypes 바인딩용: streamlit/statebus.py)
+// - out 버퍼는 statebus::MarketState와 동일 레이아웃 (cbsb_state_size()로 크기 확인)
+// - 반환값 int: 1 = 성공, 0 = 실패
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+extern "C" {
+
+    std::uint32_t cbsb_layout_version(void);
+    std::size_t cbsb_state_size(void);
+
+    // 실패 시 nullptr (봇 미실행/레이아웃 불일치)
+    void* cbsb_open(const char* name);
+    void cbsb_close(void* handle);
+
+    // writer 재시작 후 새 세그먼트로 다시 매핑
+    int cbsb_reopen(void* handle);
+
+    std::uint32_t cbsb_market_count(void* handle);
+    int cbsb_read(void* handle, std::uint32_t index, void* out, std::size_t out_size);
+    int cbsb_info(void* handle, std::int64_t* writer_pid, std::int64_t* started_at_ms,
+                  std::int64_t* heartbeat_ms);
+
+}
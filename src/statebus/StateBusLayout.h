@@ -0,0 +1,141 @@
+// statebus/StateBusLayout.h
+//
+// 라이브 상태 버스 공유 메모리 레이아웃 (writer = 봇, reader = 대시보드/외부 프로세스)
+//
+// [세그먼트]  Header | MarketSlot[market_capacity]
+// - Header: magic/version/크기로 호환성 확인, market_count(acquire)까지의 슬롯만 유효
+// - MarketSlot: 마켓 1개 상태, 마켓 워커 1개만 쓰는 seqlock (홀수 = 쓰기 중)
+//   · 모든 가변 필드는 lock-free atomic (relaxed) → 프로세스 간 torn read가 있어도 UB 없이 seq 비교로 폐기
+//   · market 이름은 등록 시 1회 기록 후 불변 (market_count release 발행 전에 기록)
+//
+// 레이아웃 변경 시 kVersion 증가 + streamlit/statebus.py의 MarketState 정의 동기화
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace statebus {
+
+    inline constexpr std::uint32_t kMagic = 0x42534243;    // "CBSB" (little-endian)
+    inline constexpr std::uint16_t kVersion = 2;
+
+    inline constexpr std::size_t kMarketNameSize = 24;      // "KRW-BTC" 등, NUL 포함
+    inline constexpr std::size_t kCandleTsSize = 32;        // Candle::start_timestamp, NUL 패딩
+
+    // MarketState::flags
+    enum MarketStateFlags : std::uint32_t {
+        kRsiReady        = 1u << 0,
+        kVolatilityReady = 1u << 1,
+        kMarketOk        = 1u << 2,
+        kCandleValid     = 1u << 3,     // 캔들 수신 이전이면 0
+        kRemoved         = 1u << 4,     // 런타임 제거된 마켓 (슬롯은 같은 마켓 재추가 시 재사용)
+        kOrderbookValid  = 1u << 5,     // 호가 구독 중이고 양방향 호가 수신
+    };
+
+    // 슬롯 1개를 일관되게 읽은(또는 쓸) 평면 사본 (reader/writer 공용, C API로 그대로 복사)
+    struct MarketState {
+        char market[kMarketNameSize]{};
+        char candle_ts[kCandleTsSize]{};
+
+        std::uint64_t version{ 0 };             // 발행 횟수 (reader가 채움)
+        std::int64_t updated_at_ms{ 0 };        // 발행 시각 (epoch ms)
+        std::uint32_t strategy_state{ 0 };      // trading::StrategyState (포지션을 가진 전략 기준)
+        std::uint32_t flags{ 0 };               // MarketStateFlags
+
+        // 마지막 캔들 (미확정 포함 최신 업데이트)
+        double candle_open{ 0 };
+        double candle_high{ 0 };
+        double candle_low{ 0 };
+        double candle_close{ 0 };
+        double candle_volume{ 0 };
+
+        // 지표 (마지막 확정봉 기준 signal snapshot)
+        double rsi{ 0 };
+        double volatility{ 0 };
+        double trend_strength{ 0 };
+
+        // 호가 (최우선 호가 + 수신 단 전체 잔량 금액)
+        double best_bid{ 0 };
+        double best_ask{ 0 };
+        double bid_depth_krw{ 0 };
+        double ask_depth_krw{ 0 };
+
+        // MarketBudget
+        double available_krw{ 0 };
+        double reserved_krw{ 0 };
+        double coin_balance{ 0 };
+        double avg_entry_price{ 0 };
+        double initial_capital{ 0 };
+        double realized_pnl{ 0 };
+
+        // 마켓 이벤트 큐
+        std::uint64_t queue_depth{ 0 };
+        std::uint64_t queue_dropped{ 0 };
+    };
+
+    static_assert(std::is_trivially_copyable_v<MarketState>);
+    static_assert(std::is_standard_layout_v<MarketState>);
+
+    struct alignas(64) Header {
+        std::atomic<std::uint32_t> magic;       // 초기화 완료 후 마지막에 release 기록
+        std::uint16_t version;
+        std::uint16_t header_size;
+        std::uint32_t slot_size;
+        std::uint32_t market_capacity;
+        std::atomic<std::uint32_t> market_count;
+        std::uint32_t reserved0;
+        std::atomic<std::int64_t> writer_pid;
+        std::atomic<std::int64_t> started_at_ms;
+        std::atomic<std::int64_t> heartbeat_ms;     // 아무 슬롯이나 마지막 발행 시각 (writer 생존 판정)
+    };
+
+    struct alignas(64) MarketSlot {
+        std::atomic<std::uint64_t> seq;
+        char market[kMarketNameSize];
+
+        std::atomic<std::int64_t> updated_at_ms;
+        std::atomic<std::uint32_t> strategy_state;
+        std::atomic<std::uint32_t> flags;
+
+        std::atomic<double> candle_open;
+        std::atomic<double> candle_high;
+        std::atomic<double> candle_low;
+        std::atomic<double> candle_close;
+        std::atomic<double> candle_volume;
+        std::atomic<std::uint64_t> candle_ts[kCandleTsSize / 8];
+
+        std::atomic<double> rsi;
+        std::atomic<double> volatility;
+        std::atomic<double> trend_strength;
+
+        std::atomic<double> best_bid;
+        std::atomic<double> best_ask;
+        std::atomic<double> bid_depth_krw;
+        std::atomic<double> ask_depth_krw;
+
+        std::atomic<double> available_krw;
+        std::atomic<double> reserved_krw;
+        std::atomic<double> coin_balance;
+        std::atomic<double> avg_entry_price;
+        std::atomic<double> initial_capital;
+        std::atomic<double> realized_pnl;
+
+        std::atomic<std::uint64_t> queue_depth;
+        std::atomic<std::uint64_t> queue_dropped;
+    };
+
+    // 프로세스 간 공유는 주소 무관(lock-free) atomic에서만 유효
+    static_assert(std::atomic<double>::is_always_lock_free);
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+    static_assert(std::atomic<std::int64_t>::is_always_lock_free);
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+    static_assert(std::is_standard_layout_v<Header>);
+    static_assert(std::is_standard_layout_v<MarketSlot>);
+
+    inline constexpr std::size_t segmentSize(std::size_t market_capacity) noexcept {
+        return sizeof(Header) + sizeof(MarketSlot) * market_capacity;
+    }
+
+} // namespace statebus
@@ -0,0 +1,162 @@
+// statebus/StateBusReader.cpp
+#include "statebus/StateBusReader.h"
+
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define COINBOT_STATEBUS_POSIX 1
+#endif
+
+namespace statebus {
+
+    namespace {
+
+        // writer가 쓰기 도중 종료되면 seq가 홀수로 고정됨 → 무한 대기 대신 포기
+        constexpr int kMaxReadAttempts = 10'000;
+
+    } // anonymous namespace
+
+    StateBusReader::StateBusReader(std::string name)
+        : name_(std::move(name))
+    {
+    }
+
+    StateBusReader::~StateBusReader()
+    {
+        close();
+    }
+
+    bool StateBusReader::open()
+    {
+        if (isOpen()) return true;
+
+#if defined(COINBOT_STATEBUS_POSIX)
+        const int fd = ::shm_open(name_.c_str(), O_RDONLY, 0);
+        if (fd < 0) return false;
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(Header)) {
+            ::close(fd);
+            return false;
+        }
+
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* base = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) return false;
+
+        const auto* header = static_cast<const Header*>(base);
+        const bool valid =
+            header->magic.load(std::memory_order_acquire) == kMagic &&
+            header->version == kVersion &&
+            header->header_size == sizeof(Header) &&
+            header->slot_size == sizeof(MarketSlot) &&
+            size >= segmentSize(header->market_capacity);
+        if (!valid) {
+            ::munmap(base, size);
+            return false;
+        }
+
+        base_ = base;
+        size_ = size;
+        header_ = header;
+        slots_ = reinterpret_cast<const MarketSlot*>(static_cast<const char*>(base) + sizeof(Header));
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void StateBusReader::close() noexcept
+    {
+#if defined(COINBOT_STATEBUS_POSIX)
+        if (base_) ::munmap(base_, size_);
+#endif
+        base_ = nullptr;
+        size_ = 0;
+        header_ = nullptr;
+        slots_ = nullptr;
+    }
+
+    StateBusReader::Info StateBusReader::info() const noexcept
+    {
+        Info out;
+        if (!header_) return out;
+
+        out.writer_pid = header_->writer_pid.load(std::memory_order_relaxed);
+        out.started_at_ms = header_->started_at_ms.load(std::memory_order_relaxed);
+        out.heartbeat_ms = header_->heartbeat_ms.load(std::memory_order_relaxed);
+        out.market_count = header_->market_count.load(std::memory_order_acquire);
+        return out;
+    }
+
+    std::size_t StateBusReader::marketCount() const noexcept
+    {
+        return header_ ? header_->market_count.load(std::memory_order_acquire) : 0;
+    }
+
+    bool StateBusReader::read(std::size_t index, MarketState& out) const noexcept
+    {
+        if (index >= marketCount()) return false;
+        const MarketSlot& slot = slots_[index];
+
+        for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt)
+        {
+            const std::uint64_t s1 = slot.seq.load(std::memory_order_acquire);
+            if (s1 & 1u) {
+                std::this_thread::yield();  // 쓰기 진행 중
+                continue;
+            }
+
+            out.updated_at_ms = slot.updated_at_ms.load(std::memory_order_relaxed);
+            out.strategy_state = slot.strategy_state.load(std::memory_order_relaxed);
+            out.flags = slot.flags.load(std::memory_order_relaxed);
+
+            out.candle_open = slot.candle_open.load(std::memory_order_relaxed);
+            out.candle_high = slot.candle_high.load(std::memory_order_relaxed);
+            out.candle_low = slot.candle_low.load(std::memory_order_relaxed);
+            out.candle_close = slot.candle_close.load(std::memory_order_relaxed);
+            out.candle_volume = slot.candle_volume.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < kCandleTsSize / 8; ++i) {
+                const std::uint64_t word = slot.candle_ts[i].load(std::memory_order_relaxed);
+                std::memcpy(out.candle_ts + i * 8, &word, 8);
+            }
+
+            out.rsi = slot.rsi.load(std::memory_order_relaxed);
+            out.volatility = slot.volatility.load(std::memory_order_relaxed);
+            out.trend_strength = slot.trend_strength.load(std::memory_order_relaxed);
+
+            out.best_bid = slot.best_bid.load(std::memory_order_relaxed);
+            out.best_ask = slot.best_ask.load(std::memory_order_relaxed);
+            out.bid_depth_krw = slot.bid_depth_krw.load(std::memory_order_relaxed);
+            out.ask_depth_krw = slot.ask_depth_krw.load(std::memory_order_relaxed);
+
+            out.available_krw = slot.available_krw.load(std::memory_order_relaxed);
+            out.reserved_krw = slot.reserved_krw.load(std::memory_order_relaxed);
+            out.coin_balance = slot.coin_balance.load(std::memory_order_relaxed);
+            out.avg_entry_price = slot.avg_entry_price.load(std::memory_order_relaxed);
+            out.initial_capital = slot.initial_capital.load(std::memory_order_relaxed);
+            out.realized_pnl = slot.realized_pnl.load(std::memory_order_relaxed);
+
+            out.queue_depth = slot.queue_depth.load(std::memory_order_relaxed);
+            out.queue_dropped = slot.queue_dropped.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) == s1) {
+                out.version = s1 >> 1;
+                out.candle_ts[kCandleTsSize - 1] = '\0';
+                std::memcpy(out.market, slot.market, kMarketNameSize);  // 등록 후 불변
+                out.market[kMarketNameSize - 1] = '\0';
+                return true;
+            }
+        }
+        return false;
+    }
+
+} // namespace statebus
@@ -0,0 +1,55 @@
+// statebus/StateBusReader.h
+//
+// 라이브 상태 버스 reader (대시보드/외부 프로세스, 읽기 전용 매핑)
+// - open(): 세그먼트 매핑 + magic/version/크기 검증 (봇 미실행/버전 불일치 시 false)
+// - read(): 슬롯 seqlock 재시도 읽기 (writer가 쓰기 도중 죽어 seq가 홀수로 남으면 시도 한도 후 false)
+// - writer 재시작 시 기존 매핑은 unlink된 옛 세그먼트를 가리킴 → heartbeat 정체 시 reopen() 할 것
+//
+// 스레드 안전: open/close 이후의 read()/info()는 여러 스레드에서 동시 호출 가능
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "statebus/StateBusLayout.h"
+
+namespace statebus {
+
+    class StateBusReader final {
+    public:
+        explicit StateBusReader(std::string name = "/coinbot_state");
+        ~StateBusReader();
+
+        StateBusReader(const StateBusReader&) = delete;
+        StateBusReader& operator=(const StateBusReader&) = delete;
+
+        bool open();
+        void close() noexcept;
+        bool reopen() { close(); return open(); }
+        bool isOpen() const noexcept { return header_ != nullptr; }
+
+        struct Info {
+            std::int64_t writer_pid{ 0 };
+            std::int64_t started_at_ms{ 0 };
+            std::int64_t heartbeat_ms{ 0 };
+            std::uint32_t market_count{ 0 };
+        };
+
+        Info info() const noexcept;
+
+        // 현재 발행된 마켓 수 (슬롯은 추가만 되므로 index < marketCount()는 계속 유효)
+        std::size_t marketCount() const noexcept;
+
+        // index 슬롯의 일관된 사본 (out.version = 발행 횟수, 0이면 아직 발행 전)
+        bool read(std::size_t index, MarketState& out) const noexcept;
+
+    private:
+        std::string name_;
+        void* base_{ nullptr };
+        std::size_t size_{ 0 };
+        const Header* header_{ nullptr };
+        const MarketSlot* slots_{ nullptr };
+    };
+
+} // namespace statebus
@@ -0,0 +1,201 @@
+// statebus/StateBusWriter.cpp
+#include "statebus/StateBusWriter.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define COINBOT_STATEBUS_POSIX 1
+#endif
+
+#include "util/Logger.h"
+
+namespace statebus {
+
+    namespace {
+
+        std::int64_t wallNowMs() noexcept {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+    } // anonymous namespace
+
+    StateBusWriter::StateBusWriter(Options opt)
+        : opt_(std::move(opt))
+    {
+        opt_.market_capacity = std::max<std::size_t>(1, opt_.market_capacity);
+    }
+
+    StateBusWriter::~StateBusWriter()
+    {
+        close_();
+    }
+
+    bool StateBusWriter::open()
+    {
+        auto& logger = util::Logger::instance();
+        if (isOpen()) return true;
+
+#if defined(COINBOT_STATEBUS_POSIX)
+        const std::size_t size = segmentSize(opt_.market_capacity);
+
+        // 이전 실행이 남긴 세그먼트 제거 (이미 매핑한 reader는 옛 세그먼트를 계속 봄)
+        (void)::shm_unlink(opt_.name.c_str());
+
+        const int fd = ::shm_open(opt_.name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd < 0) {
+            logger.warn("[StateBus] shm_open failed: name=", opt_.name, " errno=", errno);
+            return false;
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            logger.warn("[StateBus] ftruncate failed: name=", opt_.name, " errno=", errno);
+            ::close(fd);
+            (void)::shm_unlink(opt_.name.c_str());
+            return false;
+        }
+
+        void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);    // 매핑은 fd와 무관하게 유지
+        if (base == MAP_FAILED) {
+            logger.warn("[StateBus] mmap failed: name=", opt_.name, " errno=", errno);
+            (void)::shm_unlink(opt_.name.c_str());
+            return false;
+        }
+
+        base_ = base;
+        size_ = size;
+
+        // ftruncate로 0 채워진 메모리 위에 객체 생성
+        header_ = ::new (base_) Header();
+        slots_ = reinterpret_cast<MarketSlot*>(static_cast<char*>(base_) + sizeof(Header));
+        for (std::size_t i = 0; i < opt_.market_capacity; ++i)
+            ::new (&slots_[i]) MarketSlot();
+
+        header_->version = kVersion;
+        header_->header_size = static_cast<std::uint16_t>(sizeof(Header));
+        header_->slot_size = static_cast<std::uint32_t>(sizeof(MarketSlot));
+        header_->market_capacity = static_cast<std::uint32_t>(opt_.market_capacity);
+        header_->writer_pid.store(static_cast<std::int64_t>(::getpid()), std::memory_order_relaxed);
+        header_->started_at_ms.store(wallNowMs(), std::memory_order_relaxed);
+        header_->heartbeat_ms.store(wallNowMs(), std::memory_order_relaxed);
+
+        // 헤더 완성 후 magic 발행 → reader는 magic(acquire) 확인 후에만 나머지 필드 신뢰
+        header_->magic.store(kMagic, std::memory_order_release);
+
+        logger.info("[StateBus] Opened: name=", opt_.name,
+            " capacity=", opt_.market_capacity, " bytes=", size);
+        return true;
+#else
+        logger.warn("[StateBus] POSIX shared memory unavailable on this platform (disabled)");
+        return false;
+#endif
+    }
+
+    void StateBusWriter::close_() noexcept
+    {
+#if defined(COINBOT_STATEBUS_POSIX)
+        if (!base_) return;
+        ::munmap(base_, size_);
+        (void)::shm_unlink(opt_.name.c_str());
+#endif
+        base_ = nullptr;
+        size_ = 0;
+        header_ = nullptr;
+        slots_ = nullptr;
+    }
+
+    MarketSlot* StateBusWriter::addMarket(std::string_view market)
+    {
+        if (!header_) return nullptr;
+
+        const std::uint32_t idx = header_->market_count.load(std::memory_order_relaxed);
+        const std::size_t n = std::min(market.size(), kMarketNameSize - 1);
+        for (std::uint32_t i = 0; i < idx; ++i) {
+            if (std::string_view(slots_[i].market) == market.substr(0, n))
+                return &slots_[i];
+        }
+
+        if (idx >= header_->market_capacity) {
+            util::Logger::instance().warn("[StateBus] Capacity exceeded, market not published: ", market);
+            return nullptr;
+        }
+
+        MarketSlot& slot = slots_[idx];
+        std::memcpy(slot.market, market.data(), n);
+        slot.market[n] = '\0';
+
+        // 이름 기록 후 개수 발행 (reader는 market_count acquire 이후 이름을 읽음)
+        header_->market_count.store(idx + 1, std::memory_order_release);
+        return &slot;
+    }
+
+    void StateBusWriter::publish(MarketSlot& slot, const MarketState& s) noexcept
+    {
+        const std::int64_t now_ms = wallNowMs();
+
+        const std::uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+        slot.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.updated_at_ms.store(now_ms, std::memory_order_relaxed);
+        slot.strategy_state.store(s.strategy_state, std::memory_order_relaxed);
+        slot.flags.store(s.flags, std::memory_order_relaxed);
+
+        slot.candle_open.store(s.candle_open, std::memory_order_relaxed);
+        slot.candle_high.store(s.candle_high, std::memory_order_relaxed);
+        slot.candle_low.store(s.candle_low, std::memory_order_relaxed);
+        slot.candle_close.store(s.candle_close, std::memory_order_relaxed);
+        slot.candle_volume.store(s.candle_volume, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < kCandleTsSize / 8; ++i) {
+            std::uint64_t word = 0;
+            std::memcpy(&word, s.candle_ts + i * 8, 8);
+            slot.candle_ts[i].store(word, std::memory_order_relaxed);
+        }
+
+        slot.rsi.store(s.rsi, std::memory_order_relaxed);
+        slot.volatility.store(s.volatility, std::memory_order_relaxed);
+        slot.trend_strength.store(s.trend_strength, std::memory_order_relaxed);
+
+        slot.best_bid.store(s.best_bid, std::memory_order_relaxed);
+        slot.best_ask.store(s.best_ask, std::memory_order_relaxed);
+        slot.bid_depth_krw.store(s.bid_depth_krw, std::memory_order_relaxed);
+        slot.ask_depth_krw.store(s.ask_depth_krw, std::memory_order_relaxed);
+
+        slot.available_krw.store(s.available_krw, std::memory_order_relaxed);
+        slot.reserved_krw.store(s.reserved_krw, std::memory_order_relaxed);
+        slot.coin_balance.store(s.coin_balance, std::memory_order_relaxed);
+        slot.avg_entry_price.store(s.avg_entry_price, std::memory_order_relaxed);
+        slot.initial_capital.store(s.initial_capital, std::memory_order_relaxed);
+        slot.realized_pnl.store(s.realized_pnl, std::memory_order_relaxed);
+
+        slot.queue_depth.store(s.queue_depth, std::memory_order_relaxed);
+        slot.queue_dropped.store(s.queue_dropped, std::memory_order_relaxed);
+
+        slot.seq.store(seq + 2, std::memory_order_release);
+
+        // 여러 워커가 쓰지만 단순 최신값 (생존 판정용)
+        header_->heartbeat_ms.store(now_ms, std::memory_order_relaxed);
+    }
+
+    void StateBusWriter::markRemoved(MarketSlot& slot) noexcept
+    {
+        const std::uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+        slot.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.updated_at_ms.store(wallNowMs(), std::memory_order_relaxed);
+        slot.flags.fetch_or(kRemoved, std::memory_order_relaxed);
+
+        slot.seq.store(seq + 2, std::memory_order_release);
+    }
+
+} // namespace statebus
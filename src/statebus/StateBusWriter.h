@@ -0,0 +1,61 @@
+// statebus/StateBusWriter.h
+//
+// 라이브 상태 버스 writer (봇 프로세스)
+// - POSIX shm 세그먼트 생성 (이전 실행이 남긴 세그먼트는 덮어씀), 소멸 시 unlink
+// - addMarket()으로 마켓별 슬롯 할당 → 해당 마켓 워커만 publish() (슬롯별 단일 writer)
+// - POSIX가 아닌 플랫폼에서는 open()이 false (버스 비활성, 봇 동작에는 영향 없음)
+//
+// 생명주기: 생성 → open() → addMarket()… → publish() (워커) → 소멸
+// 런타임 마켓 추가/제거: addMarket()/markRemoved()는 제어 스레드 1개에서만 호출 (슬롯은 추가만 됨)
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "statebus/StateBusLayout.h"
+
+namespace statebus {
+
+    class StateBusWriter final {
+    public:
+        struct Options {
+            std::string name = "/coinbot_state";    // shm_open 이름 (/dev/shm/coinbot_state)
+            std::size_t market_capacity = 64;
+        };
+
+        explicit StateBusWriter(Options opt);
+        ~StateBusWriter();
+
+        StateBusWriter(const StateBusWriter&) = delete;
+        StateBusWriter& operator=(const StateBusWriter&) = delete;
+
+        // 세그먼트 생성 + 헤더 초기화, 실패 시 false (로그 기록)
+        bool open();
+        bool isOpen() const noexcept { return header_ != nullptr; }
+
+        // 마켓 슬롯 할당 (단일 제어 스레드에서 호출, 워커 발행과 동시 호출 가능)
+        // 같은 이름의 슬롯이 이미 있으면(제거 후 재추가) 그 슬롯을 재사용
+        // @return 용량 초과/미오픈 시 nullptr
+        MarketSlot* addMarket(std::string_view market);
+
+        // 제거된 마켓 표시 (kRemoved 플래그, 해당 슬롯의 워커가 정지한 뒤 호출)
+        void markRemoved(MarketSlot& slot) noexcept;
+
+        // 슬롯 발행 (해당 슬롯의 유일한 writer 스레드에서 호출, 락/할당 없음)
+        // s.market/s.version은 무시 (슬롯 이름/seq 사용)
+        void publish(MarketSlot& slot, const MarketState& s) noexcept;
+
+        const std::string& name() const noexcept { return opt_.name; }
+
+    private:
+        void close_() noexcept;
+
+        Options opt_;
+        void* base_{ nullptr };
+        std::size_t size_{ 0 };
+        Header* header_{ nullptr };
+        MarketSlot* slots_{ nullptr };
+    };
+
+} // namespace statebus
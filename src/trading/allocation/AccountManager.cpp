@@ -64,32 +64,38 @@ namespace trading::allocation {
             throw std::invalid_argument("AccountManager: markets cannot be empty");
         }
 
-        // 1단계: 마켓별 예산 초기화 (0으로)
+        // dust 임계값: Config에서 로드 (formatDecimalFloor로 인한 잔량 처리)
+        const auto& cfg = util::AppConfig::instance().account;
+        const core::Amount init_dust_threshold = cfg.init_dust_threshold_krw;
+
+        // 1단계: 마켓별 예산 slot 생성 (0으로 초기화, 용량은 런타임 추가분 포함해 고정)
+        auto index = std::make_unique<SlotIndex>();
         for (const auto& market : markets) {
-            MarketBudget budget;
-            budget.market = market;
-            budget.available_krw = 0;
-            budget.reserved_krw = 0;
-            budget.coin_balance = 0;
-            budget.avg_entry_price = 0;
-            budget.initial_capital = 0;
-            budget.realized_pnl = 0;
+            index->by_market.emplace(market, 0);
+        }
+
+        slot_capacity_ = std::max(index->by_market.size(), cfg.max_markets);
+        slots_ = std::make_unique<BudgetSlot[]>(slot_capacity_);
 
-            budgets_[market] = std::move(budget);
+        std::size_t next = 0;
+        for (auto& [market, idx] : index->by_market) {
+            idx = next++;
+            slots_[idx].budget.market = market;
+            index->active.push_back(idx);
         }
 
+        const SlotIndex& initial = *index;
+        index_.store(index.get(), std::memory_order_release);
+        index_history_.push_back(std::move(index));
+
         // 2단계: 실제 계좌의 코인 포지션 반영 및 initial_capital 설정
-        // dust 임계값: Config에서 로드 (formatDecimalFloor로 인한 잔량 처리)
-        const auto& cfg = util::AppConfig::instance().account;
-        const core::Amount init_dust_threshold = cfg.init_dust_threshold_krw;
 
         for (const auto& pos : account.positions) {
             // 마켓 코드 구성: "KRW-" + currency (예: "BTC" -> "KRW-BTC")
             std::string market = "KRW-" + pos.currency;
 
-            auto it = budgets_.find(market);
-            if (it != budgets_.end()) {
-                MarketBudget& budget = it->second;
+            if (BudgetSlot* slot = findSlot_(market)) {
+                MarketBudget& budget = slot->budget;
 
                 // 코인 가치 계산
                 core::Amount coin_value = pos.free * pos.avg_buy_price;
@@ -116,13 +122,14 @@ namespace trading::allocation {
 
         if (remaining_krw <= 0) {
             // 모든 자산이 코인으로 전환된 상태 (정상)
+            publishAll_(initial);
             return;
         }
 
         // 코인이 없는 마켓 카운트
         int markets_without_coin = 0;
-        for (const auto& [_, budget] : budgets_) {
-            if (budget.coin_balance == 0) {
+        for (std::size_t i : initial.active) {
+            if (slots_[i].budget.coin_balance == 0) {
                 markets_without_coin++;
             }
         }
@@ -131,38 +138,91 @@ namespace trading::allocation {
             // 남은 KRW를 코인 없는 마켓에 전액 균등 분배
             core::Amount per_market = remaining_krw / static_cast<double>(markets_without_coin);
 
-            for (auto& [_, budget] : budgets_) {
+            for (std::size_t i : initial.active) {
+                MarketBudget& budget = slots_[i].budget;
                 if (budget.coin_balance == 0) {
                     budget.available_krw = per_market;
                     budget.initial_capital = per_market;
                 }
             }
         }
+
+        publishAll_(initial);
+    }
+
+    // --- slot 조회/락 헬퍼 ---
+    AccountManager::BudgetSlot* AccountManager::findSlot_(std::string_view market) const noexcept {
+        const SlotIndex* index = index_.load(std::memory_order_acquire);
+        auto it = index->by_market.find(market);
+        if (it == index->by_market.end()) {
+            return nullptr;
+        }
+        return &slots_[it->second];
+    }
+
+    AccountManager::AllLocked AccountManager::lockAll_() const {
+        for (;;) {
+            AllLocked out;
+            out.index = index_.load(std::memory_order_acquire);
+            out.locks.reserve(out.index->active.size());
+            for (std::size_t i : out.index->active) {
+                out.locks.emplace_back(slots_[i].mtx);
+            }
+
+            // 구성 변경은 기존 slot 락을 모두 잡은 상태에서만 발행 → 여기서 같으면 이후로도 고정
+            if (index_.load(std::memory_order_acquire) == out.index) {
+                return out;
+            }
+        }
+    }
+
+    void AccountManager::publishAll_(const SlotIndex& index) noexcept {
+        for (std::size_t i : index.active) {
+            publish_(slots_[i]);
+        }
+    }
+
+    void AccountManager::publishIndex_(std::unique_ptr<SlotIndex> next) {
+        index_.store(next.get(), std::memory_order_release);
+        index_history_.push_back(std::move(next));
     }
 
     // --- 조회 메서드 ---
+    const PublishedBalances* AccountManager::publishedBalances(std::string_view market) const noexcept {
+        const BudgetSlot* slot = findSlot_(market);
+        return slot ? &slot->published : nullptr;
+    }
+
     std::optional<MarketBudget> AccountManager::getBudget(std::string_view market) const {
-        std::shared_lock lock(mtx_);
+        const BudgetSlot* slot = findSlot_(market);
+        if (slot == nullptr) {
+            return std::nullopt;
+        }
 
-        auto it = budgets_.find(std::string(market));
-        if (it == budgets_.end()) {
+        std::lock_guard lock(slot->mtx);
+        // 조회와 락 사이에 제거 후 다른 마켓에 재사용된 slot이면 미등록 취급
+        if (slot->budget.market != market) {
             return std::nullopt;
         }
-        return it->second;  // 복사본 반환
+        return slot->budget;  // 복사본 반환
     }
 
     std::map<std::string, MarketBudget> AccountManager::snapshot() const {
-        std::shared_lock lock(mtx_);
-        return budgets_;  // 복사본 반환
+        std::map<std::string, MarketBudget> out;
+
+        // 모든 slot을 동시에 잠근 상태에서 복사 (마켓 간 일관된 시점)
+        const auto all = lockAll_();
+        for (const auto& [market, idx] : all.index->by_market) {
+            out.emplace_hint(out.end(), market, slots_[idx].budget);
+        }
+        return out;  // 복사본 반환
     }
 
     // --- 예약 메서드 ---
     std::optional<ReservationToken> AccountManager::reserve(std::string_view market,
                                                             core::Amount krw_amount) {
-        std::unique_lock lock(mtx_);
-
-		auto it = budgets_.find(std::string(market)); // 못찾으면 .end() 반환
-		if (it == budgets_.end()) { // .end()는 마지막 요소 다음 위치를 가리킴
+		BudgetSlot* slot = findSlot_(market); // 못찾으면 nullptr
+		if (slot == nullptr) {
             stats_.reserve_failures.fetch_add(1, std::memory_order_relaxed);
             return std::nullopt;  // 마켓 미등록
         }
@@ -174,7 +234,8 @@ namespace trading::allocation {
             return std::nullopt;
         }
 
-        MarketBudget& budget = it->second;
+        std::unique_lock lock(slot->mtx);
+        MarketBudget& budget = slot->budget;
 
         // 잔액 확인
         if (budget.available_krw < krw_amount) {
@@ -185,6 +246,7 @@ namespace trading::allocation {
         // 예약 적용
         budget.available_krw -= krw_amount;
         budget.reserved_krw += krw_amount;
+        publish_(*slot);
 
         uint64_t token_id = next_token_id_.fetch_add(1, std::memory_order_relaxed);
         stats_.total_reserves.fetch_add(1, std::memory_order_relaxed);
@@ -203,16 +265,9 @@ namespace trading::allocation {
         token.deactivate();
     }
 
-    void AccountManager::releaseInternal(const std::string& market,
+    void AccountManager::releaseInternal(MarketBudget& budget,
                                          core::Amount remaining_amount) {
-        // 호출자가 락을 보유해야 함
-        auto it = budgets_.find(market);
-        if (it == budgets_.end()) {
-            return;
-        }
-
-        MarketBudget& budget = it->second;
-
+        // 호출자가 해당 slot 락을 보유해야 함
         // 미사용 금액 복구
         budget.reserved_krw -= remaining_amount;
         budget.available_krw += remaining_amount;
@@ -232,8 +287,13 @@ namespace trading::allocation {
         // - 소멸자에서는 토큰 객체를 release()에 전달할 수 없음
         // - noexcept 보장으로 소멸자와 move 연산 안전성 확보
         try {
-            std::unique_lock lock(mtx_);
-            releaseInternal(market, remaining_amount);
+            BudgetSlot* slot = findSlot_(market);
+            if (slot == nullptr) {
+                return;
+            }
+            std::unique_lock lock(slot->mtx);
+            releaseInternal(slot->budget, remaining_amount);
+            publish_(*slot);
             stats_.total_releases.fetch_add(1, std::memory_order_relaxed);
         } catch (...) {
             // noexcept 보장: 예외 발생 시 무시 (최선의 노력)
@@ -269,14 +329,13 @@ namespace trading::allocation {
             }
         }
 
-        std::unique_lock lock(mtx_);
-
-        auto it = budgets_.find(token.market());
-        if (it == budgets_.end()) {
+        BudgetSlot* slot = findSlot_(token.market());
+        if (slot == nullptr) {
             return;
         }
 
-        MarketBudget& budget = it->second;
+        std::unique_lock lock(slot->mtx);
+        MarketBudget& budget = slot->budget;
 
         // reserved_krw 차감 (체결 완료된 금액)
         budget.reserved_krw -= executed_krw;
@@ -297,6 +356,7 @@ namespace trading::allocation {
 
         // 코인 잔고 증가
         budget.coin_balance = new_balance;
+        publish_(*slot);
 
         // 토큰에 체결 금액 누적
         token.addConsumed(executed_krw);
@@ -315,14 +375,13 @@ namespace trading::allocation {
             return;
         }
 
-        std::unique_lock lock(mtx_);
-
-        auto it = budgets_.find(std::string(market));
-        if (it == budgets_.end()) {
+        BudgetSlot* slot = findSlot_(market);
+        if (slot == nullptr) {
             return;
         }
 
-        MarketBudget& budget = it->second;
+        std::unique_lock lock(slot->mtx);
+        MarketBudget& budget = slot->budget;
 
         // 코인 잔고 감소
         const core::Volume balance_before = budget.coin_balance;
@@ -332,20 +391,20 @@ namespace trading::allocation {
 
         // KRW 잔고 증가 (실제 매도량에 대한 금액만)
         budget.available_krw += received_krw;
+        publish_(*slot);
 
         stats_.total_fills_sell.fetch_add(1, std::memory_order_relaxed);
     }
 
     void AccountManager::finalizeSellOrder(std::string_view market,
                                            std::optional<core::Price> mark_price) {
-        std::unique_lock lock(mtx_);
-
-        auto it = budgets_.find(std::string(market));
-        if (it == budgets_.end()) {
+        BudgetSlot* slot = findSlot_(market);
+        if (slot == nullptr) {
             return;
         }
 
-        MarketBudget& budget = it->second;
+        std::unique_lock lock(slot->mtx);
+        MarketBudget& budget = slot->budget;
         const auto& cfg = util::AppConfig::instance().account;
 
         bool should_clear_coin = false;
@@ -373,6 +432,9 @@ namespace trading::allocation {
 
         // 주문 종료 시점에만 실현 손익을 확정한다.
         budget.realized_pnl = budget.available_krw - budget.initial_capital;
+
+        // 코인 정리 + 확정 손익을 한 번에 발행
+        publish_(*slot);
     }
 
     void AccountManager::finalizeOrder(ReservationToken&& token) {
@@ -380,20 +442,19 @@ namespace trading::allocation {
             return;
         }
 
-        std::unique_lock lock(mtx_);
-
-        auto it = budgets_.find(token.market());
-        if (it == budgets_.end()) {
+        BudgetSlot* slot = findSlot_(token.market());
+        if (slot == nullptr) {
             token.deactivate();
             return;
         }
 
-        MarketBudget& budget = it->second;
+        std::unique_lock lock(slot->mtx);
+        MarketBudget& budget = slot->budget;
 
         // 미사용 잔액을 available로 복구 (releaseInternal 재사용으로 코드 중복 제거)
         core::Amount remaining = token.remaining();
         if (remaining > 0) {
-            releaseInternal(token.market(), remaining);
+            releaseInternal(budget, remaining);
         }
 
         // formatDecimalFloor로 인한 reserved_krw 미세 잔량 정리
@@ -403,6 +464,7 @@ namespace trading::allocation {
             budget.available_krw += budget.reserved_krw;
             budget.reserved_krw = 0;
         }
+        publish_(*slot);
 
         token.deactivate();
     }
@@ -412,7 +474,12 @@ namespace trading::allocation {
     // 시작/수동점검 전용 전체 재구축
     // 런타임 복구에서는 호출 금지
     void AccountManager::rebuildFromAccount(const core::Account& account) {
-        std::unique_lock lock(mtx_);
+        // 미배정 KRW도 재설정 → 마켓 추가/제거와 직렬화 (락 순서: membership → slot)
+        std::lock_guard membership(membership_mtx_);
+
+        // 전체 재구축 동안 모든 마켓 정지 (중간 상태가 보이지 않도록)
+        const auto all = lockAll_();
+        const SlotIndex& index = *all.index;
 
         // 실제 KRW 잔고
         core::Amount actual_free_krw = account.krw_free;
@@ -423,7 +490,8 @@ namespace trading::allocation {
 
         // 1단계: 모든 마켓의 코인 잔고를 먼저 0으로 리셋
         // 중요: account.positions에 없는 마켓(외부 거래로 전량 매도 등)을 처리하기 위함
-        for (auto& [market, budget] : budgets_) {
+        for (std::size_t i : index.active) {
+            MarketBudget& budget = slots_[i].budget;
             budget.coin_balance = 0;
             budget.avg_entry_price = 0;
             // available_krw와 reserved_krw는 아래에서 재설정
@@ -435,9 +503,8 @@ namespace trading::allocation {
             // 마켓 코드 구성: "KRW-" + currency
             std::string market = "KRW-" + pos.currency;
 
-            auto it = budgets_.find(market);
-            if (it != budgets_.end()) {
-                MarketBudget& budget = it->second;
+            if (BudgetSlot* slot = findSlot_(market)) {
+                MarketBudget& budget = slot->budget;
 
                 // 코인 가치 계산 (생성자와 동일)
                 core::Amount coin_value = pos.free * pos.avg_buy_price;
@@ -463,29 +530,179 @@ namespace trading::allocation {
 
         // 3단계: 코인이 없는 마켓 식별 (KRW 보유 가능 마켓)
         // coin_epsilon은 formatDecimalFloor로 인한 미세 잔량만 체크
-        std::vector<std::string> flat_markets;
-        for (const auto& [market, budget] : budgets_) {
-            if (budget.coin_balance < cfg.coin_epsilon) {
-                flat_markets.push_back(market);
+        std::vector<MarketBudget*> flat_markets;
+        for (std::size_t i : index.active) {
+            if (slots_[i].budget.coin_balance < cfg.coin_epsilon) {
+                flat_markets.push_back(&slots_[i].budget);
             }
         }
 
         // 모든 마켓이 코인 보유 중 → 정상 상태 (전량 매수 완료)
+        // 등록된 마켓이 하나도 없으면 실제 KRW는 미배정으로 보관
         if (flat_markets.empty()) {
+            unallocated_krw_ = index.active.empty() ? actual_free_krw : 0.0;
+            publishAll_(index);
             return;
         }
+        unallocated_krw_ = 0.0;
 
         // 4단계: 실제 free KRW를 코인 없는 마켓에 전액 균등 분배
         core::Amount per_market = actual_free_krw / static_cast<double>(flat_markets.size());
 
-        for (const auto& market : flat_markets) {
-            auto it = budgets_.find(market);
-            if (it != budgets_.end()) {
-                it->second.available_krw = per_market;
-                // reserved는 복구 시 0으로 리셋 (미체결 주문은 이미 취소되었다고 가정)
-                it->second.reserved_krw = 0.0;
+        for (MarketBudget* budget : flat_markets) {
+            budget->available_krw = per_market;
+            // reserved는 복구 시 0으로 리셋 (미체결 주문은 이미 취소되었다고 가정)
+            budget->reserved_krw = 0.0;
+        }
+
+        publishAll_(index);
+    }
+
+    // --- 런타임 마켓 추가/제거 ---
+
+    bool AccountManager::addMarket(std::string_view market,
+                                   const std::optional<core::Position>& position) {
+        std::lock_guard membership(membership_mtx_);
+
+        // 모든 마켓 정지 (재분배 중간 상태가 보이지 않도록)
+        auto all = lockAll_();
+        const SlotIndex& current = *all.index;
+
+        if (current.by_market.count(market) > 0) {
+            return false;
+        }
+
+        // 빈 slot 탐색 (사용 중 목록은 오름차순)
+        std::size_t free_idx = 0;
+        for (std::size_t used : current.active) {
+            if (used != free_idx) break;
+            ++free_idx;
+        }
+        if (free_idx >= slot_capacity_) {
+            return false;
+        }
+
+        BudgetSlot& slot = slots_[free_idx];
+        all.locks.emplace_back(slot.mtx);
+
+        MarketBudget& budget = slot.budget;
+        budget = MarketBudget{};
+        budget.market = std::string(market);
+
+        const auto& cfg = util::AppConfig::instance().account;
+        const core::Amount coin_value = position ? position->free * position->avg_buy_price : 0.0;
+
+        if (position && coin_value >= cfg.init_dust_threshold_krw) {
+            // 이미 코인 보유 → 포지션만 이어받음 (전량 거래 모델: KRW 0)
+            budget.coin_balance = position->free;
+            budget.avg_entry_price = position->avg_buy_price;
+            budget.initial_capital = coin_value;
+        } else {
+            // Flat 유휴 마켓에서 (n+1)등분 1몫씩 이전
+            std::vector<MarketBudget*> donors;
+            for (std::size_t i : current.active) {
+                MarketBudget& b = slots_[i].budget;
+                if (b.coin_balance < cfg.coin_epsilon && b.reserved_krw <= 0 && b.available_krw > 0) {
+                    donors.push_back(&b);
+                }
             }
+
+            const double shares = static_cast<double>(donors.size() + 1);
+            for (MarketBudget* donor : donors) {
+                // 원금도 옮긴 현금만큼만 줄임 → 기여 마켓은 실현 손익 유지, 새 마켓은 손익 0에서 시작
+                const core::Amount moved = donor->available_krw / shares;
+                donor->available_krw -= moved;
+                donor->initial_capital -= moved;
+                budget.available_krw += moved;
+                budget.initial_capital += moved;
+            }
+
+            // 마지막 마켓 제거 때 보관한 미배정 KRW 흡수
+            budget.available_krw += unallocated_krw_;
+            budget.initial_capital += unallocated_krw_;
+            unallocated_krw_ = 0.0;
+        }
+
+        auto next = std::make_unique<SlotIndex>(current);
+        next->by_market.emplace(std::string(market), free_idx);
+        next->active.insert(std::lower_bound(next->active.begin(), next->active.end(), free_idx),
+                            free_idx);
+
+        publishAll_(*next);
+        publishIndex_(std::move(next));
+        return true;
+    }
+
+    bool AccountManager::removeMarket(std::string_view market) {
+        std::lock_guard membership(membership_mtx_);
+
+        auto all = lockAll_();
+        const SlotIndex& current = *all.index;
+
+        auto it = current.by_market.find(market);
+        if (it == current.by_market.end()) {
+            return false;
+        }
+
+        const std::size_t idx = it->second;
+        MarketBudget& budget = slots_[idx].budget;
+
+        // 청산 전(예약 또는 유효 코인 보유)에는 제거 불가
+        const auto& cfg = util::AppConfig::instance().account;
+        const bool holds_coin = budget.coin_balance >= cfg.coin_epsilon &&
+            budget.coin_balance * budget.avg_entry_price >= cfg.init_dust_threshold_krw;
+        if (budget.reserved_krw > 0 || holds_coin) {
+            return false;
+        }
+
+        // 남은 KRW 반환 대상: Flat 유휴 마켓 → 없으면 남은 마켓 전체
+        std::vector<MarketBudget*> recipients;
+        for (std::size_t i : current.active) {
+            MarketBudget& b = slots_[i].budget;
+            if (i != idx && b.coin_balance < cfg.coin_epsilon && b.reserved_krw <= 0) {
+                recipients.push_back(&b);
+            }
+        }
+        if (recipients.empty()) {
+            for (std::size_t i : current.active) {
+                if (i != idx) recipients.push_back(&slots_[i].budget);
+            }
+        }
+
+        if (budget.available_krw > 0) {
+            if (recipients.empty()) {
+                // 마지막 마켓 → 잃지 않도록 미배정으로 보관 (다음 addMarket이 흡수)
+                unallocated_krw_ += budget.available_krw;
+            } else {
+                const core::Amount share = budget.available_krw / static_cast<double>(recipients.size());
+                for (MarketBudget* r : recipients) {
+                    r->available_krw += share;
+                    r->initial_capital += share;
+                }
+            }
+        }
+
+        auto next = std::make_unique<SlotIndex>(current);
+        next->by_market.erase(next->by_market.find(market));
+        next->active.erase(std::find(next->active.begin(), next->active.end(), idx));
+
+        // slot 비우기 (재사용 대비, 캐시된 발행 포인터도 0 잔고를 보게 됨)
+        budget = MarketBudget{};
+        publish_(slots_[idx]);
+
+        publishAll_(*next);
+        publishIndex_(std::move(next));
+        return true;
+    }
+
+    std::vector<std::string> AccountManager::markets() const {
+        const SlotIndex* index = index_.load(std::memory_order_acquire);
+        std::vector<std::string> out;
+        out.reserve(index->by_market.size());
+        for (const auto& [market, idx] : index->by_market) {
+            out.push_back(market);
         }
+        return out;
     }
 
 } // namespace trading::allocation
@@ -2,11 +2,12 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -66,6 +67,82 @@ namespace trading::allocation {
         }
     };
 
+    /*
+     * BudgetBalances
+     *
+     * 전략/엔진 핫패스용 마켓 잔고 요약 (POD, 할당 없음)
+     * - version: 발행 횟수 (같은 값이면 직전 조회 이후 변경 없음)
+     */
+    struct BudgetBalances {
+        core::Amount krw_available{0};  // MarketBudget::available_krw
+        core::Volume coin_balance{0};   // MarketBudget::coin_balance
+        core::Amount reserved_krw{0};   // 이하 관측용 (상태 버스/대시보드)
+        core::Price avg_entry_price{0};
+        core::Amount initial_capital{0};
+        core::Amount realized_pnl{0};
+        std::uint64_t version{0};
+    };
+
+    /*
+     * PublishedBalances
+     *
+     * 마켓 1개의 BudgetBalances를 seqlock으로 발행
+     * - 쓰기: AccountManager가 slot 락을 잡은 상태에서만 publish (단일 writer)
+     * - 읽기: 락/할당 없이 load() (writer와 겹치면 재시도)
+     * - 각 필드는 atomic이므로 torn read가 있어도 UB 없이 seq 비교로 폐기됨
+     */
+    class PublishedBalances {
+    public:
+        BudgetBalances load() const noexcept {
+            for (;;) {
+                const std::uint64_t s1 = seq_.load(std::memory_order_acquire);
+                if (s1 & 1u) {
+                    continue;  // 쓰기 진행 중
+                }
+
+                BudgetBalances out;
+                out.krw_available = krw_.load(std::memory_order_relaxed);
+                out.coin_balance = coin_.load(std::memory_order_relaxed);
+                out.reserved_krw = reserved_.load(std::memory_order_relaxed);
+                out.avg_entry_price = avg_entry_.load(std::memory_order_relaxed);
+                out.initial_capital = initial_.load(std::memory_order_relaxed);
+                out.realized_pnl = realized_.load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (seq_.load(std::memory_order_relaxed) == s1) {
+                    out.version = s1 >> 1;
+                    return out;
+                }
+            }
+        }
+
+    private:
+        friend class AccountManager;
+
+        void publish(const MarketBudget& b) noexcept {
+            const std::uint64_t s = seq_.load(std::memory_order_relaxed);
+            seq_.store(s + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            krw_.store(b.available_krw, std::memory_order_relaxed);
+            coin_.store(b.coin_balance, std::memory_order_relaxed);
+            reserved_.store(b.reserved_krw, std::memory_order_relaxed);
+            avg_entry_.store(b.avg_entry_price, std::memory_order_relaxed);
+            initial_.store(b.initial_capital, std::memory_order_relaxed);
+            realized_.store(b.realized_pnl, std::memory_order_relaxed);
+
+            seq_.store(s + 2, std::memory_order_release);
+        }
+
+        std::atomic<std::uint64_t> seq_{0};     // 홀수 = 쓰기 중
+        std::atomic<core::Amount> krw_{0};
+        std::atomic<core::Volume> coin_{0};
+        std::atomic<core::Amount> reserved_{0};
+        std::atomic<core::Price> avg_entry_{0};
+        std::atomic<core::Amount> initial_{0};
+        std::atomic<core::Amount> realized_{0};
+    };
+
     // Forward declaration
     class AccountManager;
 
@@ -144,13 +221,16 @@ namespace trading::allocation {
      *
      * [전량 거래 방식]
      * - 각 마켓은 할당된 금액 전부로 매수 → 전부 매도 반복
-     * - 마켓 간 자금 이동 없음 (rebalance 제거)
+     * - 거래 중 마켓 간 자금 이동 없음 (rebalance 제거)
+     *   예외: 런타임 마켓 추가/제거 시 Flat 유휴 마켓과의 KRW 재분배 (addMarket/removeMarket)
      * - 수익/손실은 각 마켓에서 독립적으로 누적
      *
      * [Thread-Safety]
-     * - 모든 public 메서드는 shared_mutex로 보호
-     * - 읽기 전용 메서드(getBudget, snapshot)는 shared_lock
-     * - 쓰기 메서드(reserve, release, finalize*)는 unique_lock
+     * - 예산 slot 배열은 생성 시 용량 고정(AccountConfig::max_markets), slot마다 독립 mutex
+     * - market → slot 인덱스는 불변 스냅샷을 atomic 포인터로 교체 (조회는 락 없음)
+     *   옛 스냅샷은 소멸 시까지 보관 (마켓 구성 변경은 드묾 → 회수 없이 조회 경로 무비용)
+     * - 마켓 단위 메서드(getBudget, reserve, release, finalize*)는 해당 slot 락만 잡음
+     * - 전체 뷰(snapshot, rebuildFromAccount)와 마켓 추가/제거는 모든 slot 락을 slot 순서로 잡아 일관성 보장
      *
      * [주문 흐름]
      *   reserve(available_krw) ──► submitBuyOrder() ──► finalizeFillBuy() ──► finalizeOrder()
@@ -186,7 +266,7 @@ namespace trading::allocation {
 
         ~AccountManager() = default;
 
-        // --- 조회 메서드 (shared_lock) ---
+        // --- 조회 메서드 (slot 락) ---
 
         /*
          * 특정 마켓의 예산 정보 조회
@@ -195,12 +275,21 @@ namespace trading::allocation {
         std::optional<MarketBudget> getBudget(std::string_view market) const;
 
         /*
-         * 전체 마켓 스냅샷 조회
+         * 전체 마켓 스냅샷 조회 (모든 slot 락 → 한 시점의 일관된 뷰)
          * @return 모든 마켓의 MarketBudget 맵
          */
         std::map<std::string, MarketBudget> snapshot() const;
 
-        // --- 예약 메서드 (unique_lock) ---
+        /*
+         * 마켓 잔고 발행 채널 (락 없는 조회용)
+         * @return 등록되지 않은 마켓이면 nullptr
+         *
+         * 포인터는 AccountManager 수명 동안 유효 → 호출자가 1회 받아 캐시
+         * 모든 정산 메서드가 slot 락 안에서 갱신 직후 발행한다.
+         */
+        const PublishedBalances* publishedBalances(std::string_view market) const noexcept;
+
+        // --- 예약 메서드 (slot 락) ---
 
         /*
          * KRW 예약 요청
@@ -219,12 +308,12 @@ namespace trading::allocation {
          * 예약 해제 (주문 실패/취소 시), 비정상 종료 시
          * @param token: 예약 토큰 (move)
          *
-         * unique_lock(mtx_)를 스스로 잡아 thread-safe
+         * 해당 마켓 slot 락을 스스로 잡아 thread-safe
          * 미사용 금액(amount - consumed)을 available_krw로 복구
          */
         void release(ReservationToken&& token);
 
-        // --- 체결 정산 메서드 (unique_lock) ---
+        // --- 체결 정산 메서드 (slot 락) ---
 
         /*
          * 매수 체결 정산 (부분 체결 시 여러 번 호출 가능)
@@ -297,7 +386,7 @@ namespace trading::allocation {
          */
         void finalizeOrder(ReservationToken&& token);
 
-        // --- 초기화 전용 동기화 메서드 (unique_lock) ---
+        // --- 초기화 전용 동기화 메서드 (모든 slot 락) ---
 
         /*
          * 시작/수동점검 전용: 계좌 전체 기준으로 마켓별 예산을 재구축한다.
@@ -314,6 +403,37 @@ namespace trading::allocation {
          */
         void rebuildFromAccount(const core::Account& account);
 
+        // --- 런타임 마켓 추가/제거 (모든 slot 락) ---
+
+        /*
+         * 마켓 추가: 빈 slot 할당 + 예산 배분
+         * @param position: 거래소 계좌의 해당 코인 보유 (없으면 nullopt)
+         * @return 이미 등록됨/용량 초과 시 false
+         *
+         * [배분]
+         * - 유효 보유(가치 ≥ init_dust_threshold_krw)면 코인 포지션만 반영 (KRW 0)
+         * - 아니면 Flat 유휴 마켓(코인/예약 없음) n개의 available_krw를 각각 (n+1)등분해 1몫씩 이전
+         *   기존 마켓은 initial_capital도 이전 금액만큼 줄여 실현 손익 유지, 새 마켓은 받은 금액이 initial_capital
+         *   미배정 KRW(마지막 마켓 제거 시 보관분)가 있으면 전액 함께 받음
+         * - 엔진 생성 전에 호출할 것 (MarketEngine이 생성 시 publishedBalances를 캐시)
+         */
+        bool addMarket(std::string_view market,
+                       const std::optional<core::Position>& position = std::nullopt);
+
+        /*
+         * 마켓 제거: 남은 KRW를 Flat 유휴 마켓에 균등 반환 후 slot 해제
+         * (Flat 유휴 마켓이 없으면 남은 마켓 전체에 균등 반환, 받은 금액만큼 initial_capital 증가)
+         * (남은 마켓이 없으면 미배정 KRW로 보관 → 다음 addMarket이 흡수)
+         * @return 미등록이거나 예약/유효 코인 보유 중(청산 전)이면 false
+         *
+         * 호출자는 해당 마켓 엔진(토큰 보유자)을 먼저 정지해야 함
+         * 제거 후 그 마켓 이름으로의 호출은 미등록으로 무시됨
+         */
+        bool removeMarket(std::string_view market);
+
+        // 현재 등록된 마켓 목록 (정렬 순)
+        std::vector<std::string> markets() const;
+
         // --- 통계/디버깅 ---
 
         struct Stats {
@@ -327,10 +447,46 @@ namespace trading::allocation {
         const Stats& stats() const noexcept { return stats_; }
 
     private:
-		// 핵심 예약 해제 로직 (락 없음, 호출자가 락 보유) 중복 락을 잡지 않도록 락 없이 설계
-        // budgets_ 상태만 변경, 통계나 토큰 상태는 변경하지 않음
-        void releaseInternal(const std::string& market,
-                            core::Amount remaining_amount);
+        // 마켓 1개의 예산 + 전용 락 (캐시 라인 분리로 마켓 간 false sharing 방지)
+        struct alignas(64) BudgetSlot {
+            mutable std::mutex mtx;
+            MarketBudget budget;
+            PublishedBalances published;    // budget의 잔고 요약 (락 없는 읽기용)
+        };
+
+        // slot 락 보유 상태에서 budget 변경 후 호출
+        static void publish_(BudgetSlot& slot) noexcept {
+            slot.published.publish(slot.budget);
+        }
+
+        // market → slot 인덱스 불변 스냅샷 (구성 변경 시 새로 만들어 교체)
+        struct SlotIndex {
+            std::map<std::string, std::size_t, std::less<>> by_market;  // 정렬 순
+            std::vector<std::size_t> active;                            // 사용 중 slot (오름차순 = 락 순서)
+        };
+
+        // 모든 slot 락 + 잠근 시점의 인덱스 (잠그는 동안 구성이 바뀌면 재시도)
+        struct AllLocked {
+            const SlotIndex* index{nullptr};
+            std::vector<std::unique_lock<std::mutex>> locks;
+        };
+
+        // 사용 중 slot 발행 (생성자 또는 lockAll_ 보유 상태에서 호출)
+        void publishAll_(const SlotIndex& index) noexcept;
+
+        // market → slot (현재 인덱스 스냅샷을 락 없이 조회)
+        BudgetSlot* findSlot_(std::string_view market) const noexcept;
+
+        // 사용 중 slot 락 모두 획득 (항상 slot 순서 → 교착 없음)
+        AllLocked lockAll_() const;
+
+        // 새 인덱스 발행 (membership_mtx_ + 모든 slot 락 보유 상태에서 호출)
+        void publishIndex_(std::unique_ptr<SlotIndex> next);
+
+		// 핵심 예약 해제 로직 (락 없음, 호출자가 slot 락 보유) 중복 락을 잡지 않도록 락 없이 설계
+        // budget 상태만 변경, 통계나 토큰 상태는 변경하지 않음
+        static void releaseInternal(MarketBudget& budget,
+                                    core::Amount remaining_amount);
 
         // 토큰 없이 예약 해제 (락 포함, noexcept 보장)
         // ReservationToken의 operator= 및 소멸자에서만 사용
@@ -341,8 +497,12 @@ namespace trading::allocation {
         // ReservationToken에서 접근
         friend class ReservationToken;
 
-        mutable std::shared_mutex mtx_;                 // 읽기/쓰기 동기화
-        std::map<std::string, MarketBudget> budgets_;   // 마켓별 예산
+        std::size_t slot_capacity_{0};
+        std::unique_ptr<BudgetSlot[]> slots_;               // 마켓별 예산 (용량 고정, 제거된 slot은 재사용)
+        std::atomic<const SlotIndex*> index_{nullptr};      // 현재 인덱스 (acquire 조회)
+        std::vector<std::unique_ptr<const SlotIndex>> index_history_;   // 발행한 모든 인덱스 (소멸 시 해제)
+        std::mutex membership_mtx_;                         // addMarket/removeMarket 직렬화
+        core::Amount unallocated_krw_{0};                   // 받을 마켓 없이 제거된 KRW (membership_mtx_ 보호)
         std::atomic<uint64_t> next_token_id_{1};        // 토큰 ID 생성기
         Stats stats_;                                   // 통계
     };
@@ -0,0 +1,226 @@
+﻿#include "CrossMarketIndicators.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+// AVX2 빌드 전용 (CMake가 COINBOT_ENABLE_AVX2일 때만 이 TU를 -mavx2로 추가)
+#if !defined(COINBOT_ENABLE_AVX2) || !defined(__AVX2__)
+#error "CrossMarketIndicators.cpp requires COINBOT_ENABLE_AVX2 and an AVX2 target"
+#endif
+
+#include <immintrin.h>
+
+namespace trading::indicators {
+
+    namespace {
+
+        void zeroAt(std::vector<double>& v, std::size_t i) noexcept { v[i] = 0.0; }
+
+    } // anonymous namespace
+
+    CrossMarketIndicators::CrossMarketIndicators(std::size_t markets, std::size_t rsi_length,
+        std::size_t close_lookback, std::size_t volatility_window)
+        : markets_(markets)
+        , padded_((markets + kLanes - 1) / kLanes * kLanes)
+        , rsi_length_(rsi_length)
+        , close_lookback_(close_lookback)
+        , vol_window_(volatility_window)
+    {
+        if (rsi_length_ == 0)
+            throw std::invalid_argument("[CrossMarketIndicators] rsi_length must be positive");
+        if (vol_window_ < 2)
+            throw std::invalid_argument("[CrossMarketIndicators] volatility_window must be >= 2");
+
+        // 이력에서 읽는 가장 먼 봉: close[N], 윈도우에서 빠지는 수익률 r[V]
+        const std::size_t lookback = std::max(close_lookback_ + 1, vol_window_ + 1);
+        const std::size_t cap = std::bit_ceil(lookback);
+        hist_shift_ = static_cast<std::size_t>(std::countr_zero(cap));
+        hist_mask_ = cap - 1;
+
+        staged_.reserve(markets_);
+
+        for (auto* v : { &in_close_, &in_ret_, &active_, &prev_close_,
+                         &rsi_seed_, &avg_gain_, &avg_loss_, &rsi_, &rsi_ready_,
+                         &vol_count_, &vol_sum_, &vol_sumsq_, &vol_, &vol_ready_,
+                         &close_n_, &close_n_ready_, &trend_, &trend_ready_ })
+            v->assign(padded_, 0.0);
+
+        bars_.assign(padded_, 0);
+        hist_.assign(padded_ << hist_shift_, 0.0);
+        ret_hist_.assign(padded_ << hist_shift_, 0.0);
+    }
+
+    void CrossMarketIndicators::reset(std::size_t market) noexcept {
+        if (market >= markets_) return;
+
+        for (auto* v : { &prev_close_,
+                         &rsi_seed_, &avg_gain_, &avg_loss_, &rsi_, &rsi_ready_,
+                         &vol_count_, &vol_sum_, &vol_sumsq_, &vol_, &vol_ready_,
+                         &close_n_, &close_n_ready_, &trend_, &trend_ready_ })
+            zeroAt(*v, market);
+
+        bars_[market] = 0;
+        const auto row_begin = static_cast<std::ptrdiff_t>(market << hist_shift_);
+        std::fill_n(hist_.begin() + row_begin, hist_mask_ + 1, 0.0);
+        std::fill_n(ret_hist_.begin() + row_begin, hist_mask_ + 1, 0.0);
+    }
+
+    void CrossMarketIndicators::evaluateStaged_() noexcept {
+        if (staged_.empty()) return;
+
+        // 새 종가/수익률을 먼저 이력에 기록 → 갱신 패스에서 k봉 전은 새 봉 기준 (k = 0이 새 봉)
+        // 수익률은 여기서 한 번만 계산 (IndicatorSet과 같은 식, 첫 봉이면 0)
+        for (const std::uint32_t m : staged_) {
+            const double x = in_close_[m];
+            const double prev = prev_close_[m];
+            const double ret = (bars_[m] > 0 && prev != 0.0) ? (x - prev) / prev : 0.0;
+            const std::size_t slot = (static_cast<std::size_t>(m) << hist_shift_) + (static_cast<std::size_t>(bars_[m]) & hist_mask_);
+            hist_[slot] = x;
+            ret_hist_[slot] = ret;
+            in_ret_[m] = ret;
+        }
+
+        // 갱신 패스가 active_도 함께 해제
+        evaluateAvx2_(0, padded_);
+    }
+
+    void CrossMarketIndicators::evaluateAvx2_(std::size_t begin, std::size_t end) noexcept {
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d half = _mm256_set1_pd(0.5);
+        const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d len = _mm256_set1_pd(static_cast<double>(rsi_length_));
+        const __m256d len_m1 = _mm256_set1_pd(static_cast<double>(rsi_length_) - 1.0);
+        const __m256d win = _mm256_set1_pd(static_cast<double>(vol_window_));
+        const __m256d c100 = _mm256_set1_pd(100.0);
+        const __m256d c50 = _mm256_set1_pd(50.0);
+
+        const __m256i zero_i = _mm256_setzero_si256();
+        const __m256i hist_mask = _mm256_set1_epi64x(static_cast<long long>(hist_mask_));
+        const __m256i k_vol = _mm256_set1_epi64x(static_cast<long long>(vol_window_));
+        const __m256i k_close = _mm256_set1_epi64x(static_cast<long long>(close_lookback_));
+        const __m256i k_close_m1 = _mm256_set1_epi64x(static_cast<long long>(close_lookback_) - 1);
+        const __m128i shift = _mm_cvtsi64_si128(static_cast<long long>(hist_shift_));
+        const double* hist = hist_.data();
+        const double* ret_hist = ret_hist_.data();
+
+        const auto blend = [](__m256d a, __m256d b, __m256d m) noexcept { return _mm256_blendv_pd(a, b, m); };
+        const auto histIndex = [&](__m256i base, __m256i n, __m256i k) noexcept {
+            return _mm256_add_epi64(base, _mm256_and_si256(_mm256_sub_epi64(n, k), hist_mask));
+        };
+
+        for (std::size_t i = begin; i < end; i += kLanes) {
+            const __m256d act = _mm256_cmp_pd(_mm256_loadu_pd(&active_[i]), half, _CMP_GT_OQ);
+            if (_mm256_movemask_pd(act) == 0) continue;
+            _mm256_storeu_pd(&active_[i], zero);
+
+            const __m256d x = _mm256_loadu_pd(&in_close_[i]);
+            const __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&bars_[i]));
+            const __m256i lane = _mm256_setr_epi64x(static_cast<long long>(i), static_cast<long long>(i + 1),
+                static_cast<long long>(i + 2), static_cast<long long>(i + 3));
+            const __m256i base = _mm256_sll_epi64(lane, shift);
+
+            const __m256d upd = _mm256_and_pd(act, _mm256_castsi256_pd(_mm256_cmpgt_epi64(n, zero_i)));
+
+            // 공용 입력
+            const __m256d prev = _mm256_loadu_pd(&prev_close_[i]);
+            const __m256d delta = _mm256_sub_pd(x, prev);
+            const __m256d ret = _mm256_loadu_pd(&in_ret_[i]);
+
+            // Wilder RSI
+            {
+                const __m256d gain = blend(zero, delta, _mm256_cmp_pd(delta, zero, _CMP_GT_OQ));
+                const __m256d loss = blend(zero, _mm256_xor_pd(delta, sign), _mm256_cmp_pd(delta, zero, _CMP_LT_OQ));
+
+                const __m256d seed = _mm256_loadu_pd(&rsi_seed_[i]);
+                const __m256d g = _mm256_loadu_pd(&avg_gain_[i]);
+                const __m256d l = _mm256_loadu_pd(&avg_loss_[i]);
+
+                const __m256d seeding = _mm256_cmp_pd(seed, len, _CMP_LT_OQ);
+                const __m256d seed1 = _mm256_add_pd(seed, one);
+                __m256d reach = zero;
+
+                __m256d g_new = _mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(g, len_m1), gain), len);
+                __m256d l_new = _mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(l, len_m1), loss), len);
+
+                // seed 구간 레인이 있을 때만 (대부분의 배치는 전 레인 smoothing)
+                if (_mm256_movemask_pd(seeding) != 0) {
+                    reach = _mm256_and_pd(seeding, _mm256_cmp_pd(seed1, len, _CMP_EQ_OQ));
+                    const __m256d g_sum = _mm256_add_pd(g, gain);
+                    const __m256d l_sum = _mm256_add_pd(l, loss);
+                    g_new = blend(g_new, blend(g_sum, _mm256_div_pd(g_sum, len), reach), seeding);
+                    l_new = blend(l_new, blend(l_sum, _mm256_div_pd(l_sum, len), reach), seeding);
+                }
+
+                // Rsi 커널 경계값 처리: 일반식 → 우선순위 낮은 경계부터 덮어씀
+                const __m256d g_zero = _mm256_cmp_pd(g_new, zero, _CMP_EQ_OQ);
+                const __m256d l_zero = _mm256_cmp_pd(l_new, zero, _CMP_EQ_OQ);
+                __m256d r = _mm256_sub_pd(c100, _mm256_div_pd(c100, _mm256_add_pd(one, _mm256_div_pd(g_new, l_new))));
+                r = blend(r, zero, g_zero);
+                r = blend(r, c100, l_zero);
+                r = blend(r, c50, _mm256_and_pd(g_zero, l_zero));
+
+                const __m256d r_upd = _mm256_and_pd(upd, _mm256_or_pd(_mm256_andnot_pd(seeding, all), reach));
+
+                _mm256_storeu_pd(&rsi_seed_[i], blend(seed, blend(seed, seed1, seeding), upd));
+                _mm256_storeu_pd(&avg_gain_[i], blend(g, g_new, upd));
+                _mm256_storeu_pd(&avg_loss_[i], blend(l, l_new, upd));
+                _mm256_storeu_pd(&rsi_[i], blend(_mm256_loadu_pd(&rsi_[i]), r, r_upd));
+                _mm256_storeu_pd(&rsi_ready_[i], blend(_mm256_loadu_pd(&rsi_ready_[i]), one, r_upd));
+            }
+
+            // 수익률 표준편차
+            {
+                const __m256d cnt = _mm256_loadu_pd(&vol_count_[i]);
+                const __m256d sum = _mm256_loadu_pd(&vol_sum_[i]);
+                const __m256d sumsq = _mm256_loadu_pd(&vol_sumsq_[i]);
+                const __m256d full = _mm256_cmp_pd(cnt, win, _CMP_EQ_OQ);
+
+                const __m256d old = _mm256_i64gather_pd(ret_hist, histIndex(base, n, k_vol), 8);
+
+                const __m256d s1 = blend(sum, _mm256_sub_pd(sum, old), full);
+                const __m256d q1 = blend(sumsq, _mm256_sub_pd(sumsq, _mm256_mul_pd(old, old)), full);
+                const __m256d cnt1 = blend(_mm256_add_pd(cnt, one), cnt, full);
+                const __m256d s2 = _mm256_add_pd(s1, ret);
+                const __m256d q2 = _mm256_add_pd(q1, _mm256_mul_pd(ret, ret));
+
+                __m256d v = zero;
+                if (vol_window_ > 2) {
+                    const __m256d mean = _mm256_div_pd(s2, win);
+                    const __m256d var = _mm256_sub_pd(_mm256_div_pd(q2, win), _mm256_mul_pd(mean, mean));
+                    v = blend(zero, _mm256_sqrt_pd(var), _mm256_cmp_pd(var, zero, _CMP_GT_OQ));
+                }
+                const __m256d v_upd = _mm256_and_pd(upd, _mm256_cmp_pd(cnt1, win, _CMP_EQ_OQ));
+
+                _mm256_storeu_pd(&vol_count_[i], blend(cnt, cnt1, upd));
+                _mm256_storeu_pd(&vol_sum_[i], blend(sum, s2, upd));
+                _mm256_storeu_pd(&vol_sumsq_[i], blend(sumsq, q2, upd));
+                _mm256_storeu_pd(&vol_[i], blend(_mm256_loadu_pd(&vol_[i]), v, v_upd));
+                _mm256_storeu_pd(&vol_ready_[i], blend(_mm256_loadu_pd(&vol_ready_[i]), one, v_upd));
+            }
+
+            // close[N] + trendStrength
+            {
+                const __m256d cn_upd = _mm256_and_pd(act, _mm256_castsi256_pd(_mm256_cmpgt_epi64(n, k_close_m1)));
+                const __m256d cn_gather = _mm256_i64gather_pd(hist, histIndex(base, n, k_close), 8);
+                const __m256d cn = blend(_mm256_loadu_pd(&close_n_[i]), cn_gather, cn_upd);
+                const __m256d cn_ready = blend(_mm256_loadu_pd(&close_n_ready_[i]), one, cn_upd);
+                _mm256_storeu_pd(&close_n_[i], cn);
+                _mm256_storeu_pd(&close_n_ready_[i], cn_ready);
+
+                const __m256d t_ok = _mm256_and_pd(_mm256_cmp_pd(cn_ready, half, _CMP_GT_OQ),
+                    _mm256_cmp_pd(cn, zero, _CMP_NEQ_UQ));
+                const __m256d t = _mm256_div_pd(_mm256_andnot_pd(sign, _mm256_sub_pd(x, cn)), cn);
+                _mm256_storeu_pd(&trend_[i], blend(_mm256_loadu_pd(&trend_[i]), blend(zero, t, t_ok), act));
+                _mm256_storeu_pd(&trend_ready_[i], blend(_mm256_loadu_pd(&trend_ready_[i]), _mm256_and_pd(t_ok, one), act));
+            }
+
+            _mm256_storeu_pd(&prev_close_[i], blend(prev, x, act));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&bars_[i]), _mm256_sub_epi64(n, _mm256_castpd_si256(act)));
+        }
+    }
+
+} // namespace trading::indicators
@@ -0,0 +1,142 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "IndicatorTypes.h"     // trading::Value<T>
+
+namespace trading::indicators
+{
+	/*
+		CrossMarketIndicators - 여러 마켓의 전략 지표 상태를 마켓 축 SoA로 보관하고 한 번에 갱신
+
+		용도
+		- 같은 시각에 여러 마켓의 봉이 확정되는 배치 소비자(스캐너/리플레이/백테스트 등)
+		- 라이브 워커는 마켓별 스레드에서 IndicatorSet을 그대로 사용 (스레드 간 배리어를 두지 않음)
+
+		지표 (RsiMeanReversionStrategy의 IndicatorSet과 계산식/준비 조건 동일)
+		- Wilder RSI(rsi_length), close[close_lookback], 수익률 표준편차(volatility_window)
+		- trendStrength = |close - close[N]| / close[N]
+
+		사용
+		1) stage(market, close): 이번 배치에 확정된 봉 기록 (같은 배치에 같은 마켓 재호출 시 마지막 값)
+		2) evaluate(dispatch): 모든 마켓을 4개 단위로 1패스 갱신 (stage 안 된 마켓은 마스크로 상태 유지)
+		   → stage된 마켓마다 dispatch(market, row) 호출 (stage 순서)
+
+		구현
+		- 상태는 지표 항목별 배열 (배열 인덱스 = 마켓), 종가/수익률 이력은 마켓별 2의 거듭제곱 링 [마켓][용량]
+		- stage된 마켓만 도는 전처리에서 이력 기록 + 수익률 계산, 갱신 패스는 전 마켓 연속 배열만 순회
+		- AVX2 4레인 (close[N]은 gather), FMA 없이 IndicatorSet과 같은 연산 순서
+		- COINBOT_ENABLE_AVX2 빌드에서만 제공: 스칼라로는 마켓별 IndicatorSet 순회보다 느려 대체 경로를 두지 않음
+
+		스레드: 단일 스레드 전용
+	*/
+	class CrossMarketIndicators final
+	{
+	public:
+		static constexpr std::size_t kLanes = 4;
+
+		// 마켓 1개의 최신 지표
+		struct Row final
+		{
+			double close{ 0.0 };
+			trading::Value<double> rsi{};
+			trading::Value<double> closeN{};
+			trading::Value<double> volatility{};
+			trading::Value<double> trendStrength{};
+		};
+
+		// @throws std::invalid_argument rsi_length == 0, volatility_window < 2
+		CrossMarketIndicators(std::size_t markets, std::size_t rsi_length,
+			std::size_t close_lookback, std::size_t volatility_window);
+
+		[[nodiscard]] std::size_t markets() const noexcept { return markets_; }
+
+		void stage(std::size_t market, double close) noexcept
+		{
+			if (market >= markets_) return;
+
+			if (active_[market] == 0.0)
+			{
+				active_[market] = 1.0;
+				staged_.push_back(static_cast<std::uint32_t>(market));
+			}
+			in_close_[market] = close;
+		}
+
+		template <typename Dispatch>
+		std::size_t evaluate(Dispatch&& dispatch)
+		{
+			evaluateStaged_();
+			for (const std::uint32_t m : staged_)
+				dispatch(static_cast<std::size_t>(m), row(m));
+
+			const std::size_t n = staged_.size();
+			staged_.clear();
+			return n;
+		}
+
+		[[nodiscard]] Row row(std::size_t market) const noexcept
+		{
+			Row r{};
+			if (market >= markets_) return r;
+
+			r.close = prev_close_[market];
+			r.rsi = { rsi_ready_[market] != 0.0, rsi_[market] };
+			r.closeN = { close_n_ready_[market] != 0.0, close_n_[market] };
+			r.volatility = { vol_ready_[market] != 0.0, vol_[market] };
+			r.trendStrength = { trend_ready_[market] != 0.0, trend_[market] };
+			return r;
+		}
+
+		// 마켓 1개의 지표/이력 초기화 (마켓 교체 시)
+		void reset(std::size_t market) noexcept;
+
+	private:
+		void evaluateStaged_() noexcept;
+		void evaluateAvx2_(std::size_t begin, std::size_t end) noexcept;
+
+		std::size_t markets_{ 0 };
+		std::size_t padded_{ 0 };				// kLanes 배수
+		std::size_t rsi_length_{ 0 };
+		std::size_t close_lookback_{ 0 };
+		std::size_t vol_window_{ 0 };
+		std::size_t hist_shift_{ 0 };			// 이력 링 용량 = 1 << hist_shift_
+		std::size_t hist_mask_{ 0 };
+
+		std::vector<std::uint32_t> staged_;
+
+		// 배치 입력 (active_: 1.0 = 이번 배치에 봉 확정, in_ret_: 배치 전처리에서 계산한 수익률)
+		std::vector<double> in_close_;
+		std::vector<double> in_ret_;
+		std::vector<double> active_;
+
+		// 마켓별 이력
+		std::vector<std::int64_t> bars_;		// 지금까지 받은 봉 수
+		std::vector<double> prev_close_;
+		std::vector<double> hist_;				// [마켓][링 용량] 종가
+		std::vector<double> ret_hist_;			// [마켓][링 용량] 수익률 (윈도우에서 빠지는 값 조회)
+
+		// Wilder RSI (seed 중에는 avg = 누적합)
+		std::vector<double> rsi_seed_;
+		std::vector<double> avg_gain_;
+		std::vector<double> avg_loss_;
+		std::vector<double> rsi_;
+		std::vector<double> rsi_ready_;
+
+		// 수익률 누적합
+		std::vector<double> vol_count_;
+		std::vector<double> vol_sum_;
+		std::vector<double> vol_sumsq_;
+		std::vector<double> vol_;
+		std::vector<double> vol_ready_;
+
+		// close[N], trendStrength
+		std::vector<double> close_n_;
+		std::vector<double> close_n_ready_;
+		std::vector<double> trend_;
+		std::vector<double> trend_ready_;
+	};
+
+} // namespace trading::indicators
@@ -0,0 +1,377 @@
+﻿#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "IndicatorTypes.h"     // trading::Value<T>
+#include "marketdata/PriceSeries.h"
+
+namespace trading::indicators
+{
+	/*
+		IndicatorSet용 지표 커널 (윈도우 = 컴파일 타임 상수)
+
+		- 모든 커널은 update(const BarInput&) 하나만 가진다.
+		  직전 종가/변화량/수익률 같은 공용 입력은 IndicatorSet이 봉마다 한 번만 계산해 넘긴다.
+		- 커널은 시계열 버퍼를 따로 두지 않는 뷰: 윈도우에서 빠지는 값/close[N]은
+		  마켓 컨텍스트의 marketdata::PriceSeries에서 O(1)로 읽고, 자신은 누적합 등 스칼라만 보관
+		- kLookback = 커널이 읽는 가장 먼 봉 + 1 (PriceSeries 용량은 이 이상이어야 함)
+		- 계산식/준비 조건은 기존 런타임 지표와 동일
+		  Rsi = RsiWilder, CloseN = ClosePriceWindow, ReturnStdev = ChangeVolatilityIndicator
+	*/
+
+	// 봉 1개의 공용 입력 (IndicatorSet이 채움, series의 최신 봉 = 이번 봉)
+	struct BarInput final
+	{
+		const marketdata::PriceSeries* series{ nullptr };
+
+		double open{ 0.0 };
+		double high{ 0.0 };
+		double low{ 0.0 };
+		double close{ 0.0 };
+		double volume{ 0.0 };
+
+		bool has_prev{ false };		// 직전 종가 존재 (첫 봉이면 false)
+		double prev_close{ 0.0 };
+		double delta{ 0.0 };		// close - prev_close
+		double ret{ 0.0 };			// (close - prev_close) / prev_close, prev_close가 0이면 0
+	};
+
+	// Wilder RSI (seed: 처음 N개 변화량 단순 평균 → 이후 Wilder smoothing)
+	template <std::size_t N>
+	class Rsi final
+	{
+		static_assert(N > 0, "Rsi: N must be positive");
+
+	public:
+		static constexpr std::size_t kLength = N;
+		static constexpr std::size_t kLookback = 2;
+
+		void update(const BarInput& in) noexcept
+		{
+			if (!in.has_prev) return;
+
+			const double gain = in.delta > 0.0 ? in.delta : 0.0;
+			const double loss = in.delta < 0.0 ? -in.delta : 0.0;
+			constexpr double n = static_cast<double>(N);
+
+			if (seed_count_ < N)
+			{
+				avg_gain_ += gain;
+				avg_loss_ += loss;
+				if (++seed_count_ < N) return;
+				avg_gain_ /= n;
+				avg_loss_ /= n;
+			}
+			else
+			{
+				avg_gain_ = (avg_gain_ * (n - 1.0) + gain) / n;
+				avg_loss_ = (avg_loss_ * (n - 1.0) + loss) / n;
+			}
+
+			last_.ready = true;
+			last_.v = computeRsi(avg_gain_, avg_loss_);
+		}
+
+		[[nodiscard]] trading::Value<double> value() const noexcept { return last_; }
+
+		void clear() noexcept { *this = Rsi{}; }
+
+	private:
+		[[nodiscard]] static double computeRsi(double avg_gain, double avg_loss) noexcept
+		{
+			if (avg_gain == 0.0 && avg_loss == 0.0) return 50.0;
+			if (avg_loss == 0.0) return 100.0;
+			if (avg_gain == 0.0) return 0.0;
+			return 100.0 - (100.0 / (1.0 + avg_gain / avg_loss));
+		}
+
+		std::size_t seed_count_{ 0 };
+		double avg_gain_{ 0.0 };		// seed 중에는 누적합
+		double avg_loss_{ 0.0 };
+		trading::Value<double> last_{};
+	};
+
+	// EMA (alpha = 2 / (N + 1), seed: 처음 N개 종가 단순 평균)
+	template <std::size_t N>
+	class Ema final
+	{
+		static_assert(N > 0, "Ema: N must be positive");
+
+	public:
+		static constexpr std::size_t kLength = N;
+		static constexpr std::size_t kLookback = 1;
+
+		void update(const BarInput& in) noexcept
+		{
+			constexpr double alpha = 2.0 / (static_cast<double>(N) + 1.0);
+
+			if (count_ < N)
+			{
+				ema_ += in.close;
+				if (++count_ < N) return;
+				ema_ /= static_cast<double>(N);
+			}
+			else
+			{
+				ema_ += alpha * (in.close - ema_);
+			}
+			last_.ready = true;
+			last_.v = ema_;
+		}
+
+		[[nodiscard]] trading::Value<double> value() const noexcept { return last_; }
+
+		void clear() noexcept { *this = Ema{}; }
+
+	private:
+		std::size_t count_{ 0 };
+		double ema_{ 0.0 };				// seed 중에는 누적합
+		trading::Value<double> last_{};
+	};
+
+	// 볼린저 밴드 (중심 = N봉 종가 SMA, 폭 = K × 모집단 표준편차)
+	// K는 정수 분수(KNum / KDen): Bollinger<20, 2> = 2σ, Bollinger<20, 5, 2> = 2.5σ
+	struct BollingerValue final
+	{
+		bool ready{ false };
+		double mid{ 0.0 };
+		double upper{ 0.0 };
+		double lower{ 0.0 };
+	};
+
+	template <std::size_t N, std::size_t KNum = 2, std::size_t KDen = 1>
+	class Bollinger final
+	{
+		static_assert(N > 1, "Bollinger: N must be > 1");
+		static_assert(KDen > 0, "Bollinger: KDen must be positive");
+
+		static constexpr double K = static_cast<double>(KNum) / static_cast<double>(KDen);
+
+	public:
+		static constexpr std::size_t kLength = N;
+		static constexpr std::size_t kLookback = N + 1;
+
+		void update(const BarInput& in) noexcept
+		{
+			// 윈도우 = close[0..N-1], 빠지는 값 = close[N]
+			if (count_ == N)
+			{
+				const double old = in.series->close(N);
+				sum_ -= old;
+				sumsq_ -= old * old;
+			}
+			else
+			{
+				++count_;
+			}
+			sum_ += in.close;
+			sumsq_ += in.close * in.close;
+		}
+
+		[[nodiscard]] BollingerValue value() const noexcept
+		{
+			BollingerValue out{};
+			if (count_ < N) return out;
+
+			constexpr double n = static_cast<double>(N);
+			const double mean = sum_ / n;
+			double var = sumsq_ / n - mean * mean;
+			if (var < 0.0) var = 0.0;
+			const double band = K * std::sqrt(var);
+
+			out.ready = true;
+			out.mid = mean;
+			out.upper = mean + band;
+			out.lower = mean - band;
+			return out;
+		}
+
+		void clear() noexcept { *this = Bollinger{}; }
+
+	private:
+		std::size_t count_{ 0 };		// 윈도우에 든 봉 수 (N에서 멈춤)
+		double sum_{ 0.0 };
+		double sumsq_{ 0.0 };
+	};
+
+	// ATR (True Range의 Wilder 평균, 첫 봉 TR = high - low)
+	template <std::size_t N>
+	class Atr final
+	{
+		static_assert(N > 0, "Atr: N must be positive");
+
+	public:
+		static constexpr std::size_t kLength = N;
+		static constexpr std::size_t kLookback = 2;
+
+		void update(const BarInput& in) noexcept
+		{
+			double tr = in.high - in.low;
+			if (in.has_prev)
+			{
+				tr = std::fmax(tr, std::fabs(in.high - in.prev_close));
+				tr = std::fmax(tr, std::fabs(in.low - in.prev_close));
+			}
+
+			constexpr double n = static_cast<double>(N);
+			if (count_ < N)
+			{
+				atr_ += tr;
+				if (++count_ < N) return;
+				atr_ /= n;
+			}
+			else
+			{
+				atr_ = (atr_ * (n - 1.0) + tr) / n;
+			}
+			last_.ready = true;
+			last_.v = atr_;
+		}
+
+		[[nodiscard]] trading::Value<double> value() const noexcept { return last_; }
+
+		void clear() noexcept { *this = Atr{}; }
+
+	private:
+		std::size_t count_{ 0 };
+		double atr_{ 0.0 };				// seed 중에는 누적합
+		trading::Value<double> last_{};
+	};
+
+	// close[N] (N봉 전 종가, N+1개 종가가 쌓여야 ready)
+	template <std::size_t N>
+	class CloseN final
+	{
+	public:
+		static constexpr std::size_t kLength = N;
+		static constexpr std::size_t kLookback = N + 1;
+
+		void update(const BarInput& in) noexcept
+		{
+			if (count_ < N)
+			{
+				++count_;
+				return;
+			}
+			last_.ready = true;
+			last_.v = in.series->close(N);
+		}
+
+		[[nodiscard]] trading::Value<double> value() const noexcept { return last_; }
+
+		void clear() noexcept { *this = CloseN{}; }
+
+	private:
+		std::size_t count_{ 0 };		// 이번 봉 이전까지 받은 봉 수 (N에서 멈춤)
+		trading::Value<double> last_{};
+	};
+
+	// 돈치안 채널 (이번 봉을 뺀 직전 N봉의 최고가/최저가, 돌파 판정용)
+	struct DonchianValue final
+	{
+		bool ready{ false };
+		double upper{ 0.0 };
+		double lower{ 0.0 };
+	};
+
+	// - 상태 없이 series의 high/low[1..N]을 매 봉 스캔 (N이 작아 단조 덱보다 싸고, 덮어쓴 봉 문제 없음)
+	// - 비교는 삼항 연산 (std::fmax는 NaN 규칙 때문에 libm 호출로 남아 N번 호출 비용이 큼)
+	template <std::size_t N>
+	class Donchian final
+	{
+		static_assert(N > 0, "Donchian: N must be positive");
+
+	public:
+		static constexpr std::size_t kLength = N;
+		static constexpr std::size_t kLookback = N + 1;
+
+		void update(const BarInput& in) noexcept
+		{
+			if (count_ < N)
+			{
+				++count_;
+				return;
+			}
+
+			double hi = in.series->high(1);
+			double lo = in.series->low(1);
+			for (std::size_t k = 2; k <= N; ++k)
+			{
+				const double h = in.series->high(k);
+				const double l = in.series->low(k);
+				hi = h > hi ? h : hi;
+				lo = l < lo ? l : lo;
+			}
+			last_.ready = true;
+			last_.upper = hi;
+			last_.lower = lo;
+		}
+
+		[[nodiscard]] DonchianValue value() const noexcept { return last_; }
+
+		void clear() noexcept { *this = Donchian{}; }
+
+	private:
+		std::size_t count_{ 0 };		// 이번 봉 이전까지 받은 봉 수 (N에서 멈춤)
+		DonchianValue last_{};
+	};
+
+	// 최근 N개 수익률의 모집단 표준편차
+	// - 수익률 r[k] = (close[k] - close[k+1]) / close[k+1], 빠지는 값 r[N]도 시계열에서 다시 계산
+	//   (더할 때와 같은 연산 → 누적합에서 정확히 같은 값이 빠짐)
+	// - 직전 종가가 0인 봉의 수익률은 0으로 취급 (버퍼가 없어 봉을 건너뛸 수 없음, 실가격에선 발생 안 함)
+	template <std::size_t N>
+	class ReturnStdev final
+	{
+		static_assert(N >= 2, "ReturnStdev: N must be >= 2");
+
+	public:
+		static constexpr std::size_t kLength = N;
+		static constexpr std::size_t kLookback = N + 2;
+
+		void update(const BarInput& in) noexcept
+		{
+			if (!in.has_prev) return;
+
+			if (count_ == N)
+			{
+				const double prev = in.series->close(N + 1);
+				const double old = prev != 0.0 ? (in.series->close(N) - prev) / prev : 0.0;
+				sum_ -= old;
+				sumsq_ -= old * old;
+			}
+			else
+			{
+				++count_;
+			}
+			sum_ += in.ret;
+			sumsq_ += in.ret * in.ret;
+		}
+
+		[[nodiscard]] trading::Value<double> value() const noexcept
+		{
+			trading::Value<double> out{};
+			if (count_ < N) return out;
+
+			out.ready = true;
+			// ChangeVolatilityIndicator와 동일: 윈도우 2 이하는 0
+			if constexpr (N > 2)
+			{
+				constexpr double n = static_cast<double>(N);
+				const double mean = sum_ / n;
+				const double var = sumsq_ / n - mean * mean;
+				out.v = var > 0.0 ? std::sqrt(var) : 0.0;
+			}
+			return out;
+		}
+
+		void clear() noexcept { *this = ReturnStdev{}; }
+
+	private:
+		std::size_t count_{ 0 };		// 윈도우에 든 수익률 수 (N에서 멈춤)
+		double sum_{ 0.0 };
+		double sumsq_{ 0.0 };
+	};
+
+} // namespace trading::indicators
@@ -0,0 +1,83 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "FusedIndicators.h"
+#include "marketdata/PriceSeries.h"
+
+namespace trading::indicators
+{
+	/*
+		IndicatorSet - 컴파일 타임에 구성이 정해지는 지표 묶음
+
+		예) IndicatorSet<Rsi<14>, Ema<20>, Bollinger<20, 2>, Atr<14>, CloseN<30>, ReturnStdev<20>>
+
+		- 봉 데이터는 마켓 컨텍스트의 PriceSeries 하나에만 있다. 소유자가 확정 봉을 push한 직후
+		  update(series)를 1번 호출 → 공용 입력(직전 종가, 변화량, 수익률)을 한 번만 계산한 뒤
+		  fold expression으로 모든 커널을 순서대로 갱신 → 가상 호출/분기 테이블 없이 전부 인라인
+		- 각 지표는 누적합 같은 스칼라 상태만 보관, 과거 값은 series에서 O(1) 조회
+		- series 용량은 kLookback 이상이어야 함 (모자라면 덮어쓴 봉을 읽게 됨)
+		- 조회: get<Rsi<14>>().value() 또는 get<0>().value()
+		- 같은 타입을 두 번 넣으면 타입 조회가 모호해지므로 금지
+	*/
+	template <typename... Indicators>
+	class IndicatorSet final
+	{
+		static_assert(sizeof...(Indicators) > 0, "IndicatorSet: at least one indicator required");
+
+		template <typename T, typename... Ts>
+		static constexpr std::size_t countOf() noexcept { return (std::size_t{ std::is_same_v<T, Ts> } + ... + 0); }
+
+		static_assert(((countOf<Indicators, Indicators...>() == 1) && ...),
+			"IndicatorSet: duplicate indicator type");
+
+	public:
+		static constexpr std::size_t kSize = sizeof...(Indicators);
+
+		static constexpr std::size_t kLookback = std::max({ Indicators::kLookback... });
+
+		// series의 최신 봉(= 방금 push한 봉) 1개 반영, 같은 봉으로 두 번 호출 금지
+		void update(const marketdata::PriceSeries& series) noexcept
+		{
+			assert(series.capacity() >= kLookback && !series.empty());
+
+			BarInput in{};
+			in.series = &series;
+			in.open = series.open(0);
+			in.high = series.high(0);
+			in.low = series.low(0);
+			in.close = series.close(0);
+			in.volume = series.volume(0);
+
+			if (series.size() >= 2)
+			{
+				in.has_prev = true;
+				in.prev_close = series.close(1);
+				in.delta = in.close - in.prev_close;
+				if (in.prev_close != 0.0)
+					in.ret = in.delta / in.prev_close;
+			}
+
+			std::apply([&in](Indicators&... ind) noexcept { (ind.update(in), ...); }, indicators_);
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] const auto& get() const noexcept { return std::get<I>(indicators_); }
+
+		template <typename T>
+		[[nodiscard]] const T& get() const noexcept { return std::get<T>(indicators_); }
+
+		void clear() noexcept
+		{
+			std::apply([](Indicators&... ind) noexcept { (ind.clear(), ...); }, indicators_);
+		}
+
+	private:
+		std::tuple<Indicators...> indicators_{};
+	};
+
+} // namespace trading::indicators
@@ -0,0 +1,103 @@
+﻿#include "BreakoutStrategy.h"
+
+#include <stdexcept> // std::invalid_argument
+#include <utility>   // std::move
+
+#include "util/Config.h"
+#include "util/Logger.h"
+
+namespace trading::strategies {
+
+    BreakoutStrategy::BreakoutStrategy(std::string market, Params p,
+                                       const marketdata::PriceSeries& series)
+        : params_(p),
+          position_(kId, std::move(market), p.stopLossPct, p.profitTargetPct),
+          series_(series)
+    {
+        if (series_.capacity() < kSeriesLookback)
+            throw std::invalid_argument("[Breakout] PriceSeries capacity too small for indicators");
+
+        reset();
+    }
+
+    void BreakoutStrategy::reset()
+    {
+        position_.reset();
+        indicators_.clear();
+    }
+
+    void BreakoutStrategy::onWarmUpCandle(const core::Candle& c)
+    {
+        (void)buildSnapshot(c);
+    }
+
+    Snapshot BreakoutStrategy::buildSnapshot(const core::Candle& c)
+    {
+        indicators_.update(series_);
+
+        Snapshot s{};
+        s.close = static_cast<double>(c.close_price);
+        s.volatility = indicators_.get<Volatility>().value();
+
+        // 돌파 전략은 RSI/close[N]을 쓰지 않음 → rsi/trendReady 미준비 (DB NULL)
+        const auto channel = indicators_.get<EntryChannel>().value();
+        const bool volOk = s.volatility.ready && s.volatility.v >= params_.minVolatility;
+        s.marketOk = channel.ready && volOk;
+        return s;
+    }
+
+    Decision BreakoutStrategy::onCandle(const core::Candle& c, const AccountSnapshot& account)
+    {
+        const Snapshot s = buildSnapshot(c);
+
+        position_.reconcile(account, s.close);
+
+        const auto& strategy_cfg = util::AppConfig::instance().strategy;
+
+        if (position_.state() == State::Flat)
+        {
+            if (!account.canBuy() || !s.marketOk)
+                return Decision::noAction();
+
+            if (!(s.close > indicators_.get<EntryChannel>().value().upper))
+                return Decision::noAction();
+
+            const double krw_to_use = account.krw_available
+                / util::AppConfig::instance().engine.reserve_margin * params_.utilization;
+            if (krw_to_use < strategy_cfg.min_notional_krw || krw_to_use <= 0.0)
+                return Decision::noAction();
+
+            COINBOT_LOG_DEBUG("[Breakout][Entry]", util::kv("market", market()),
+                util::kv("close", s.close),
+                util::kv("upper", indicators_.get<EntryChannel>().value().upper));
+
+            return position_.submitEntry(krw_to_use, "entry_channel_breakout", s);
+        }
+
+        if (position_.state() != State::InPosition || !account.canSell())
+            return Decision::noAction();
+
+        // 청산: 하단 채널 이탈 > 손절 > 익절 순으로 사유 기록 (같은 봉에 겹치면 이어 붙임)
+        const auto exit_channel = indicators_.get<ExitChannel>().value();
+        const bool channelExit = exit_channel.ready && s.close < exit_channel.lower;
+        const auto& stop = position_.stopPrice();
+        const auto& target = position_.targetPrice();
+        const bool hitStop = stop.has_value() && s.close <= *stop;
+        const bool hitTarget = target.has_value() && s.close >= *target;
+
+        if (!(channelExit || hitStop || hitTarget))
+            return Decision::noAction();
+
+        std::string reason_tag;
+        if (channelExit) reason_tag = "exit_channel";
+        if (hitStop)     reason_tag = reason_tag.empty() ? "exit_stop" : reason_tag + "_stop";
+        if (hitTarget)   reason_tag = reason_tag.empty() ? "exit_target" : reason_tag + "_target";
+
+        const double sellVol = account.coin_available;
+        if (sellVol * s.close < strategy_cfg.min_notional_krw)
+            return Decision::noAction();
+
+        return position_.submitExit(sellVol, reason_tag, s);
+    }
+
+} // namespace trading::strategies
@@ -0,0 +1,95 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "core/domain/Candle.h"
+#include "PositionTracker.h"
+#include "StrategyTypes.h"
+
+#include "marketdata/PriceSeries.h"
+#include "trading/indicators/IndicatorSet.h"
+
+
+namespace trading::strategies {
+
+    /*
+        Channel Breakout (돈치안 채널 돌파 추세 추종)
+        - 진입: 종가 > 직전 entryChannel봉 최고가, 수익률 변동성 >= minVolatility
+        - 청산: 종가 < 직전 exitChannel봉 최저가, 또는 손절/익절가 도달 (intrabar 포함)
+        - RSI 평균회귀와 같은 마켓에서 StrategySet으로 함께 돌고, 같은 PriceSeries를 조회
+        - 주문/포지션 상태 머신은 PositionTracker (RsiMeanReversionStrategy와 공통)
+    */
+    class BreakoutStrategy final {
+    public:
+        struct Params final {
+            // 지표 윈도우는 컴파일 타임 상수 (IndicatorSet 타입에 그대로 박힘)
+            static constexpr std::size_t entryChannel = 20;
+            static constexpr std::size_t exitChannel = 10;
+            static constexpr std::size_t volatilityWindow = 20;
+
+            double minVolatility{ 0.003 };   // 움직임 없는 구간의 가짜 돌파 배제
+
+            // krw_to_use = account.krw_available / reserve_margin * utilization
+            double utilization{ 1.0 };
+            double stopLossPct{ 3 };         // 진입가 대비 손절 %
+            double profitTargetPct{ 8 };     // 진입가 대비 익절 %
+        };
+
+        using State = trading::StrategyState;
+
+        using EntryChannel = trading::indicators::Donchian<Params::entryChannel>;
+        using ExitChannel = trading::indicators::Donchian<Params::exitChannel>;
+        using Volatility = trading::indicators::ReturnStdev<Params::volatilityWindow>;
+        using Indicators = trading::indicators::IndicatorSet<EntryChannel, ExitChannel, Volatility>;
+
+        static constexpr std::size_t kSeriesLookback = Indicators::kLookback;
+
+        static constexpr StrategyId kId = "channel_breakout";
+
+    public:
+        // @throws std::invalid_argument series 용량 < kSeriesLookback
+        BreakoutStrategy(std::string market, Params p, const marketdata::PriceSeries& series);
+
+        [[nodiscard]] StrategyId id() const noexcept { return kId; }
+        [[nodiscard]] const std::string& market() const noexcept { return position_.market(); }
+
+        [[nodiscard]] State state() const noexcept { return position_.state(); }
+        [[nodiscard]] double entryPrice() const noexcept { return position_.entryPrice().value_or(0.0); }
+        [[nodiscard]] double stopPrice() const noexcept { return position_.stopPrice().value_or(0.0); }
+        [[nodiscard]] double targetPrice() const noexcept { return position_.targetPrice().value_or(0.0); }
+
+        [[nodiscard]] const Snapshot& signalSnapshot() const noexcept { return position_.signalSnapshot(); }
+
+        // c = series의 최신 봉 (StrategySet이 push 완료)
+        [[nodiscard]] Decision onCandle(const core::Candle& c, const AccountSnapshot& account);
+
+        [[nodiscard]] Decision onIntrabarCandle(double intrabar_close, const AccountSnapshot& account)
+        {
+            return position_.intrabarExit(intrabar_close, account);
+        }
+
+        void onFill(const FillEvent& fill) { position_.onFill(fill); }
+        void onOrderUpdate(const trading::OrderStatusEvent& ev) { position_.onOrderUpdate(ev); }
+        void onSubmitFailed() { position_.onSubmitFailed(); }
+        void syncOnStart(const trading::PositionSnapshot& pos) { position_.syncOnStart(pos); }
+
+        void onWarmUpCandle(const core::Candle& c);
+
+        void setSignalCallback(trading::SignalHandler fn) { position_.setSignalCallback(std::move(fn)); }
+
+        void reset();
+
+    private:
+        [[nodiscard]] Snapshot buildSnapshot(const core::Candle& c);
+
+    private:
+        Params params_{};
+        PositionTracker position_;
+
+        const marketdata::PriceSeries& series_;
+        Indicators indicators_{};
+    };
+
+} // namespace trading::strategies
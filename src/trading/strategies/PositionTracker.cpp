@@ -0,0 +1,433 @@
+﻿#include "PositionTracker.h"
+
+#include <algorithm> // std::max
+#include <chrono>
+#include <utility>   // std::move
+
+// 재시작/멀티프로세스 안전한 client_order_id를 위해 UUID 사용
+#include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <boost/uuid/random_generator.hpp>
+
+#include "util/Config.h"
+#include "util/Logger.h"
+
+namespace {
+    // 현재 시각을 epoch milliseconds로 반환
+    int64_t nowMs() {
+        using namespace std::chrono;
+        return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+    }
+
+    // thread_local: 멀티스레드 환경에서도 경쟁을 줄이고 생성기 안전성을 높임
+    std::string makeUuidV4()
+    {
+        static thread_local boost::uuids::random_generator gen;
+        return boost::uuids::to_string(gen());
+    }
+}
+
+namespace trading::strategies {
+
+    PositionTracker::PositionTracker(StrategyId strategy_id, std::string market,
+                                     double stop_loss_pct, double profit_target_pct)
+        : id_(strategy_id), market_(std::move(market)),
+          stop_loss_pct_(stop_loss_pct), profit_target_pct_(profit_target_pct)
+    {
+    }
+
+    void PositionTracker::reset()
+    {
+        state_ = State::Flat;
+        clearPending_();
+        clearPosition_();
+        signal_snapshot_ = Snapshot{};
+    }
+
+    void PositionTracker::clearPending_()
+    {
+        // 부분/복수 체결 누적값 초기화
+        // - 실거래에서는 한 주문이 여러 번 나눠 체결될 수 있으므로,
+        //   FillEvent가 올 때마다 누적하고, 최종 확정은 주문상태(Filled)에서 처리한다.
+        pending_client_id_.reset();
+        pending_exit_reason_.clear();
+        pending_filled_volume_ = 0.0;
+        pending_cost_sum_ = 0.0;
+        pending_last_price_ = 0.0;
+    }
+
+    void PositionTracker::clearPosition_()
+    {
+        entry_price_.reset();
+        stop_price_.reset();
+        target_price_.reset();
+    }
+
+    void PositionTracker::syncOnStart(const trading::PositionSnapshot& pos)
+    {
+        // - 미체결 주문은 앱/엔진 시작 루틴에서 “전부 취소”한다. (StartupRecovery)
+        // - 따라서 전략은 미체결을 이어받지 않고, 포지션만 복구한다.
+
+        // 시작 시 pending 상태는 항상 제거(미체결 이어받기 X)
+        clearPending_();
+
+        // avg_entry_price가 신뢰 가능하면(entry/stop/target 복구 가능)
+        // 평균매수가가 없거나 신뢰가 낮으면, 임의 기준가로 stop/target을 만드는 것은 위험 → Flat
+        if (pos.hasPosition() && pos.avg_entry_price > 0.0)
+        {
+            state_ = State::InPosition;
+            entry_price_ = pos.avg_entry_price;
+            setStopsFromEntry(*entry_price_);
+        }
+        else
+        {
+            state_ = State::Flat;
+            clearPosition_();
+        }
+    }
+
+    void PositionTracker::reconcile(const AccountSnapshot& account, double close)
+    {
+        const double posNotional = account.coin_available * close;
+        const double min_notional = util::AppConfig::instance().strategy.min_notional_krw;
+
+        if (state_ == State::Flat && posNotional >= min_notional)
+        {
+            // 재시작/partial-exit 상황에서 실제 보유를 기준으로 InPosition 복구
+            // 실제 진입가 불명 → 현재 close를 가상 진입가로 사용
+            state_ = State::InPosition;
+            entry_price_ = close;
+            setStopsFromEntry(*entry_price_);
+        }
+        else if (state_ == State::InPosition && posNotional < min_notional)
+        {
+            // 거래 불가 dust → Flat 취급으로 고착 방지
+            state_ = State::Flat;
+            clearPosition_();
+        }
+    }
+
+    Decision PositionTracker::submitEntry(double krw_amount, std::string_view tag, const Snapshot& s)
+    {
+        const std::string cid = makeIdentifier(tag);
+        core::OrderRequest req = makeMarketBuyByAmount(krw_amount, tag); // 우선 시장가로
+        req.identifier = cid;
+
+        // 이 주문에 대한 부분 체결 누적을 새로 시작
+        clearPending_();
+
+        // 진입 신호 시점 스냅샷 저장 (BUY 신호 기록 시 rsi/volatility 소스)
+        signal_snapshot_ = s;
+
+        // 상태 전이: Flat -> PendingEntry
+        state_ = State::PendingEntry;
+        pending_client_id_ = cid;
+
+        // entry 가격은 onFill에서 누적하고, 최종 확정은 onOrderUpdate(Filled)에서
+        return Decision::submit(std::move(req));
+    }
+
+    Decision PositionTracker::submitExit(double volume, std::string_view tag, const Snapshot& s)
+    {
+        const std::string cid = makeIdentifier(tag);
+        core::OrderRequest req = makeMarketSellByVolume(volume, tag);
+        req.identifier = cid;
+
+        clearPending_();
+
+        // 청산 신호 시점 스냅샷 저장 (SELL 신호 기록 시 rsi/volatility 소스)
+        signal_snapshot_ = s;
+
+        // 상태 전이: InPosition -> PendingExit
+        state_ = State::PendingExit;
+        pending_client_id_   = cid;
+        pending_exit_reason_ = std::string(tag);
+
+        return Decision::submit(std::move(req));
+    }
+
+    Decision PositionTracker::intrabarExit(
+        double intrabar_close, const AccountSnapshot& account)
+    {
+        // req 4: InPosition 상태에서만 동작
+        if (state_ != State::InPosition)
+            return Decision::noAction();
+
+        if (!account.canSell())
+            return Decision::noAction();
+
+        // stop/target 미설정 시 판단 불가
+        if (!stop_price_.has_value() || !target_price_.has_value())
+            return Decision::noAction();
+
+        const bool hitStop   = (intrabar_close <= *stop_price_);
+        const bool hitTarget = (intrabar_close >= *target_price_);
+
+        if (!hitStop && !hitTarget)
+            return Decision::noAction();
+
+        // req 8: exit_reason은 기존 문자열 규칙 그대로 (stop/target 구분 유지)
+        std::string reason_tag;
+        if (hitStop)   reason_tag = "exit_stop";
+        if (hitTarget) reason_tag = reason_tag.empty() ? "exit_target" : reason_tag + "_target";
+
+        // min_notional 체크 (기존 maybeExit와 동일)
+        const double min_notional = util::AppConfig::instance().strategy.min_notional_krw;
+        if (account.coin_available * intrabar_close < min_notional)
+            return Decision::noAction();
+
+        // req 8: intrabar 스냅샷 — close만 있고 지표는 미준비
+        // → SignalRecord 기록 시 rsi/volatility/trend_strength = nullopt (DB NULL 자동)
+        Snapshot intrabar_snap{};
+        intrabar_snap.close = intrabar_close;
+
+        // req 6: InPosition → PendingExit 전이 (중복 청산 방지)
+        return submitExit(account.coin_available, reason_tag, intrabar_snap);
+    }
+
+    // “부분체결 대응 필요”
+    void PositionTracker::onFill(const FillEvent& fill)
+    {
+        // 1) “내가 낸 pending 주문”인지 확인
+        if (!pending_client_id_.has_value())
+            return;
+
+        if (fill.identifier != *pending_client_id_)
+            return;
+
+        // 2) 부분/복수 체결 누적
+        // - FillEvent는 여러 번 올 수 있고, 이것만으로 완전 체결을 보장하지 않음
+        // - 따라서 여기서는 "누적만" 하고, pending 해제/상태 확정은 onOrderUpdate(Filled)에서 수행한다.
+        pending_last_price_ = fill.fill_price;
+
+        // 일부 WS 구현/환경에서는 filled_volume이 0으로 올 수 있어 방어적으로 처리
+        if (fill.filled_volume > 0.0) {
+            pending_filled_volume_ += fill.filled_volume;
+            pending_cost_sum_ += (fill.fill_price * fill.filled_volume);
+        }
+    }
+
+    void PositionTracker::onOrderUpdate(const OrderStatusEvent& ev)
+    {
+        if (!pending_client_id_.has_value())
+            return;
+
+        if (ev.identifier != *pending_client_id_)
+            return;
+
+        const bool is_terminal =
+            ev.status == core::OrderStatus::Filled  ||
+            ev.status == core::OrderStatus::Canceled ||
+            ev.status == core::OrderStatus::Rejected;
+        if (!is_terminal)
+            return;
+
+        const core::PositionEffect effect = ev.position_effect;
+
+        // None - 순수 체결 없이 주문 취소
+        if (effect == core::PositionEffect::None)
+        {
+            state_ = (state_ == State::PendingEntry) ? State::Flat : State::InPosition;
+            clearPending_();
+            return;
+        }
+
+        // 체결가/수량: WS 누적 VWAP → REST 폴백 → 마지막 체결가
+        const double final_price = (pending_filled_volume_ > 0.0)
+            ? (pending_cost_sum_ / pending_filled_volume_)
+            : (ev.executed_volume > 0.0 && ev.executed_funds > 0.0
+                ? ev.executed_funds / ev.executed_volume
+                : pending_last_price_);
+        const double filled_volume =
+            pending_filled_volume_ > 0.0 ? pending_filled_volume_ : ev.executed_volume;
+        const double krw_amount = pending_cost_sum_ > 0.0 ? pending_cost_sum_ : ev.executed_funds;
+
+        if (state_ == State::PendingEntry && effect == core::PositionEffect::Opened)
+        {
+            if (final_price > 0.0)
+            {
+                entry_price_ = final_price;
+                setStopsFromEntry(*entry_price_);
+                logEntryConfirmed_(ev.status == core::OrderStatus::Filled
+                    ? "filled" : "cancel_after_trade", *entry_price_);
+            }
+            else
+            {
+                util::Logger::instance().warn(
+                    "[Strategy][EntryConfirmed] reason=cancel_after_trade strategy=", id_,
+                    " market=", market_, " entry_price_unavailable");
+            }
+            state_ = State::InPosition;
+
+            if (signal_callback_ && entry_price_.has_value()) {
+                trading::SignalRecord sig = makeSignal_(trading::SignalSide::BUY,
+                    *entry_price_, filled_volume, krw_amount);
+                sig.stop_price   = stop_price_;
+                sig.target_price = target_price_;
+                sig.is_partial   = 0;
+                signal_callback_(sig);
+            }
+        }
+        else if (state_ == State::PendingExit && effect == core::PositionEffect::Reduced)
+        {
+            // 부분 청산(is_partial=1)
+            if (signal_callback_ && filled_volume > 0.0) {
+                trading::SignalRecord sig = makeSignal_(trading::SignalSide::SELL,
+                    final_price, filled_volume, krw_amount);
+                sig.is_partial  = 1;
+                sig.exit_reason = pending_exit_reason_;
+                signal_callback_(sig);
+            }
+            // 수량 추적은 계좌 스냅샷에 맡기고 InPosition 유지
+            state_ = State::InPosition;
+        }
+        else if (state_ == State::PendingExit && effect == core::PositionEffect::Closed)
+        {
+            // 완전 청산(is_partial=0): Filled/Canceled 공통 경로
+            if (signal_callback_ && final_price > 0.0) {
+                trading::SignalRecord sig = makeSignal_(trading::SignalSide::SELL,
+                    final_price, filled_volume, krw_amount);
+                sig.is_partial  = 0;
+                sig.exit_reason = pending_exit_reason_;
+                signal_callback_(sig);
+            }
+            state_ = State::Flat;
+            clearPosition_();
+        }
+        else
+        {
+            // 예상치 못한 state/effect 조합 → 보수적 롤백
+            util::Logger::instance().warn(
+                "[Strategy][OrderUpdate] unexpected state/effect strategy=", id_,
+                " market=", market_, " effect=", static_cast<int>(effect));
+            state_ = (state_ == State::PendingEntry) ? State::Flat : State::InPosition;
+        }
+
+        clearPending_();
+    }
+
+    void PositionTracker::onSubmitFailed()
+    {
+        // 엔진 submit(=주문 POST)이 실패하면 WS 이벤트가 절대 오지 않는다.
+        // 따라서 Pending 상태가 영원히 풀리지 않도록, 여기서 즉시 롤백한다.
+        //
+        // 정책(최소 변경):
+        // - PendingEntry: Flat으로 복귀
+        // - PendingExit : InPosition으로 복귀
+        // - 부분 체결은 "submit 실패" 케이스에서는 발생하지 않는다고 가정(POST 자체가 실패)
+
+        if (!pending_client_id_.has_value())
+            return;
+
+        if (state_ == State::PendingEntry)
+        {
+            state_ = State::Flat;
+        }
+        else if (state_ == State::PendingExit)
+        {
+            state_ = State::InPosition;
+        }
+
+        // pending 누적값 정리(안전)
+        clearPending_();
+    }
+
+    void PositionTracker::setStopsFromEntry(double entry)
+    {
+        // 손절/익절 %는 “진입가 기준 퍼센트”
+        const double sl = std::max(0.0, stop_loss_pct_);
+        const double tp = std::max(0.0, profit_target_pct_);
+
+        stop_price_ = entry * (1.0 - sl / 100.0);
+        target_price_ = entry * (1.0 + tp / 100.0);
+    }
+
+    void PositionTracker::logEntryConfirmed_(std::string_view reason, double entry)
+    {
+        // entry 확정 시점에만 호출하는 로깅 헬퍼
+        // stop/target은 setStopsFromEntry()가 먼저 호출되어 값이 세팅되어 있어야 함
+        const double stop = stop_price_.value_or(0.0);
+        const double target = target_price_.value_or(0.0);
+
+        util::Logger::instance().info("[Strategy][EntryConfirmed] reason=", reason,
+            " strategy=", id_,
+            " market=", market_,
+            " entry=", entry,
+            " stop=", stop,
+            " target=", target,
+            " (SL%=", stop_loss_pct_, ", TP%=", profit_target_pct_, ")");
+    }
+
+    trading::SignalRecord PositionTracker::makeSignal_(trading::SignalSide side, double price,
+                                                       double volume, double krw_amount) const
+    {
+        trading::SignalRecord sig;
+        sig.market     = market_;
+        sig.identifier = *pending_client_id_;
+        sig.side       = side;
+        sig.price      = price;
+        sig.volume     = volume;
+        sig.krw_amount = krw_amount;
+        sig.rsi            = signal_snapshot_.rsi.ready        ? std::optional<double>(signal_snapshot_.rsi.v)        : std::nullopt;
+        sig.volatility     = signal_snapshot_.volatility.ready ? std::optional<double>(signal_snapshot_.volatility.v) : std::nullopt;
+        sig.trend_strength = signal_snapshot_.trendReady       ? std::optional<double>(signal_snapshot_.trendStrength) : std::nullopt;
+        sig.ts_ms      = nowMs();
+        return sig;
+    }
+
+    std::string PositionTracker::makeIdentifier(std::string_view tag) const
+    {
+        // 전략 내부 유니크 ID (demo/real 공통: client_order_id로 매칭)
+        // 예: "rsi_mean_reversion:KRW-BTC:entry_rsi_oversold:<uuid>"
+        std::string cid;
+        cid.reserve(128);
+
+        cid.append(id_);
+        cid.push_back(':');
+        cid.append(market_);
+        cid.push_back(':');
+        cid.append(tag);
+        cid.push_back(':');
+        cid.append(makeUuidV4());
+
+        return cid;
+    }
+
+    core::OrderRequest PositionTracker::makeMarketBuyByAmount(double krw_amount, std::string_view tag) const
+    {
+        core::OrderRequest req{};
+        req.market = market_;
+        req.position = core::OrderPosition::BID;
+        req.type = core::OrderType::Market;
+
+        // BID(매수)는 “금액(Amount)” 기준이 자연스러움
+        req.size = core::AmountSize{ krw_amount };
+
+        req.price.reset(); // 시장가
+        req.strategy_id = std::string(id_);
+        req.client_tag = std::string(tag);
+
+        // client_order_id는 바깥에서 생성해 주입(상태 전이와 맞물리기 때문)
+        req.identifier.clear();
+        return req;
+    }
+
+    core::OrderRequest PositionTracker::makeMarketSellByVolume(double volume, std::string_view tag) const
+    {
+        core::OrderRequest req{};
+        req.market = market_;
+        req.position = core::OrderPosition::ASK;
+        req.type = core::OrderType::Market;
+
+        // ASK(매도)는 “수량(Volume)” 기준이 자연스러움
+        req.size = core::VolumeSize{ volume };
+
+        req.price.reset(); // 시장가
+        req.strategy_id = std::string(id_);
+        req.client_tag = std::string(tag);
+
+        req.identifier.clear();
+        return req;
+    }
+
+} // namespace trading::strategies
@@ -0,0 +1,116 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "StrategyTypes.h"
+
+namespace trading::strategies {
+
+    /*
+        PositionTracker - 전략 1개의 주문/포지션 수명 주기 (전략 공통 부분)
+        - 진입/청산 "판단"은 전략이, 주문 생성 + Pending 전이 + 체결 누적 + 확정/롤백 + 신호 기록은 여기서
+        - 상태 머신:
+            Flat -> PendingEntry -> InPosition -> PendingExit -> Flat
+            (부분 청산: PendingExit -> InPosition, 취소/거절/submit 실패: 직전 상태로 롤백)
+        - entry(진입가)/stop(손절가)/target(익절가)은 주문 확정(onOrderUpdate) 시점에 확정
+        - client_order_id = "<strategy_id>:<market>:<tag>:<uuid>" → 전략 id prefix로 주문 소유 전략을 가림
+    */
+    class PositionTracker final {
+    public:
+        using State = trading::StrategyState;
+
+        // stop_loss_pct / profit_target_pct: 진입가 대비 %
+        PositionTracker(StrategyId strategy_id, std::string market,
+                        double stop_loss_pct, double profit_target_pct);
+
+        [[nodiscard]] StrategyId id() const noexcept { return id_; }
+        [[nodiscard]] const std::string& market() const noexcept { return market_; }
+
+        [[nodiscard]] State state() const noexcept { return state_; }
+        [[nodiscard]] const std::optional<double>& entryPrice() const noexcept { return entry_price_; }
+        [[nodiscard]] const std::optional<double>& stopPrice() const noexcept { return stop_price_; }
+        [[nodiscard]] const std::optional<double>& targetPrice() const noexcept { return target_price_; }
+
+        // 마지막 신호 발생 시점 스냅샷 (진입/청산 주문 생성 시 저장)
+        [[nodiscard]] const Snapshot& signalSnapshot() const noexcept { return signal_snapshot_; }
+
+        // Flat/InPosition에 한해 실제 보유 자산과의 불일치를 보정한다.
+        // - Flat인데 의미 있는 코인 보유: 재시작/외부 거래 복구 → InPosition (진입가 = close)
+        // - InPosition인데 dust만 남음: 거래 불가 잔량 → Flat
+        void reconcile(const AccountSnapshot& account, double close);
+
+        // 주문 의도 생성 + Pending 전이 (tag는 client_tag/청산 사유로 기록)
+        // Flat -> PendingEntry
+        [[nodiscard]] Decision submitEntry(double krw_amount, std::string_view tag, const Snapshot& s);
+        // InPosition -> PendingExit
+        [[nodiscard]] Decision submitExit(double volume, std::string_view tag, const Snapshot& s);
+
+        // intrabar(미확정) close가 손절가/익절가에 도달하면 전량 청산 (InPosition에서만, 전략 공통)
+        [[nodiscard]] Decision intrabarExit(double intrabar_close, const AccountSnapshot& account);
+
+        // 체결 이벤트(부분/복수 체결 누적, 내 pending 주문이 아니면 무시)
+        void onFill(const FillEvent& fill);
+
+        // 주문 상태 이벤트(최종 확정/롤백 기준, 내 pending 주문이 아니면 무시)
+        void onOrderUpdate(const trading::OrderStatusEvent& ev);
+
+        // 엔진 submit 실패 시 Pending 즉시 롤백 (WS 이벤트가 절대 오지 않음)
+        void onSubmitFailed();
+
+        // 시작 시 포지션만 복구 (미체결은 상위에서 전부 취소 후 호출)
+        void syncOnStart(const trading::PositionSnapshot& pos);
+
+        // BUY: PendingEntry→InPosition 확정 시, SELL: PendingExit→Flat/InPosition(부분) 확정 시 호출
+        void setSignalCallback(trading::SignalHandler fn) { signal_callback_ = std::move(fn); }
+
+        void reset();
+
+    private:
+        [[nodiscard]] std::string makeIdentifier(std::string_view tag) const;
+        [[nodiscard]] core::OrderRequest makeMarketBuyByAmount(double krw_amount, std::string_view tag) const;
+        [[nodiscard]] core::OrderRequest makeMarketSellByVolume(double volume, std::string_view tag) const;
+
+        void clearPending_();
+        void clearPosition_();
+
+        // stop/target 계산(체결가 기준)
+        void setStopsFromEntry(double entry);
+        // 진입 시 손절, 익절가 확인용 로그 함수
+        void logEntryConfirmed_(std::string_view reason, double entry);
+
+        [[nodiscard]] trading::SignalRecord makeSignal_(trading::SignalSide side, double price,
+                                                        double volume, double krw_amount) const;
+
+    private:
+        StrategyId id_;
+        std::string market_;
+        double stop_loss_pct_{ 0.0 };
+        double profit_target_pct_{ 0.0 };
+
+        // 상태 + 주문 추적
+        State state_{ State::Flat };
+        std::optional<std::string> pending_client_id_{};
+        std::string pending_exit_reason_{}; // submitExit() 에서 set, SELL 신호 기록 시 사용
+
+        // 부분 체결 누적용
+        double pending_filled_volume_{ 0.0 }; // Σ filled_volume 지금까지 체결된 수량
+        double pending_cost_sum_{ 0.0 };      // Σ (fill_price * filled_volume) 지금까지 체결된 총 비용
+        double pending_last_price_{ 0.0 };    // 접수된 주문에서 가장 마지막 체결 가격(filled_volume이 0으로 올 때 폴백)
+
+        // 포지션 정보(확정은 onOrderUpdate에서)
+        std::optional<double> entry_price_{};
+        std::optional<double> stop_price_{};
+        std::optional<double> target_price_{};
+
+        // 마지막 신호 발생 시점 스냅샷 (DB signals 테이블의 rsi/volatility 소스)
+        Snapshot signal_snapshot_{};
+
+        // DB 신호 콜백 (MarketEngineManager가 등록, 없으면 no-op)
+        trading::SignalHandler signal_callback_{};
+    };
+
+} // namespace trading::strategies
@@ -1,27 +1,14 @@
 ﻿#include "RsiMeanReversionStrategy.h"
 
-#include <algorithm> // std::max, std::min
-#include <chrono>
 #include <cmath>     // std::abs
+#include <iomanip>   // std::setprecision
+#include <sstream>
+#include <stdexcept> // std::invalid_argument
 #include <utility>   // std::move
 
-// 재시작/멀티프로세스 안전한 client_order_id를 위해 UUID 사용
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_io.hpp>
-#include <boost/uuid/random_generator.hpp>
-
 #include "util/Config.h"
 #include "util/Logger.h"
 
-namespace {
-    // 현재 시각을 epoch milliseconds로 반환
-    int64_t nowMs() {
-        using namespace std::chrono;
-        return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
-    }
-
-}
-
 namespace trading::strategies {
 
     template <typename T>
@@ -34,154 +21,54 @@ namespace trading::strategies {
         return oss.str();
     }
 
-    // thread_local: 멀티스레드 환경에서도 경쟁을 줄이고 생성기 안전성을 높임
-    std::string makeUuidV4()
+    // 지표 확인 로그용 문자열 (COINBOT_LOG_DEBUG 인자로만 사용)
+    std::string indicatorsToString_(const Snapshot& s)
     {
-        static thread_local boost::uuids::random_generator gen;
-        return boost::uuids::to_string(gen());
+        std::ostringstream oss;
+        oss << indicatorToString_("rsi", s.rsi)
+            << indicatorToString_("vol", s.volatility)
+            << " trendStrength=";
+        if (s.trendReady) oss << std::fixed << std::setprecision(6) << s.trendStrength;
+        else              oss << "N/A";
+        return oss.str();
     }
 
 
 
-    RsiMeanReversionStrategy::RsiMeanReversionStrategy(std::string market, Params p)
-        : market_(std::move(market)), params_(p)
+    RsiMeanReversionStrategy::RsiMeanReversionStrategy(std::string market, Params p,
+                                                       const marketdata::PriceSeries& series)
+        : params_(p),
+          position_(kId, std::move(market), p.stopLossPct, p.profitTargetPct),
+          series_(series)
     {
-        // 지표 초기화(윈도우/길이 세팅)
-        rsi_.reset(params_.rsiLength);
-        closeN_.reset(params_.trendLookWindow);
-        vol_.reset(params_.volatilityWindow);
+        if (series_.capacity() < kSeriesLookback)
+            throw std::invalid_argument("[Strategy] PriceSeries capacity too small for indicators");
 
         reset();
     }
 
     void RsiMeanReversionStrategy::reset()
     {
-        // 상태 초기화
-        state_ = State::Flat;
-        pending_client_id_.reset();
-        pending_exit_reason_.clear();
-
-        // 부분/복수 체결 누적값 초기화
-        // - 실거래에서는 한 주문이 여러 번 나눠 체결될 수 있으므로,
-        //   FillEvent가 올 때마다 누적하고, 최종 확정은 주문상태(Filled)에서 처리한다.
-        pending_filled_volume_ = 0.0;
-        pending_cost_sum_ = 0.0;
-        pending_last_price_ = 0.0;
-
-        // 포지션 정보 초기화
-        entry_price_.reset();
-        stop_price_.reset();
-        target_price_.reset();
+        // 상태/pending/포지션 정보 초기화
+        position_.reset();
 
         // 지표 내부 상태 초기화
-        rsi_.clear();
-        closeN_.clear();
-        vol_.clear();
-
-        signal_snapshot_ = Snapshot{};
-
-        last_candle_ts_.reset();
-    }
-
-    void RsiMeanReversionStrategy::syncOnStart(const trading::PositionSnapshot& pos)
-    {
-        // - 미체결 주문은 앱/엔진 시작 루틴에서 “전부 취소”한다. (StartupRecovery)
-        // - 따라서 전략은 미체결을 이어받지 않고, 포지션만 복구한다.
-
-        // 시작 시 pending 상태는 항상 제거(미체결 이어받기 X)
-        pending_client_id_.reset();
-        pending_exit_reason_.clear();
-        pending_filled_volume_ = 0.0;
-        pending_cost_sum_ = 0.0;
-        pending_last_price_ = 0.0;
-
-        if (pos.hasPosition())
-        {
-            state_ = State::InPosition;
-
-            // avg_entry_price가 신뢰 가능하면(entry/stop/target 복구 가능)
-            if (pos.avg_entry_price > 0.0)
-            {
-                entry_price_ = pos.avg_entry_price;
-                setStopsFromEntry(*entry_price_);
-            }
-            else
-            {
-                // 평균매수가가 없거나 신뢰가 낮으면,
-                // 전략이 “임의로 기준가를 만들어” stop/target을 설정하는 것은 위험
-                state_ = State::Flat;
-                entry_price_.reset();
-                stop_price_.reset();
-                target_price_.reset();
-            }
-        }
-        else
-        {
-            state_ = State::Flat;
-            entry_price_.reset();
-            stop_price_.reset();
-            target_price_.reset();
-        }
+        indicators_.clear();
     }
 
     Decision RsiMeanReversionStrategy::onCandle(const core::Candle& c, const AccountSnapshot& account)
     {
-        // market 고정 전략이므로 다른 market 봉이 들어오면 아무것도 하지 않음
-        if (c.market != market_)
-            return Decision::noAction();
-
-        // 같은 ts(같은 1분 캔들 업데이트)가 반복되면 지표에 누적하지 않음
-        if (last_candle_ts_.has_value() && *last_candle_ts_ == c.start_timestamp)
-        {
-            // 필요하면 디버그 확인용 로그(원인 검증)
-            util::Logger::instance().debug("[Strategy][Dedup] same candle ts ignored. market=", c.market,
-                " ts=", c.start_timestamp, " close=", static_cast<double>(c.close_price));
-
-            return Decision::noAction();
-        }
-        last_candle_ts_ = c.start_timestamp;
-
         // 1) 지표/필터 스냅샷 생성(여기서 update가 모두 끝남)
         const Snapshot s = buildSnapshot(c);
 
-        // 지표 확인 로그
-        std::ostringstream oss;
-        oss << indicatorToString_("rsi", s.rsi)
-            << indicatorToString_("vol", s.volatility)
-            << " trendStrength=";
-        if (s.trendReady) oss << std::fixed << std::setprecision(6) << s.trendStrength;
-        else              oss << "N/A";
-
-        util::Logger::instance().debug("[Strategy][Indicators]", oss.str());
+        // 지표 확인 로그 (DEBUG 비활성 시 문자열 조합 자체를 건너뛴다)
+        COINBOT_LOG_DEBUG("[Strategy][Indicators]", indicatorsToString_(s));
 
         // Flat/InPosition에 한해 실제 보유 자산과의 불일치를 보정한다.
-        // - Flat인데 의미 있는 코인 보유: 재시작/외부 거래 복구 → InPosition
-        // - InPosition인데 dust만 남음: 거래 불가 잔량 → Flat
-        const double posNotional = account.coin_available * s.close;
-        const auto& strategy_cfg = util::AppConfig::instance().strategy;
-        const bool hasMeaningfulPos = (posNotional >= strategy_cfg.min_notional_krw);
-        const bool isTrueDust       = (posNotional <  strategy_cfg.min_notional_krw);
-
-        if (state_ == State::Flat && hasMeaningfulPos)
-        {
-            // 재시작/partial-exit 상황에서 실제 보유를 기준으로 InPosition 복구
-            // 실제 진입가 불명 → 현재 close를 가상 진입가로 사용
-            state_ = State::InPosition;
-            entry_price_ = s.close;
-            setStopsFromEntry(*entry_price_);
-        }
-        else if (state_ == State::InPosition && isTrueDust)
-        {
-            // 거래 불가 dust → Flat 취급으로 고착 방지
-            state_ = State::Flat;
-            entry_price_.reset();
-            stop_price_.reset();
-            target_price_.reset();
-        }
-        // -----------------------------------------------------------
+        position_.reconcile(account, s.close);
 
         // 2) 상태에 따라 “진입” 또는 “청산” 판단
-        switch (state_) {
+        switch (position_.state()) {
         case State::Flat:
             return maybeEnter(s, account);
 
@@ -200,15 +87,21 @@ namespace trading::strategies {
         }
     }
 
+    void RsiMeanReversionStrategy::onWarmUpCandle(const core::Candle& c)
+    {
+        (void)buildSnapshot(c);
+    }
+
     Snapshot RsiMeanReversionStrategy::buildSnapshot(const core::Candle& c)
     {
         Snapshot s{};
         s.close = static_cast<double>(c.close_price);
 
-        // --- 지표 업데이트(핵심: “한 봉에 한 번씩” update) ---
-        s.rsi = rsi_.update(c);
-        s.closeN = closeN_.update(c);
-        s.volatility = vol_.update(c);
+        // --- 지표 업데이트(핵심: “한 봉에 한 번씩” update, 봉은 StrategySet이 이미 push) ---
+        indicators_.update(series_);
+        s.rsi = indicators_.get<Rsi>().value();
+        s.closeN = indicators_.get<CloseN>().value();
+        s.volatility = indicators_.get<Volatility>().value();
 
 
 
@@ -267,25 +160,8 @@ namespace trading::strategies {
             return Decision::noAction();
 
         // 진입 사유를 태그로 남겨 주문/로그에서 추적 가능하게 한다.
-        const char* reason_tag = "entry_rsi_oversold";
-        const std::string cid = makeIdentifier(reason_tag);
-        core::OrderRequest req = makeMarketBuyByAmount(krw_to_use, reason_tag); // 우선 시장가로
-        req.identifier = cid;
-
-        // 이 주문에 대한 부분 체결 누적을 새로 시작
-        pending_filled_volume_ = 0.0;
-        pending_cost_sum_ = 0.0;
-        pending_last_price_ = 0.0;
-
-        // 진입 신호 시점 스냅샷 저장 (BUY 신호 기록 시 rsi/volatility 소스)
-        signal_snapshot_ = s;
-
-        // 상태 전이: Flat -> PendingEntry
-        state_ = State::PendingEntry;
-        pending_client_id_ = cid;
-
-        // entry 가격은 onFill에서 누적하고, 최종 확정은 onOrderUpdate(Filled)에서
-        return Decision::submit(std::move(req));
+        // 상태 전이: Flat -> PendingEntry (entry 가격은 onFill 누적, 확정은 onOrderUpdate)
+        return position_.submitEntry(krw_to_use, "entry_rsi_oversold", s);
     }
 
     Decision RsiMeanReversionStrategy::maybeExit(const Snapshot& s, const AccountSnapshot& account)
@@ -302,7 +178,10 @@ namespace trading::strategies {
         bool hitTarget = false;
 
         // RSI 기반 청산은 허용해서 InPosition 고착을 방지
-        if (!entry_price_.has_value() || !stop_price_.has_value() || !target_price_.has_value())
+        const auto& entry = position_.entryPrice();
+        const auto& stop = position_.stopPrice();
+        const auto& target = position_.targetPrice();
+        if (!entry.has_value() || !stop.has_value() || !target.has_value())
         {
             if (!rsiExit)
                 return Decision::noAction();
@@ -312,10 +191,10 @@ namespace trading::strategies {
             const double close = s.close;
 
             // 2. 손절
-            hitStop = (close <= *stop_price_);
+            hitStop = (close <= *stop);
 
             // 3. 익절
-            hitTarget = (close >= *target_price_);
+            hitTarget = (close >= *target);
 
             if (!(hitStop || hitTarget || rsiExit))
                 return Decision::noAction();
@@ -335,352 +214,12 @@ namespace trading::strategies {
             reason_tag = "exit_unknown";
         }
 
-        const std::string cid = makeIdentifier(reason_tag);
         const double sellVol = account.coin_available;
         if (sellVol * s.close < util::AppConfig::instance().strategy.min_notional_krw)
             return Decision::noAction();
 
-        core::OrderRequest req = makeMarketSellByVolume(sellVol, reason_tag);
-        req.identifier = cid;
-
-        // 이 주문에 대한 부분 체결 누적을 새로 시작
-        pending_filled_volume_ = 0.0;
-        pending_cost_sum_ = 0.0;
-        pending_last_price_ = 0.0;
-
-        // 청산 신호 시점 스냅샷 저장 (SELL 신호 기록 시 rsi/volatility 소스)
-        signal_snapshot_ = s;
-
         // 상태 전이: InPosition -> PendingExit
-        state_ = State::PendingExit;
-        pending_client_id_   = cid;
-        pending_exit_reason_ = reason_tag;
-
-        return Decision::submit(std::move(req));
-    }
-
-    Decision RsiMeanReversionStrategy::onIntrabarCandle(
-        double intrabar_close, const AccountSnapshot& account)
-    {
-        // req 4: InPosition 상태에서만 동작
-        if (state_ != State::InPosition)
-            return Decision::noAction();
-
-        if (!account.canSell())
-            return Decision::noAction();
-
-        // stop/target 미설정 시 판단 불가
-        if (!stop_price_.has_value() || !target_price_.has_value())
-            return Decision::noAction();
-
-        const bool hitStop   = (intrabar_close <= *stop_price_);
-        const bool hitTarget = (intrabar_close >= *target_price_);
-
-        if (!hitStop && !hitTarget)
-            return Decision::noAction();
-
-        // req 8: exit_reason은 기존 문자열 규칙 그대로 (stop/target 구분 유지)
-        std::string reason_tag;
-        if (hitStop)   reason_tag = "exit_stop";
-        if (hitTarget) reason_tag = reason_tag.empty() ? "exit_target" : reason_tag + "_target";
-
-        // min_notional 체크 (기존 maybeExit와 동일)
-        const double min_notional = util::AppConfig::instance().strategy.min_notional_krw;
-        if (account.coin_available * intrabar_close < min_notional)
-            return Decision::noAction();
-
-        const std::string cid = makeIdentifier(reason_tag);
-        core::OrderRequest req = makeMarketSellByVolume(account.coin_available, reason_tag);
-        req.identifier = cid;
-
-        // 부분 체결 누적 초기화 (기존 maybeExit와 동일)
-        pending_filled_volume_ = 0.0;
-        pending_cost_sum_      = 0.0;
-        pending_last_price_    = 0.0;
-
-        // req 8: intrabar 스냅샷 — close만 있고 지표는 미준비
-        // → SignalRecord 기록 시 rsi/volatility/trend_strength = nullopt (DB NULL 자동)
-        Snapshot intrabar_snap{};
-        intrabar_snap.close = intrabar_close;
-        // rsi.ready=false, volatility.ready=false, trendReady=false (기본값)
-        signal_snapshot_ = intrabar_snap;
-
-        // req 6: InPosition → PendingExit 전이 (중복 청산 방지)
-        state_               = State::PendingExit;
-        pending_client_id_   = cid;
-        pending_exit_reason_ = reason_tag;
-
-        return Decision::submit(std::move(req));
-    }
-
-    // “부분체결 대응 필요”
-    void RsiMeanReversionStrategy::onFill(const FillEvent& fill)
-    {
-        // 1) “내가 낸 pending 주문”인지 확인
-        if (!pending_client_id_.has_value())
-            return;
-
-        if (fill.identifier != *pending_client_id_)
-            return;
-
-        // 2) 부분/복수 체결 누적
-        // - FillEvent는 여러 번 올 수 있고, 이것만으로 완전 체결을 보장하지 않음
-        // - 따라서 여기서는 "누적만" 하고, pending 해제/상태 확정은 onOrderUpdate(Filled)에서 수행한다.
-        pending_last_price_ = fill.fill_price;
-
-        // 일부 WS 구현/환경에서는 filled_volume이 0으로 올 수 있어 방어적으로 처리
-        if (fill.filled_volume > 0.0) {
-            pending_filled_volume_ += fill.filled_volume;
-            pending_cost_sum_ += (fill.fill_price * fill.filled_volume);
-        }
-    }
-
-    void RsiMeanReversionStrategy::onOrderUpdate(const OrderStatusEvent& ev)
-    {
-        if (!pending_client_id_.has_value())
-            return;
-
-        if (ev.identifier != *pending_client_id_)
-            return;
-
-        const bool is_terminal =
-            ev.status == core::OrderStatus::Filled  ||
-            ev.status == core::OrderStatus::Canceled ||
-            ev.status == core::OrderStatus::Rejected;
-        if (!is_terminal)
-            return;
-
-        const auto clearPendingState = [this]() {
-            pending_client_id_.reset();
-            pending_exit_reason_.clear();
-            pending_filled_volume_ = 0.0;
-            pending_cost_sum_      = 0.0;
-            pending_last_price_    = 0.0;
-        };
-
-        const core::PositionEffect effect = ev.position_effect;
-
-        // None - 순수 체결 없이 주문 취소
-        if (effect == core::PositionEffect::None)
-        {
-            state_ = (state_ == State::PendingEntry) ? State::Flat : State::InPosition;
-            clearPendingState();
-            return;
-        }
-
-        // 체결가/수량: WS 누적 VWAP → REST 폴백 → 마지막 체결가
-        const double final_price = (pending_filled_volume_ > 0.0)
-            ? (pending_cost_sum_ / pending_filled_volume_)
-            : (ev.executed_volume > 0.0 && ev.executed_funds > 0.0
-                ? ev.executed_funds / ev.executed_volume
-                : pending_last_price_);
-        const double filled_volume =
-            pending_filled_volume_ > 0.0 ? pending_filled_volume_ : ev.executed_volume;
-
-        if (state_ == State::PendingEntry && effect == core::PositionEffect::Opened)
-        {
-            if (final_price > 0.0)
-            {
-                entry_price_ = final_price;
-                setStopsFromEntry(*entry_price_);
-                logEntryConfirmed_(ev.status == core::OrderStatus::Filled
-                    ? "filled" : "cancel_after_trade", *entry_price_);
-            }
-            else
-            {
-                util::Logger::instance().warn(
-                    "[Strategy][EntryConfirmed] reason=cancel_after_trade market=", market_,
-                    " entry_price_unavailable");
-            }
-            state_ = State::InPosition;
-
-            if (signal_callback_ && entry_price_.has_value()) {
-                trading::SignalRecord sig;
-                sig.market       = market_;
-                sig.identifier   = *pending_client_id_;
-                sig.side         = trading::SignalSide::BUY;
-                sig.price        = *entry_price_;
-                sig.volume       = filled_volume;
-                sig.krw_amount   = pending_cost_sum_ > 0.0 ? pending_cost_sum_ : ev.executed_funds;
-                sig.stop_price   = stop_price_;
-                sig.target_price = target_price_;
-                sig.rsi            = signal_snapshot_.rsi.ready       ? std::optional<double>(signal_snapshot_.rsi.v)        : std::nullopt;
-                sig.volatility     = signal_snapshot_.volatility.ready ? std::optional<double>(signal_snapshot_.volatility.v) : std::nullopt;
-                sig.trend_strength = signal_snapshot_.trendReady       ? std::optional<double>(signal_snapshot_.trendStrength) : std::nullopt;
-                sig.is_partial   = 0;
-                sig.ts_ms        = nowMs();
-                signal_callback_(sig);
-            }
-        }
-        else if (state_ == State::PendingExit && effect == core::PositionEffect::Reduced)
-        {
-            // 부분 청산(is_partial=1)
-            if (signal_callback_ && filled_volume > 0.0) {
-                trading::SignalRecord sig;
-                sig.market      = market_;
-                sig.identifier  = *pending_client_id_;
-                sig.side        = trading::SignalSide::SELL;
-                sig.price       = final_price;
-                sig.volume      = filled_volume;
-                sig.krw_amount  = pending_cost_sum_ > 0.0 ? pending_cost_sum_ : ev.executed_funds;
-                sig.rsi            = signal_snapshot_.rsi.ready       ? std::optional<double>(signal_snapshot_.rsi.v)        : std::nullopt;
-                sig.volatility     = signal_snapshot_.volatility.ready ? std::optional<double>(signal_snapshot_.volatility.v) : std::nullopt;
-                sig.trend_strength = signal_snapshot_.trendReady       ? std::optional<double>(signal_snapshot_.trendStrength) : std::nullopt;
-                sig.is_partial  = 1;
-                sig.exit_reason = pending_exit_reason_;
-                sig.ts_ms       = nowMs();
-                signal_callback_(sig);
-            }
-            // 수량 추적은 계좌 스냅샷에 맡기고 InPosition 유지
-            state_ = State::InPosition;
-        }
-        else if (state_ == State::PendingExit && effect == core::PositionEffect::Closed)
-        {
-            // 완전 청산(is_partial=0): Filled/Canceled 공통 경로
-            if (signal_callback_ && final_price > 0.0) {
-                trading::SignalRecord sig;
-                sig.market      = market_;
-                sig.identifier  = *pending_client_id_;
-                sig.side        = trading::SignalSide::SELL;
-                sig.price       = final_price;
-                sig.volume      = filled_volume;
-                sig.krw_amount  = pending_cost_sum_ > 0.0 ? pending_cost_sum_ : ev.executed_funds;
-                sig.rsi            = signal_snapshot_.rsi.ready       ? std::optional<double>(signal_snapshot_.rsi.v)        : std::nullopt;
-                sig.volatility     = signal_snapshot_.volatility.ready ? std::optional<double>(signal_snapshot_.volatility.v) : std::nullopt;
-                sig.trend_strength = signal_snapshot_.trendReady       ? std::optional<double>(signal_snapshot_.trendStrength) : std::nullopt;
-                sig.is_partial  = 0;
-                sig.exit_reason = pending_exit_reason_;
-                sig.ts_ms       = nowMs();
-                signal_callback_(sig);
-            }
-            state_ = State::Flat;
-            entry_price_.reset();
-            stop_price_.reset();
-            target_price_.reset();
-        }
-        else
-        {
-            // 예상치 못한 state/effect 조합 → 보수적 롤백
-            util::Logger::instance().warn(
-                "[Strategy][OrderUpdate] unexpected state/effect market=", market_,
-                " effect=", static_cast<int>(effect));
-            state_ = (state_ == State::PendingEntry) ? State::Flat : State::InPosition;
-        }
-
-        clearPendingState();
-    }
-
-    void RsiMeanReversionStrategy::onSubmitFailed()
-    {
-        // 엔진 submit(=주문 POST)이 실패하면 WS 이벤트가 절대 오지 않는다.
-        // 따라서 Pending 상태가 영원히 풀리지 않도록, 여기서 즉시 롤백한다.
-        //
-        // 정책(최소 변경):
-        // - PendingEntry: Flat으로 복귀
-        // - PendingExit : InPosition으로 복귀
-        // - 부분 체결은 "submit 실패" 케이스에서는 발생하지 않는다고 가정(POST 자체가 실패)
-
-        if (!pending_client_id_.has_value())
-            return;
-
-        if (state_ == State::PendingEntry)
-        {
-            state_ = State::Flat;
-        }
-        else if (state_ == State::PendingExit)
-        {
-            state_ = State::InPosition;
-        }
-
-        // pending 누적값 정리(안전)
-        pending_client_id_.reset();
-        pending_exit_reason_.clear();
-        pending_filled_volume_ = 0.0;
-        pending_cost_sum_ = 0.0;
-        pending_last_price_ = 0.0;
-    }
-
-
-    void RsiMeanReversionStrategy::setStopsFromEntry(double entry)
-    {
-        // 손절/익절 %는 “진입가 기준 퍼센트”
-        const double sl = std::max(0.0, params_.stopLossPct);
-        const double tp = std::max(0.0, params_.profitTargetPct);
-
-        stop_price_ = entry * (1.0 - sl / 100.0);
-        target_price_ = entry * (1.0 + tp / 100.0);
-    }
-
-    void RsiMeanReversionStrategy::logEntryConfirmed_(std::string_view reason, double entry)
-    {
-        // entry 확정 시점에만 호출하는 로깅 헬퍼
-        // stop/target은 setStopsFromEntry()가 먼저 호출되어 값이 세팅되어 있어야 함
-        const double stop = stop_price_.value_or(0.0);
-        const double target = target_price_.value_or(0.0);
-
-        util::Logger::instance().info("[Strategy][EntryConfirmed] reason=", reason,
-            " market=", market_,
-            " entry=", entry,
-            " stop=", stop,
-            " target=", target,
-            " (SL%=", params_.stopLossPct, ", TP%=", params_.profitTargetPct, ")");
-    }
-
-    std::string RsiMeanReversionStrategy::makeIdentifier(std::string_view tag)
-    {
-        // 전략 내부 유니크 ID (demo/real 공통: client_order_id로 매칭)
-        // 예: "rsi_mean_reversion:KRW-BTC:entry:1"
-        ++seq_;
-
-        std::string cid;
-        cid.reserve(128);
-
-        cid.append(id());
-        cid.push_back(':');
-        cid.append(market_);
-        cid.push_back(':');
-        cid.append(tag);
-        cid.push_back(':');
-        cid.append(makeUuidV4());
-
-        return cid;
-    }
-
-    core::OrderRequest RsiMeanReversionStrategy::makeMarketBuyByAmount(double krw_amount, std::string_view tag)
-    {
-        core::OrderRequest req{};
-        req.market = market_;
-        req.position = core::OrderPosition::BID;
-        req.type = core::OrderType::Market;
-
-        // BID(매수)는 “금액(Amount)” 기준이 자연스러움
-        req.size = core::AmountSize{ krw_amount };
-
-        req.price.reset(); // 시장가
-        req.strategy_id = std::string(id());
-        req.client_tag = std::string(tag);
-
-        // client_order_id는 바깥에서 생성해 주입(상태 전이와 맞물리기 때문)
-        req.identifier.clear();
-        return req;
-    }
-
-    core::OrderRequest RsiMeanReversionStrategy::makeMarketSellByVolume(double volume, std::string_view tag)
-    {
-        core::OrderRequest req{};
-        req.market = market_;
-        req.position = core::OrderPosition::ASK;
-        req.type = core::OrderType::Market;
-
-        // ASK(매도)는 “수량(Volume)” 기준이 자연스러움
-        req.size = core::VolumeSize{ volume };
-
-        req.price.reset(); // 시장가
-        req.strategy_id = std::string(id());
-        req.client_tag = std::string(tag);
-
-        req.identifier.clear();
-        return req;
+        return position_.submitExit(sellVol, reason_tag, s);
     }
 
 } // namespace trading::strategies
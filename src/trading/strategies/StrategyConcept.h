@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <string>
+
+#include "core/domain/Candle.h"
+#include "marketdata/PriceSeries.h"
+#include "StrategyTypes.h"
+
+namespace trading::strategies {
+
+    /*
+        MarketStrategy - StrategySet에 등록할 수 있는 전략의 정적 인터페이스
+        - 가상 함수 대신 컨셉으로 요구 사항을 검사 → 호출은 전부 컴파일 타임에 결정 (인라인 가능)
+        - 생성: S(market, S::Params, const PriceSeries&) → 봉 시계열은 공유, push는 StrategySet만
+        - onCandle / onWarmUpCandle 호출 시점에 인자 봉은 이미 series의 최신 봉
+        - kId: client_order_id prefix ("<kId>:<market>:...") → 마켓 안에서 전략끼리 겹치면 안 됨
+        - 상태는 공통 StrategyState (상태 버스/로그가 전략 종류와 무관하게 읽음)
+    */
+    template <typename S>
+    concept MarketStrategy =
+        requires {
+            typename S::Params;
+            { S::kId } -> std::convertible_to<StrategyId>;
+            { S::kSeriesLookback } -> std::convertible_to<std::size_t>;
+        } &&
+        std::constructible_from<S, std::string, typename S::Params, const marketdata::PriceSeries&> &&
+        requires(S& s, const S& cs, const core::Candle& c, const AccountSnapshot& account, double price,
+                 const FillEvent& fill, const OrderStatusEvent& ev, const PositionSnapshot& pos,
+                 SignalHandler fn) {
+            { cs.market() } -> std::convertible_to<const std::string&>;
+            { cs.state() } -> std::same_as<StrategyState>;
+            { cs.entryPrice() } -> std::convertible_to<double>;
+            { cs.stopPrice() } -> std::convertible_to<double>;
+            { cs.targetPrice() } -> std::convertible_to<double>;
+            { cs.signalSnapshot() } -> std::convertible_to<const Snapshot&>;
+
+            { s.onCandle(c, account) } -> std::same_as<Decision>;
+            { s.onIntrabarCandle(price, account) } -> std::same_as<Decision>;
+            s.onWarmUpCandle(c);
+            s.onFill(fill);
+            s.onOrderUpdate(ev);
+            s.onSubmitFailed();
+            s.syncOnStart(pos);
+            s.setSignalCallback(fn);
+            s.reset();
+        };
+
+} // namespace trading::strategies
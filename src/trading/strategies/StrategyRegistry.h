@@ -0,0 +1,14 @@
+﻿#pragma once
+
+#include "RsiMeanReversionStrategy.h"
+#include "StrategySet.h"
+
+namespace trading::strategies {
+
+    // 마켓마다 함께 돌릴 전략 (컴파일 타임 등록)
+    // - 앞쪽일수록 진입 우선순위가 높고, 첫 번째 전략이 시작 시 보유 포지션을 인수
+    // - 전략 추가: MarketStrategy 컨셉을 만족하는 클래스를 만들고 여기에 타입만 추가
+    // - BreakoutStrategy는 설정/백테스트 검증 전이라 미등록 (2전략 조합은 bench/StrategyBench.cpp에서만 측정)
+    using MarketStrategies = StrategySet<RsiMeanReversionStrategy>;
+
+} // namespace trading::strategies
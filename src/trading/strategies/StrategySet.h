@@ -0,0 +1,317 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/domain/Candle.h"
+#include "marketdata/PriceSeries.h"
+#include "StrategyConcept.h"
+#include "StrategyTypes.h"
+#include "util/Logger.h"
+
+namespace trading::strategies {
+
+    /*
+        StrategySet - 마켓 1개에서 함께 도는 전략 묶음 (컴파일 타임 레지스트리 + 주문 중재)
+
+        예) StrategySet<RsiMeanReversionStrategy, BreakoutStrategy>
+
+        - 전략은 std::tuple에 값으로 보관, 모든 호출은 fold expression → 가상 호출 없음
+        - 공유 입력: 확정 봉은 여기서 dedup 후 PriceSeries에 1번만 push, 전략들은 같은 시계열을 조회
+        - 중재 (마켓당 포지션/미체결 1개):
+            * owner = 처음으로 Flat이 아닌 전략 (없으면 없음)
+            * owner가 있으면 owner만 실제 계좌를 보고, 나머지는 빈 계좌로 지표만 갱신
+            * owner가 없으면 등록 순서대로 KRW를 보여 주고, 먼저 진입(또는 보유 인수)한 전략이 owner
+              → 뒤 전략은 같은 봉에서 빈 계좌 (앞 전략일수록 우선순위 높음)
+            * 주인 없는 보유 코인(재시작/외부 거래)은 첫 번째 전략만 인수 (syncOnStart 포함)
+        - 주문 이벤트: identifier "<kId>:" prefix로 낸 전략에만 전달
+        - 외부(매니저)에는 전략 1개처럼 보이는 API: state/entry/stop/target은 owner 기준 (없으면 Flat/0)
+
+        스레드: 소유 워커 스레드 전용
+    */
+    template <MarketStrategy... Strategies>
+    class StrategySet final
+    {
+        static_assert(sizeof...(Strategies) > 0, "StrategySet: at least one strategy required");
+
+        static constexpr std::array<StrategyId, sizeof...(Strategies)> kIds{ Strategies::kId... };
+
+        static constexpr bool uniqueIds_() noexcept
+        {
+            for (std::size_t i = 0; i < kIds.size(); ++i)
+                for (std::size_t j = i + 1; j < kIds.size(); ++j)
+                    if (kIds[i] == kIds[j]) return false;
+            return true;
+        }
+        static_assert(uniqueIds_(), "StrategySet: duplicate strategy id");
+
+    public:
+        using State = trading::StrategyState;
+        using Params = std::tuple<typename Strategies::Params...>;
+
+        static constexpr std::size_t kSize = sizeof...(Strategies);
+        static constexpr std::size_t kNone = kSize;
+
+        // 주입할 PriceSeries의 최소 용량 (전략 중 최댓값)
+        static constexpr std::size_t kSeriesLookback = std::max({ Strategies::kSeriesLookback... });
+
+        // series: 마켓 컨텍스트 소유 (이 객체보다 오래 살아야 함)
+        // @throws std::invalid_argument series 용량 < kSeriesLookback (각 전략 생성자)
+        StrategySet(std::string market, const Params& params, marketdata::PriceSeries& series)
+            : StrategySet(std::move(market), params, series, std::index_sequence_for<Strategies...>{})
+        {
+        }
+
+        [[nodiscard]] const std::string& market() const noexcept { return market_; }
+
+        // 등록 순서의 전략 id
+        [[nodiscard]] static constexpr const auto& ids() noexcept { return kIds; }
+
+        // 봇 주문 prefix ("<kId>:<market>:") 전부, 시작 시 미체결 취소용
+        // 전략 id만 쓰므로 인스턴스 없이도 계산 가능 (엔진 생성 전 취소 경로)
+        [[nodiscard]] static std::vector<std::string> identifierPrefixes(std::string_view market)
+        {
+            std::vector<std::string> out;
+            out.reserve(kSize);
+            for (const StrategyId id : kIds) {
+                std::string prefix(id);
+                prefix.append(":").append(market).append(":");
+                out.push_back(std::move(prefix));
+            }
+            return out;
+        }
+
+        // 포지션/미체결을 가진 전략 인덱스 (없으면 kNone)
+        [[nodiscard]] std::size_t owner() const noexcept
+        {
+            std::size_t o = kNone;
+            forEach_(strategies_, [&o](std::size_t i, const auto& s) {
+                if (o == kNone && s.state() != State::Flat) o = i;
+            });
+            return o;
+        }
+
+        [[nodiscard]] State state() const noexcept
+        {
+            State st = State::Flat;
+            visit_(owner(), [&st](const auto& s) { st = s.state(); });
+            return st;
+        }
+
+        [[nodiscard]] double entryPrice() const noexcept
+        {
+            double v = 0.0;
+            visit_(owner(), [&v](const auto& s) { v = s.entryPrice(); });
+            return v;
+        }
+
+        [[nodiscard]] double stopPrice() const noexcept
+        {
+            double v = 0.0;
+            visit_(owner(), [&v](const auto& s) { v = s.stopPrice(); });
+            return v;
+        }
+
+        [[nodiscard]] double targetPrice() const noexcept
+        {
+            double v = 0.0;
+            visit_(owner(), [&v](const auto& s) { v = s.targetPrice(); });
+            return v;
+        }
+
+        // 마지막으로 주문 의도를 낸 전략의 신호 스냅샷 (아직 없으면 첫 번째 전략)
+        [[nodiscard]] const Snapshot& signalSnapshot() const noexcept
+        {
+            const Snapshot* snap = nullptr;
+            visit_(last_signal_, [&snap](const auto& s) { snap = &s.signalSnapshot(); });
+            return *snap;
+        }
+
+        // 확정 봉 1개: dedup → series push → 전략마다 onCandle (중재 규칙대로 계좌 노출)
+        // @return 이번 봉에서 나온 주문 의도 (마켓당 최대 1개)
+        [[nodiscard]] Decision onCandle(const core::Candle& c, const AccountSnapshot& account)
+        {
+            // market 고정이므로 다른 market 봉이 들어오면 아무것도 하지 않음
+            if (c.market != market_)
+                return Decision::noAction();
+
+            // 같은 ts(같은 1분 캔들 업데이트)가 반복되면 지표에 누적하지 않음
+            if (last_candle_ts_.has_value() && *last_candle_ts_ == c.start_timestamp)
+            {
+                COINBOT_LOG_DEBUG("[Strategy][Dedup] same candle ts ignored.", util::kv("market", c.market),
+                    util::kv("ts", c.start_timestamp), util::kv("close", static_cast<double>(c.close_price)));
+                return Decision::noAction();
+            }
+            last_candle_ts_ = c.start_timestamp;
+
+            series_.push(c);
+
+            std::size_t own = owner();
+            Decision out = Decision::noAction();
+
+            forEach_(strategies_, [&](std::size_t i, auto& s) {
+                AccountSnapshot view{};
+                if (own == i)
+                {
+                    view = account;
+                }
+                else if (own == kNone)
+                {
+                    view.krw_available = account.krw_available;
+                    if (i == 0) view.coin_available = account.coin_available;
+                }
+
+                Decision d = s.onCandle(c, view);
+
+                if (own == kNone && s.state() != State::Flat)
+                    own = i;
+                if (d.hasOrder())
+                {
+                    last_signal_ = i;
+                    out = std::move(d);
+                }
+            });
+            return out;
+        }
+
+        // intrabar 손절/익절은 포지션을 가진 전략만 평가
+        [[nodiscard]] Decision onIntrabarCandle(double intrabar_close, const AccountSnapshot& account)
+        {
+            Decision out = Decision::noAction();
+            const std::size_t own = owner();
+            visit_(own, [&](auto& s) { out = s.onIntrabarCandle(intrabar_close, account); });
+            if (out.hasOrder())
+                last_signal_ = own;
+            return out;
+        }
+
+        void onFill(const FillEvent& fill)
+        {
+            visit_(ownerOf_(fill.identifier), [&fill](auto& s) { s.onFill(fill); });
+        }
+
+        void onOrderUpdate(const trading::OrderStatusEvent& ev)
+        {
+            visit_(ownerOf_(ev.identifier), [&ev](auto& s) { s.onOrderUpdate(ev); });
+        }
+
+        // submit 실패는 방금 주문을 낸 전략 = owner (마켓당 미체결 1개)
+        void onSubmitFailed()
+        {
+            visit_(owner(), [](auto& s) { s.onSubmitFailed(); });
+        }
+
+        // 보유 포지션은 첫 번째 전략이 인수, 나머지는 Flat으로 시작
+        void syncOnStart(const trading::PositionSnapshot& pos)
+        {
+            forEach_(strategies_, [&pos](std::size_t i, auto& s) {
+                s.syncOnStart(i == 0 ? pos : trading::PositionSnapshot{});
+            });
+        }
+
+        // 과거 확정 봉으로 지표만 채움 (주문 의도/상태 전이 없음, 런타임 마켓 추가 시 warm-start)
+        // history: 오래된 순, 이미 반영한 ts 이하의 봉은 건너뜀
+        // @return 지표에 반영한 봉 수
+        std::size_t warmUp(const std::vector<core::Candle>& history)
+        {
+            std::size_t applied = 0;
+            for (const auto& c : history)
+            {
+                if (c.market != market_)
+                    continue;
+
+                // ts는 KST ISO 문자열 → 사전순 = 시간순
+                if (last_candle_ts_.has_value() && c.start_timestamp <= *last_candle_ts_)
+                    continue;
+                last_candle_ts_ = c.start_timestamp;
+
+                series_.push(c);
+                forEach_(strategies_, [&c](std::size_t, auto& s) { s.onWarmUpCandle(c); });
+                ++applied;
+            }
+            return applied;
+        }
+
+        // 모든 전략에 같은 콜백 등록 (SignalRecord.identifier로 전략 구분 가능)
+        void setSignalCallback(const trading::SignalHandler& fn)
+        {
+            forEach_(strategies_, [&fn](std::size_t, auto& s) { s.setSignalCallback(fn); });
+        }
+
+        void reset()
+        {
+            series_.clear();
+            last_candle_ts_.reset();
+            last_signal_ = 0;
+            forEach_(strategies_, [](std::size_t, auto& s) { s.reset(); });
+        }
+
+        template <std::size_t I>
+        [[nodiscard]] auto& get() noexcept { return std::get<I>(strategies_); }
+        template <std::size_t I>
+        [[nodiscard]] const auto& get() const noexcept { return std::get<I>(strategies_); }
+
+    private:
+        template <std::size_t... I>
+        StrategySet(std::string market, const Params& params, marketdata::PriceSeries& series,
+                    std::index_sequence<I...>)
+            : market_(std::move(market)),
+              series_(series),
+              strategies_(Strategies(market_, std::get<I>(params), series)...)
+        {
+        }
+
+        // f(index, strategy) 를 등록 순서대로 호출
+        template <typename Tuple, typename F>
+        static void forEach_(Tuple& t, F&& f)
+        {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (f(I, std::get<I>(t)), ...);
+            }(std::index_sequence_for<Strategies...>{});
+        }
+
+        // index 전략 1개에만 f 호출 (kNone이면 no-op)
+        template <typename F>
+        void visit_(std::size_t index, F&& f)
+        {
+            forEach_(strategies_, [&](std::size_t i, auto& s) { if (i == index) f(s); });
+        }
+
+        template <typename F>
+        void visit_(std::size_t index, F&& f) const
+        {
+            forEach_(strategies_, [&](std::size_t i, const auto& s) { if (i == index) f(s); });
+        }
+
+        // identifier "<kId>:..." → 전략 인덱스 (봇 주문이 아니면 kNone)
+        [[nodiscard]] static std::size_t ownerOf_(std::string_view identifier) noexcept
+        {
+            for (std::size_t i = 0; i < kIds.size(); ++i)
+            {
+                const StrategyId id = kIds[i];
+                if (identifier.size() > id.size() && identifier.starts_with(id) && identifier[id.size()] == ':')
+                    return i;
+            }
+            return kNone;
+        }
+
+    private:
+        std::string market_;
+        marketdata::PriceSeries& series_;
+        std::tuple<Strategies...> strategies_;
+
+        std::size_t last_signal_{ 0 };
+
+        // 같은 1분 캔들이 여러 번(업데이트 형태로) 들어오는 경우 중복 누적 방지용
+        std::optional<std::string> last_candle_ts_{};
+    };
+
+} // namespace trading::strategies
@@ -35,6 +35,15 @@ namespace trading {
         [[nodiscard]] constexpr bool hasPosition() const noexcept { return coin > 0.0; }
     };
 
+    // 전략 포지션 상태 (모든 전략 공통, 상태 버스 strategy_state 값과 동일)
+    //   Flat(미보유) -> PendingEntry(매수 주문 대기) -> InPosition(보유) -> PendingExit(매도 주문 대기) -> Flat
+    enum class StrategyState : std::uint8_t {
+        Flat = 0,
+        PendingEntry = 1,
+        InPosition = 2,
+        PendingExit = 3
+    };
+
     // 체결 이벤트(전략이 entryPrice 확정 / pending 해제에 사용)
     // 이 체결이 내가 낸 주문인지? 진입인지? 청산인지? / 이제 다음 캔들에서 어떤 판단을 해야 하는지 ? )
     // - identifier로 전략이 "내가 낸 주문"인지 매칭
@@ -162,6 +171,8 @@ namespace trading {
         std::optional<double> trend_strength{};// 신호 발생 시 추세 강도
         int is_partial{ 0 };                  // 0: 완전청산, 1: 부분청산(SELL만)
         std::string exit_reason{};            // SELL 청산 사유 ("exit_stop" / "exit_target" / "exit_rsi_overbought" / "exit_unknown"), BUY는 빈 문자열
+        std::optional<double> expected_price{};         // 제출 전 호가 기반 예상 VWAP (호가 구독 시)
+        std::optional<double> expected_slippage_bps{};  // 제출 전 예상 슬리피지 (최우선 호가 대비)
         int64_t ts_ms{ 0 };
     };
 
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -30,6 +31,15 @@ namespace util
         // trade_fee 필드 누락 시 fallback으로 사용 (리스크 3 대응)
         // Upbit 표준 수수료: 0.05% (Maker/Taker 동일)
         double default_trade_fee_rate = 0.0005; // 0.05%
+
+        // 시장가 주문 사전 슬리피지 추정 (호가 구독 시에만 동작, 북이 없거나 오래되면 추정 없이 제출)
+        // max_slippage_bps > 0이면 최우선 호가 대비 예상 슬리피지가 이를 넘을 때
+        // - slippage_clip = true: 예산 안에서 체결 가능한 최대 크기로 줄여 제출 (최소 주문 금액 미만이면 매수는 거부)
+        // - slippage_clip = false: 매수는 거부
+        // 매도(청산)는 거부하지 않음: 줄일 수 있으면 줄이고, 아니면 원래 크기로 제출
+        double max_slippage_bps = 0.0;
+        bool slippage_clip = true;
+        std::int64_t max_book_age_ms = 2000;    // 이보다 오래된 호가 스냅샷은 추정에 쓰지 않음
     };
 
     // 이벤트 브릿지 설정
@@ -43,6 +53,9 @@ namespace util
     {
         std::chrono::seconds idle_timeout{1};   // 유휴 타임아웃
         int max_reconnect_attempts = 5;         // 재연결 최대 시도
+
+        // 채널별 대기 연결(핸드셰이크 완료 상태로 유지) → 주 연결 장애 시 backoff/재접속 없이 즉시 승격
+        bool warm_standby = true;
     };
 
     // 자산 관리 설정 (AccountManager)
@@ -53,6 +66,62 @@ namespace util
 
         // 코인 가치 기준 dust. StrategyConfig::min_notional_krw와 동일하게 유지해야 함.
         double init_dust_threshold_krw = 5000.0;
+
+        // 동시 운용 마켓 상한 (런타임 추가 포함, 예산 slot 수 = max(시작 마켓 수, 이 값))
+        std::size_t max_markets = 32;
+    };
+
+    // 거래소 REST 호출 설정 (SharedOrderApi)
+    struct RestConfig
+    {
+        // 동시 REST 호출 상한 (시작 시 마켓별 복구 fan-out 병렬도와 동일하게 사용)
+        std::size_t max_in_flight = 4;
+
+        // 요청 시작 간 최소 간격: Upbit Exchange API 초당 30회 제한 아래로 유지 (40ms = 25회/s)
+        std::chrono::milliseconds min_request_interval{40};
+
+        // 주문 생성/취소 시작 간 최소 간격: Upbit 주문 그룹 초당 8회 제한 (125ms = 8회/s)
+        // - 위 전체 간격과 별도로 적용 (조회 호출은 이 간격에 묶이지 않음)
+        std::chrono::milliseconds min_order_interval{125};
+    };
+
+    // 계측 설정 (지연 히스토그램 등)
+    struct MetricsConfig
+    {
+        // 마켓별 단계 지연(p50/p99/p999/max) 주기 리포트 간격, 0이면 종료 시에만 출력
+        std::chrono::seconds latency_report_interval{60};
+
+        // Prometheus /metrics 로컬 HTTP 서버 (port 0이면 비활성)
+        std::string http_bind_address = "127.0.0.1";
+        unsigned short http_port = 9464;
+    };
+
+    // 라이브 상태 버스 (POSIX 공유 메모리, 대시보드/외부 reader용)
+    struct StateBusConfig
+    {
+        // shm_open 이름 (Linux: /dev/shm/coinbot_state), 비우면 비활성
+        std::string shm_name = "/coinbot_state";
+        std::size_t market_capacity = 64;
+
+        // 이벤트가 없을 때도 큐/잔고를 갱신하는 최소 발행 주기 (워커별)
+        std::chrono::milliseconds idle_publish_interval{1000};
+    };
+
+    // 마켓 유니버스 스캐너 (app::MarketScanner)
+    // 활성화 시 상위 N개 선택이 운용 마켓 목록을 대체 (마켓 구성 파일 감시는 비활성)
+    struct ScannerConfig
+    {
+        bool enabled = false;                           // 환경 변수 UPBIT_SCANNER_TOP_N(>0)으로도 활성화
+        std::chrono::seconds interval{60};              // 시세 스캔 주기
+        std::chrono::minutes universe_refresh{60};      // 마켓 목록 재조회 주기 (상장/유의 지정 반영)
+        std::size_t batch_size = 100;                   // /v1/ticker 1회 조회 마켓 수
+        std::string quote_prefix = "KRW-";              // 대상 마켓 접두어
+
+        std::size_t top_n = 5;                          // 선택 마켓 수 (AccountConfig::max_markets 이하)
+        std::size_t retain_rank = 10;                   // 기존 선택은 이 순위 안이면 유지 (교체 빈도 억제)
+        double volatility_weight = 0.3;                 // 점수 = (1-w)·거래대금 백분위 + w·변동성 백분위
+        double min_turnover_krw_24h = 1e9;              // 24h 거래대금 하한 (미만은 후보 제외)
+        bool exclude_warning = true;                    // 유의 종목 제외
     };
 
     // 봇 운영 설정 (거래 마켓 목록 등)
@@ -67,6 +136,31 @@ namespace util
         // 기본값 15를 유지해 배치 수집/대시보드의 기존 기준과 맞춘다.
         int live_candle_unit_minutes = 15;
 
+        // live 분봉 스트림에서 마켓별로 만들어 DB에 기록할 상위 단위 (분)
+        // live 단위의 배수가 아니거나 live 이하인 단위는 무시 (live=1이면 전부 생성)
+        std::vector<int> resample_units_minutes = { 3, 5, 15, 30, 60, 240 };
+
+        // 전략이 소비할 분봉 단위 (0 = live 단위)
+        // live와 다르면 resample_units_minutes로 만든 봉을 사용 (예: live=1, strategy=15 → 1분봉 구독 하나로 15분봉 전략)
+        int strategy_candle_unit_minutes = 0;
+
+        // 체결(trade) 스트림 추가 구독: 체결마다 로컬 봉 집계 + intrabar 손절/익절 체크
+        // 환경 변수 UPBIT_TRADE_STREAM=1 로 활성화 가능
+        bool trade_stream = false;
+
+        // 호가(orderbook) 구독 단 수 (1/5/15/30), 0이면 비활성
+        // 마켓별 L2 북(스프레드/중간가/깊이 금액)을 유지해 주문 사이징·대시보드에 사용
+        // 환경 변수 UPBIT_ORDERBOOK_LEVELS 로 덮어쓰기 가능
+        int orderbook_levels = 0;
+
+        // 런타임 마켓 구성 파일 (줄/쉼표 구분, '#' 주석), 비우면 비활성
+        // 환경 변수 UPBIT_MARKETS_FILE 로 재정의 가능. 파일이 바뀌면 마켓 추가/제거(drain)를 반영
+        std::string markets_file;
+        std::chrono::seconds markets_file_poll_interval{5};
+
+        // 런타임 추가 마켓의 지표 warm-start용 과거 분봉 수 (Upbit 분봉 조회 최대 200)
+        int warmup_candles = 200;
+
         // SQLite DB 파일 경로 (실행 파일과 동일 디렉토리 기준 상대 경로)
         // EC2: systemd WorkingDirectory=/home/ubuntu/coinbot 설정 시 해당 위치에 생성
         std::string db_path = "db/coinbot.db";
@@ -81,6 +175,10 @@ namespace util
         EventBridgeConfig event_bridge;
         WebSocketConfig websocket;
         AccountConfig account;
+        RestConfig rest;
+        MetricsConfig metrics;
+        StateBusConfig state_bus;
+        ScannerConfig scanner;
 
         // 싱글톤 접근
         static AppConfig& instance()
@@ -0,0 +1,157 @@
+// util/LatencyHistogram.h
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace util
+{
+    // 단조 시계 기준 현재 시각(ns) - 단계 간 지연 측정용 (벽시계 보정 영향 없음)
+    inline std::int64_t monoNowNs() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // 백분위 요약 (단위: ns)
+    struct LatencySummary
+    {
+        std::uint64_t count{ 0 };
+        std::uint64_t p50{ 0 };
+        std::uint64_t p99{ 0 };
+        std::uint64_t p999{ 0 };
+        std::uint64_t max{ 0 };
+    };
+
+    /*
+     * LatencyHistogram - HDR 방식(log-linear) 지연 히스토그램
+     *
+     * - 2의 거듭제곱 구간마다 16개 하위 버킷 → 상대 오차 약 6% 이내
+     * - 범위: 0 ~ 2^40 ns (약 18분), 초과 값은 마지막 버킷으로 클램프
+     * - record(): 단일 writer 전제 (마켓 워커 스레드 1개 또는 외부 mutex로 직렬화된 호출),
+     *             락/RMW 없이 relaxed load+store
+     * - snapshot(): 어느 스레드에서나 호출 가능, 근사값(기록 중인 값 1~2개 차이 허용)
+     * - 여러 히스토그램은 Snapshot::merge로 합산 (마켓 전체 합계 등)
+     */
+    class LatencyHistogram final
+    {
+    public:
+        static constexpr int kSubBits = 5;                                   // 하위 버킷 정밀도
+        static constexpr std::uint64_t kHalf = std::uint64_t{ 1 } << (kSubBits - 1); // 16
+        static constexpr int kMaxExp = 40 - kSubBits;                        // 최대 지수 구간 (msb 39)
+        static constexpr std::size_t kBucketCount = static_cast<std::size_t>((kMaxExp + 2) * kHalf);
+        static constexpr std::uint64_t kMaxTrackable = (std::uint64_t{ 1 } << 40) - 1;
+
+        // 합산/백분위 계산용 복사본
+        struct Snapshot
+        {
+            std::array<std::uint64_t, kBucketCount> buckets{};
+            std::uint64_t count{ 0 };
+            std::uint64_t sum{ 0 };
+            std::uint64_t max{ 0 };
+
+            void merge(const Snapshot& other) noexcept
+            {
+                for (std::size_t i = 0; i < kBucketCount; ++i)
+                    buckets[i] += other.buckets[i];
+                count += other.count;
+                sum += other.sum;
+                max = std::max(max, other.max);
+            }
+
+            // q: 0~1 분위수. 해당 버킷의 상한값 반환 (max로 상한 제한)
+            std::uint64_t percentile(double q) const noexcept
+            {
+                if (count == 0) return 0;
+
+                const auto target = static_cast<std::uint64_t>(
+                    q * static_cast<double>(count) + 0.5);
+                const std::uint64_t rank = std::max<std::uint64_t>(1, std::min(target, count));
+
+                std::uint64_t seen = 0;
+                for (std::size_t i = 0; i < kBucketCount; ++i)
+                {
+                    seen += buckets[i];
+                    if (seen >= rank)
+                        return std::min(bucketUpper(i), max);
+                }
+                return max;
+            }
+
+            LatencySummary summary() const noexcept
+            {
+                return LatencySummary{ count, percentile(0.50), percentile(0.99), percentile(0.999), max };
+            }
+        };
+
+        LatencyHistogram() = default;
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        // 지연 1건 기록 (ns). 음수(시계 역전/미설정)는 무시
+        void record(std::int64_t ns) noexcept
+        {
+            if (ns < 0) return;
+
+            const auto v = std::min(static_cast<std::uint64_t>(ns), kMaxTrackable);
+            auto& b = buckets_[bucketIndex(v)];
+            b.store(b.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            sum_.store(sum_.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+            if (v > max_.load(std::memory_order_relaxed))
+                max_.store(v, std::memory_order_relaxed);
+        }
+
+        // [start_ns, monoNowNs()] 구간 기록 헬퍼
+        void recordSince(std::int64_t start_ns) noexcept
+        {
+            if (start_ns > 0)
+                record(monoNowNs() - start_ns);
+        }
+
+        Snapshot snapshot() const noexcept
+        {
+            Snapshot s;
+            for (std::size_t i = 0; i < kBucketCount; ++i)
+                s.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            s.count = count_.load(std::memory_order_relaxed);
+            s.sum = sum_.load(std::memory_order_relaxed);
+            s.max = max_.load(std::memory_order_relaxed);
+            return s;
+        }
+
+        // 값 → 버킷 인덱스
+        // v < 32: 선형(1ns 단위), 이후 지수 e마다 16개 하위 버킷: idx = e*16 + (v >> e)
+        static constexpr std::size_t bucketIndex(std::uint64_t v) noexcept
+        {
+            if (v < 2 * kHalf)
+                return static_cast<std::size_t>(v);
+
+            const int msb = 63 - std::countl_zero(v);
+            const int e = msb - kSubBits + 1;
+            return static_cast<std::size_t>(e) * kHalf + static_cast<std::size_t>(v >> e);
+        }
+
+        // 버킷 인덱스 → 해당 버킷의 최대값
+        static constexpr std::uint64_t bucketUpper(std::size_t idx) noexcept
+        {
+            if (idx < 2 * kHalf)
+                return idx;
+
+            const std::size_t e = idx / kHalf - 1;
+            const std::uint64_t sub = idx - e * kHalf;
+            return ((sub + 1) << e) - 1;
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_{};
+        std::atomic<std::uint64_t> count_{ 0 };
+        std::atomic<std::uint64_t> sum_{ 0 };
+        std::atomic<std::uint64_t> max_{ 0 };
+    };
+}
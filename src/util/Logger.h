@@ -1,15 +1,27 @@
 ﻿#pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <fstream>
-#include <iomanip>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <sstream>
+#include <stop_token>
 #include <string>
 #include <string_view>
-#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace util
 {
@@ -22,19 +34,171 @@ namespace util
         LV_ERROR = 3
     };
 
+    namespace detail
+    {
+        // 바이너리 레코드의 인자 태그 (호출 스레드는 값만 복사, 문자열화는 writer 스레드에서)
+        enum class LogArgTag : std::uint8_t
+        {
+            Bool = 0,
+            Char = 1,
+            I64 = 2,
+            U64 = 3,
+            F64 = 4,
+            Str = 5,
+            Key = 6     // 구조화 필드 키 (다음 인자가 값)
+        };
+
+        // 레코드 헤더 (레코드 앞부분에 memcpy로 기록)
+        struct LogRecordHeader
+        {
+            std::uint64_t seq{ 0 };
+            std::int64_t  ts_ns{ 0 };   // system_clock epoch ns (포맷은 writer가 수행)
+            LogLevel      level{ LogLevel::INFO };
+        };
+
+        // 레코드 최대 크기: 초과하는 문자열 인자는 잘라서 기록한다
+        inline constexpr std::size_t kMaxLogRecordBytes = 4096;
+
+        /*
+         * LogStagingRing - 스레드별 SPSC 바이트 링
+         *
+         * - producer: 로그를 호출한 스레드 1개 (thread_local로 소유)
+         * - consumer: Logger writer 스레드 1개
+         * - [u32 길이][레코드 바이트] 형태로 연속 기록, 끝에 닿으면 앞으로 감아서 복사
+         * - 가득 차면 기록하지 않고 dropped_만 증가 (호출 스레드는 절대 대기하지 않음)
+         */
+        class LogStagingRing final
+        {
+        public:
+            static constexpr std::size_t kCapacity = std::size_t{ 1 } << 20; // 1MB (2의 거듭제곱)
+
+            // producer 전용
+            bool tryWrite(const char* rec, std::size_t n) noexcept
+            {
+                const std::uint64_t need = sizeof(std::uint32_t) + n;
+                const std::uint64_t head = head_.load(std::memory_order_relaxed);
+
+                // tail 캐시로 consumer 캐시라인 접근을 줄인다
+                if (kCapacity - (head - cached_tail_) < need)
+                {
+                    cached_tail_ = tail_.load(std::memory_order_acquire);
+                    if (kCapacity - (head - cached_tail_) < need)
+                    {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+                }
+
+                const auto len = static_cast<std::uint32_t>(n);
+                copyIn_(head, reinterpret_cast<const char*>(&len), sizeof(len));
+                copyIn_(head + sizeof(len), rec, n);
+                head_.store(head + need, std::memory_order_release);
+                return true;
+            }
+
+            // consumer 전용: 쌓인 레코드를 모두 꺼내 fn(data, size) 호출
+            template <typename Fn>
+            std::size_t drain(std::string& scratch, Fn&& fn)
+            {
+                std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+                const std::uint64_t head = head_.load(std::memory_order_acquire);
+
+                std::size_t count = 0;
+                while (tail < head)
+                {
+                    std::uint32_t len = 0;
+                    copyOut_(tail, reinterpret_cast<char*>(&len), sizeof(len));
+                    scratch.resize(len);
+                    copyOut_(tail + sizeof(len), scratch.data(), len);
+                    tail += sizeof(len) + len;
+
+                    fn(scratch.data(), scratch.size());
+                    ++count;
+                }
+
+                tail_.store(tail, std::memory_order_release);
+                return count;
+            }
+
+            bool empty() const noexcept
+            {
+                return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+            }
+
+            std::uint64_t takeDropped() noexcept { return dropped_.exchange(0, std::memory_order_relaxed); }
+
+            // 소유 스레드 종료 표시 (남은 레코드는 writer가 비운 뒤 제거)
+            void retire() noexcept { retired_.store(true, std::memory_order_release); }
+            bool retired() const noexcept { return retired_.load(std::memory_order_acquire); }
+
+        private:
+            void copyIn_(std::uint64_t pos, const char* src, std::size_t n) noexcept
+            {
+                const std::size_t off = static_cast<std::size_t>(pos & (kCapacity - 1));
+                const std::size_t first = std::min(n, kCapacity - off);
+                std::memcpy(buf_.data() + off, src, first);
+                if (first < n)
+                    std::memcpy(buf_.data(), src + first, n - first);
+            }
+
+            void copyOut_(std::uint64_t pos, char* dst, std::size_t n) const noexcept
+            {
+                const std::size_t off = static_cast<std::size_t>(pos & (kCapacity - 1));
+                const std::size_t first = std::min(n, kCapacity - off);
+                std::memcpy(dst, buf_.data() + off, first);
+                if (first < n)
+                    std::memcpy(dst + first, buf_.data(), n - first);
+            }
+
+        private:
+            alignas(64) std::atomic<std::uint64_t> head_{ 0 };   // producer가 갱신
+            std::uint64_t cached_tail_{ 0 };                     // producer 전용 캐시
+            alignas(64) std::atomic<std::uint64_t> tail_{ 0 };   // consumer가 갱신
+            alignas(64) std::atomic<std::uint64_t> dropped_{ 0 };
+            std::atomic<bool> retired_{ false };
+            std::array<char, kCapacity> buf_{};
+        };
+    }
+
+    // 구조화 필드: 출력 시 " key=value" 형태로 붙는다 (문자열 이어붙이기 대신 사용)
+    // - 값은 참조로만 들고 있으므로 로그 호출 식 안에서만 사용할 것
+    template <typename T>
+    struct LogField
+    {
+        std::string_view key;
+        const T& value;
+    };
+
+    template <typename T>
+    LogField<T> kv(std::string_view key, const T& value) noexcept
+    {
+        return LogField<T>{ key, value };
+    }
+
+    template <typename T>
+    struct IsLogField : std::false_type {};
+
+    template <typename T>
+    struct IsLogField<LogField<T>> : std::true_type {};
+
     /*
-     * Logger - 구조화된 로깅 유틸리티
+     * Logger - 비동기 로깅 유틸리티
      *
      * 특징:
-     * - 타임스탬프 자동 추가
-     * - 로그 레벨 필터링
-     * - 콘솔 + 파일 동시 출력
-     * - 스레드 안전성
+     * - 호출 스레드: 레벨 확인 → 인자를 바이너리 레코드로 스레드별 링에 복사 (락/할당/IO 없음)
+     * - writer 스레드: 타임스탬프 포맷, 문자열 조합, 콘솔/파일 일괄 쓰기
+     * - 출력 순서는 전역 seq 기준으로 정렬 (스레드가 달라도 [#seq] 순서 유지)
+     * - WARN 이상은 writer를 즉시 깨우고 쓰기 후 flush
+     * - 링이 가득 차면 레코드를 버리고 개수만 집계 (호출 스레드는 블로킹하지 않음)
      *
      * 사용 예시:
      *   Logger::instance().info("Server started");
      *   Logger::instance().warn("High CPU usage: ", cpu_percent);
      *   Logger::instance().error("Failed to connect: ", error_msg);
+     *   Logger::instance().flush();   // std::terminate 직전 등 동기 출력이 필요할 때
+     *
+     * 핫패스는 아래 COINBOT_LOG_* 매크로 사용 (비활성 레벨은 인자를 평가하지 않음):
+     *   COINBOT_LOG_DEBUG("[WS] RX", util::kv("bytes", msg.size()));
      */
     class Logger final
     {
@@ -46,17 +210,28 @@ namespace util
             return logger;
         }
 
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        ~Logger()
+        {
+            // writer가 남은 레코드를 모두 비운 뒤 종료
+            writer_.request_stop();
+            wake_cv_.notify_one();
+            if (writer_.joinable())
+                writer_.join();
+        }
+
         // 로그 레벨 설정
         void setLevel(LogLevel level)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            min_level_ = level;
+            min_level_.store(level, std::memory_order_relaxed);
         }
 
         // 파일 출력 활성화(현재는 x)
         void enableFileOutput(const std::string& filename)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            std::lock_guard<std::mutex> lock(io_mutex_);
             file_stream_.open(filename, std::ios::app);
             if (!file_stream_.is_open())
             {
@@ -67,10 +242,44 @@ namespace util
         // 콘솔 출력 비활성화
         void disableConsoleOutput()
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            std::lock_guard<std::mutex> lock(io_mutex_);
             console_enabled_ = false;
         }
 
+        // 지금까지 기록된 레코드가 출력될 때까지 대기 (std::terminate 직전 등)
+        // writer 종료가 요청된 뒤면 기다리지 않음 (정적 소멸 중 terminate 경로에서 무한 대기 방지)
+        void flush()
+        {
+            if (writer_.get_stop_token().stop_requested())
+                return;
+
+            const std::uint64_t gen = flush_req_.fetch_add(1, std::memory_order_acq_rel) + 1;
+            wake_.store(true, std::memory_order_release);
+            wake_cv_.notify_one();
+
+            std::unique_lock<std::mutex> lk(flush_mtx_);
+            flush_cv_.wait(lk, [&] { return flush_done_ >= gen || writer_done_; });
+        }
+
+        // 레벨 활성 여부 (COINBOT_LOG_* 매크로가 인자 평가 전에 호출)
+        bool enabled(LogLevel level) const noexcept
+        {
+            return level >= min_level_.load(std::memory_order_relaxed);
+        }
+
+        // 레벨 확인을 마친 호출 전용 (COINBOT_LOG_* 매크로에서 사용)
+        template <typename... Args>
+        void write(LogLevel level, Args&&... args)
+        {
+            record_(level, std::forward<Args>(args)...);
+        }
+
+        // 링 포화로 버려진 레코드 누계
+        std::uint64_t droppedCount() const noexcept
+        {
+            return dropped_total_.load(std::memory_order_relaxed);
+        }
+
         // 로그 메서드
         template <typename... Args>
         void debug(Args&&... args)
@@ -98,7 +307,32 @@ namespace util
 
 
     private:
-        Logger() = default;
+        // writer가 깨어나는 최대 주기 (INFO 이하는 이 주기로 일괄 출력)
+        static constexpr std::chrono::milliseconds kFlushInterval{ 2 };
+
+        // 스레드별 상태: 링 + 인코딩 스크래치 버퍼 (스레드 종료 시 링을 retire)
+        struct ThreadSlot
+        {
+            std::shared_ptr<detail::LogStagingRing> ring;
+            std::string scratch;
+
+            ~ThreadSlot()
+            {
+                if (ring) ring->retire();
+            }
+        };
+
+        // writer가 정렬용으로 보관하는 포맷 완료 라인
+        struct FormattedLine
+        {
+            std::uint64_t seq{ 0 };
+            std::string text;
+        };
+
+        Logger()
+            : writer_([this](std::stop_token st) { writerLoop_(st); })
+        {
+        }
 
         // 로그 레벨 문자열 변환
         static constexpr std::string_view levelToString(LogLevel level)
@@ -113,79 +347,454 @@ namespace util
             return "UNKNOWN";
         }
 
-        // 타임스탬프 생성
-        static std::string getTimestamp()
+        // ---------- producer (호출 스레드) ----------
+
+        ThreadSlot& localSlot_()
         {
-            auto now = std::chrono::system_clock::now();
-            auto time_t_now = std::chrono::system_clock::to_time_t(now);
-            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now.time_since_epoch()) % 1000;
+            thread_local ThreadSlot slot;
+            if (!slot.ring)
+            {
+                // 스레드당 최초 1회만 등록 (이후 호출은 락 없음)
+                slot.ring = std::make_shared<detail::LogStagingRing>();
+                slot.scratch.reserve(detail::kMaxLogRecordBytes);
 
-            std::tm tm_buf{};
-#ifdef _WIN32
-            localtime_s(&tm_buf, &time_t_now);
-#else
-            localtime_r(&time_t_now, &tm_buf);
-#endif
+                std::lock_guard<std::mutex> lk(rings_mutex_);
+                rings_.push_back(slot.ring);
+            }
+            return slot;
+        }
+
+        template <typename T>
+        static void appendPod_(std::string& out, const T& v)
+        {
+            out.append(reinterpret_cast<const char*>(&v), sizeof(T));
+        }
+
+        static void encodeStr_(std::string& out, std::string_view s)
+        {
+            // 레코드 최대 크기를 넘지 않도록 잘라서 기록
+            const std::size_t overhead = 1 + sizeof(std::uint32_t);
+            const std::size_t budget = (out.size() + overhead < detail::kMaxLogRecordBytes)
+                ? detail::kMaxLogRecordBytes - out.size() - overhead
+                : 0;
+            const auto len = static_cast<std::uint32_t>(std::min(s.size(), budget));
 
-            std::ostringstream oss;
-            oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S")
-                << '.' << std::setfill('0') << std::setw(3) << ms.count();
-            return oss.str();
+            out.push_back(static_cast<char>(detail::LogArgTag::Str));
+            appendPod_(out, len);
+            out.append(s.data(), len);
+        }
+
+        // 인자 1개를 태그 + 값으로 인코딩 (문자열 변환은 writer에서)
+        template <typename T>
+        static void encodeArg_(std::string& out, const T& v)
+        {
+            using D = std::decay_t<T>;
+
+            if constexpr (IsLogField<D>::value)
+            {
+                const auto len = static_cast<std::uint32_t>(
+                    std::min<std::size_t>(v.key.size(), 255));
+                out.push_back(static_cast<char>(detail::LogArgTag::Key));
+                appendPod_(out, len);
+                out.append(v.key.data(), len);
+                encodeArg_(out, v.value);
+            }
+            else if constexpr (std::is_same_v<D, bool>)
+            {
+                out.push_back(static_cast<char>(detail::LogArgTag::Bool));
+                out.push_back(v ? 1 : 0);
+            }
+            else if constexpr (std::is_same_v<D, char> || std::is_same_v<D, signed char>
+                || std::is_same_v<D, unsigned char>)
+            {
+                out.push_back(static_cast<char>(detail::LogArgTag::Char));
+                out.push_back(static_cast<char>(v));
+            }
+            else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>)
+            {
+                out.push_back(static_cast<char>(detail::LogArgTag::I64));
+                appendPod_(out, static_cast<std::int64_t>(v));
+            }
+            else if constexpr (std::is_integral_v<D>)
+            {
+                out.push_back(static_cast<char>(detail::LogArgTag::U64));
+                appendPod_(out, static_cast<std::uint64_t>(v));
+            }
+            else if constexpr (std::is_floating_point_v<D>)
+            {
+                out.push_back(static_cast<char>(detail::LogArgTag::F64));
+                appendPod_(out, static_cast<double>(v));
+            }
+            else if constexpr (std::is_array_v<std::remove_reference_t<T>>)
+            {
+                encodeStr_(out, std::string_view(v));   // 문자열 리터럴
+            }
+            else if constexpr (std::is_same_v<D, const char*> || std::is_same_v<D, char*>)
+            {
+                encodeStr_(out, v ? std::string_view(v) : std::string_view("(null)"));
+            }
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            {
+                encodeStr_(out, std::string_view(v));
+            }
+            else
+            {
+                // 드문 타입(스트림 연산자만 있는 타입)은 호출 스레드에서 문자열화
+                std::ostringstream oss;
+                oss << v;
+                encodeStr_(out, oss.str());
+            }
         }
 
-        // 실제 로그 출력
+        // 레벨 필터링 후 기록
         template <typename... Args>
         void log(LogLevel level, Args&&... args)
         {
-            // 레벨 필터링
-            if (level < min_level_)
+            if (!enabled(level))
                 return;
+            record_(level, std::forward<Args>(args)...);
+        }
+
+        // 실제 로그 기록 (호출 스레드: 링에 복사만)
+        template <typename... Args>
+        void record_(LogLevel level, Args&&... args)
+        {
+            detail::LogRecordHeader hdr;
+            hdr.seq = seq_.fetch_add(1, std::memory_order_relaxed) + 1;
+            hdr.ts_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            hdr.level = level;
+
+            ThreadSlot& slot = localSlot_();
+            std::string& rec = slot.scratch;
+            rec.clear();
+            appendPod_(rec, hdr);
+            (encodeArg_(rec, args), ...);
+
+            slot.ring->tryWrite(rec.data(), rec.size());
+
+            // WARN 이상은 writer를 즉시 깨운다 (나머지는 kFlushInterval 주기로 출력)
+            if (level >= LogLevel::WARN)
+            {
+                wake_.store(true, std::memory_order_release);
+                wake_cv_.notify_one();
+            }
+        }
+
+        // ---------- consumer (writer 스레드) ----------
+
+        // 타임스탬프 생성 (초 단위 문자열은 캐시해서 localtime 호출을 초당 1회로 제한)
+        void appendTimestamp_(std::string& out, std::int64_t ts_ns)
+        {
+            const std::int64_t ms_total = ts_ns / 1'000'000;
+            const std::time_t sec = static_cast<std::time_t>(ms_total / 1000);
+            const int ms = static_cast<int>(ms_total % 1000);
+
+            if (sec != cached_sec_ || cached_sec_text_.empty())
+            {
+                std::tm tm_buf{};
+#ifdef _WIN32
+                localtime_s(&tm_buf, &sec);
+#else
+                localtime_r(&sec, &tm_buf);
+#endif
+                char buf[32];
+                const std::size_t n = std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm_buf);
+                cached_sec_text_.assign(buf, n);
+                cached_sec_ = sec;
+            }
+
+            out.append(cached_sec_text_);
+            char msbuf[8];
+            const int n = std::snprintf(msbuf, sizeof(msbuf), ".%03d", ms);
+            out.append(msbuf, static_cast<std::size_t>(std::max(n, 0)));
+        }
+
+        template <typename T>
+        static T readPod_(const char*& p)
+        {
+            T v;
+            std::memcpy(&v, p, sizeof(T));
+            p += sizeof(T);
+            return v;
+        }
+
+        template <typename Int>
+        static void appendInt_(std::string& out, Int v)
+        {
+            char buf[24];
+            const auto res = std::to_chars(buf, buf + sizeof(buf), v);
+            out.append(buf, res.ptr);
+        }
+
+        // 바이너리 레코드 → "[ts] [LEVEL] [#seq] msg\n"
+        void formatRecord_(const char* data, std::size_t size, FormattedLine& line, bool& has_warn)
+        {
+            const char* p = data;
+            const char* end = data + size;
+            const auto hdr = readPod_<detail::LogRecordHeader>(p);
+
+            std::string& out = line.text;
+            out.clear();
+            line.seq = hdr.seq;
+            if (hdr.level >= LogLevel::WARN)
+                has_warn = true;
+
+            out.push_back('[');
+            appendTimestamp_(out, hdr.ts_ns);
+            out.append("] [");
+            out.append(levelToString(hdr.level));
+            out.append("] [#");
+            appendInt_(out, hdr.seq);
+            out.append("] ");
+
+            while (p < end)
+            {
+                const auto tag = static_cast<detail::LogArgTag>(*p++);
+                switch (tag)
+                {
+                case detail::LogArgTag::Bool:
+                    out.push_back(*p++ ? '1' : '0');   // ostream 기본(noboolalpha) 출력과 동일
+                    break;
+                case detail::LogArgTag::Char:
+                    out.push_back(*p++);
+                    break;
+                case detail::LogArgTag::I64:
+                    appendInt_(out, readPod_<std::int64_t>(p));
+                    break;
+                case detail::LogArgTag::U64:
+                    appendInt_(out, readPod_<std::uint64_t>(p));
+                    break;
+                case detail::LogArgTag::F64:
+                {
+                    // ostream 기본 포맷(%g, precision 6)과 동일
+                    char buf[32];
+                    const int n = std::snprintf(buf, sizeof(buf), "%g", readPod_<double>(p));
+                    out.append(buf, static_cast<std::size_t>(std::max(n, 0)));
+                    break;
+                }
+                case detail::LogArgTag::Str:
+                {
+                    const auto len = readPod_<std::uint32_t>(p);
+                    out.append(p, len);
+                    p += len;
+                    break;
+                }
+                case detail::LogArgTag::Key:
+                {
+                    // 구조화 필드: 앞 텍스트와 공백 1칸으로 구분
+                    const auto len = readPod_<std::uint32_t>(p);
+                    if (out.back() != ' ')
+                        out.push_back(' ');
+                    out.append(p, len);
+                    out.push_back('=');
+                    p += len;
+                    break;
+                }
+                default:
+                    p = end;   // 손상된 레코드: 나머지 무시
+                    break;
+                }
+            }
+            out.push_back('\n');
+        }
+
+        // 모든 링을 비우고 seq 순으로 정렬해 한 번에 출력
+        void drainOnce_()
+        {
+            std::size_t used = 0;
+            bool has_warn = false;
+            std::uint64_t dropped = 0;
+
+            {
+                std::lock_guard<std::mutex> lk(rings_mutex_);
+                for (auto it = rings_.begin(); it != rings_.end();)
+                {
+                    auto& ring = **it;
+                    // retired 판단을 drain 앞에서 해야 종료 직전 기록도 놓치지 않는다
+                    const bool retired = ring.retired();
+
+                    ring.drain(record_scratch_, [&](const char* data, std::size_t size) {
+                        if (used == lines_.size())
+                            lines_.emplace_back();
+                        formatRecord_(data, size, lines_[used++], has_warn);
+                    });
+                    dropped += ring.takeDropped();
 
-            const std::uint64_t seq = seq_.fetch_add(1, std::memory_order_relaxed) + 1;
+                    if (retired && ring.empty())
+                        it = rings_.erase(it);
+                    else
+                        ++it;
+                }
+            }
+
+            if (dropped > 0)
+            {
+                dropped_total_.fetch_add(dropped, std::memory_order_relaxed);
+                if (used == lines_.size())
+                    lines_.emplace_back();
+                FormattedLine& line = lines_[used++];
+                line.seq = seq_.load(std::memory_order_relaxed);
+                line.text = "[Logger] staging ring full, dropped " + std::to_string(dropped) + " records\n";
+                has_warn = true;
+            }
+
+            if (used == 0)
+                return;
 
-            std::lock_guard<std::mutex> lock(mutex_);
+            // 스레드 간 순서를 전역 seq 기준으로 맞춘다
+            std::sort(lines_.begin(), lines_.begin() + static_cast<std::ptrdiff_t>(used),
+                [](const FormattedLine& a, const FormattedLine& b) { return a.seq < b.seq; });
 
-			// 메시지 조합 (받은 인자를 순서대로 이어붙임)
-            std::ostringstream oss; // 메모지 문자열 버퍼에 사용
-            oss << "[" << getTimestamp() << "] "
-                << "[" << levelToString(level) << "] "
-                << "[#" << seq << "] ";
-            (oss << ... << args);
-            oss << "\n";
+            out_buf_.clear();
+            for (std::size_t i = 0; i < used; ++i)
+                out_buf_.append(lines_[i].text);
 
-            // std::ostringstream(oss 버퍼)에 쌓아 둔 내용을 std::string으로 꺼낸다. 재사용 용도
-            const std::string message = oss.str();
+            std::lock_guard<std::mutex> lock(io_mutex_);
 
             // 콘솔 출력
             if (console_enabled_)
             {
-                if (level >= LogLevel::WARN)
-                    std::cout << message << std::flush;
-                else
-                    std::cout << message;
+                std::cout.write(out_buf_.data(), static_cast<std::streamsize>(out_buf_.size()));
+                if (has_warn)
+                    std::cout.flush();
             }
 
             // 파일 출력
             if (file_stream_.is_open())
             {
-                if (level >= LogLevel::WARN)
-                    file_stream_ << message << std::flush;
-                else
-                    file_stream_ << message;
+                file_stream_.write(out_buf_.data(), static_cast<std::streamsize>(out_buf_.size()));
+                if (has_warn)
+                    file_stream_.flush();
+            }
+        }
+
+        void writerLoop_(std::stop_token st)
+        {
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lk(wake_mtx_);
+                    wake_cv_.wait_for(lk, kFlushInterval, [&] {
+                        return wake_.load(std::memory_order_acquire) || st.stop_requested();
+                    });
+                    wake_.store(false, std::memory_order_relaxed);
+                }
+
+                // drain 시작 전에 요청 세대를 읽어야 flush() 이전 레코드가 포함됨을 보장
+                const std::uint64_t req = flush_req_.load(std::memory_order_acquire);
+                const bool stopping = st.stop_requested();
+
+                drainOnce_();
+
+                if (req > 0)
+                {
+                    {
+                        std::lock_guard<std::mutex> lk(flush_mtx_);
+                        flush_done_ = req;
+                    }
+                    flush_cv_.notify_all();
+                }
+
+                if (stopping)
+                    break;
+            }
+
+            // 종료와 경합한 flush() 대기자도 깨움
+            {
+                std::lock_guard<std::mutex> lk(flush_mtx_);
+                writer_done_ = true;
             }
+            flush_cv_.notify_all();
 
+            std::lock_guard<std::mutex> lock(io_mutex_);
+            std::cout.flush();
+            if (file_stream_.is_open())
+                file_stream_.flush();
         }
 
     private:
-        std::mutex mutex_;
-        std::atomic<std::uint64_t> seq_{ 0 };
-        LogLevel min_level_{ LogLevel::INFO };
+        // 출력 설정/스트림 (writer 스레드와 설정 함수만 접근)
+        std::mutex io_mutex_;
         bool console_enabled_{ true };
         std::ofstream file_stream_;
+
+        std::atomic<std::uint64_t> seq_{ 0 };
+        std::atomic<LogLevel> min_level_{ LogLevel::INFO };
+        std::atomic<std::uint64_t> dropped_total_{ 0 };
+
+        // 스레드별 링 목록 (등록은 스레드당 1회)
+        std::mutex rings_mutex_;
+        std::vector<std::shared_ptr<detail::LogStagingRing>> rings_;
+
+        // writer 깨우기
+        std::mutex wake_mtx_;
+        std::condition_variable wake_cv_;
+        std::atomic<bool> wake_{ false };
+
+        // flush() 동기화
+        std::atomic<std::uint64_t> flush_req_{ 0 };
+        std::mutex flush_mtx_;
+        std::condition_variable flush_cv_;
+        std::uint64_t flush_done_{ 0 };
+        bool writer_done_{ false };     // writer 루프 종료 (flush_mtx_ 보호)
+
+        // writer 전용 재사용 버퍼
+        std::string record_scratch_;
+        std::vector<FormattedLine> lines_;
+        std::string out_buf_;
+        std::time_t cached_sec_{ 0 };
+        std::string cached_sec_text_;
+
+        // 마지막에 선언: 다른 멤버가 모두 초기화된 뒤 writer 시작
+        std::jthread writer_;
     };
 
     // 전역 로거 접근 헬퍼
     inline Logger& log() { return Logger::instance(); }
 
 } // namespace util
+
+// ---------- 로그 매크로 ----------
+//
+// COINBOT_LOG_MIN_LEVEL: 컴파일 타임 최소 레벨 (0=DEBUG, 1=INFO, 2=WARN, 3=ERROR)
+// - 이보다 낮은 레벨의 매크로는 호출부 코드 자체가 생성되지 않는다 (Release 기본값 1)
+// - 남은 레벨은 원자 변수 1회 로드로 런타임 레벨을 확인한 뒤에만 인자를 평가한다
+#ifndef COINBOT_LOG_MIN_LEVEL
+#define COINBOT_LOG_MIN_LEVEL 0
+#endif
+
+#define COINBOT_LOG_AT_(level, ...)                                   \
+    do {                                                              \
+        auto& coinbot_logger_ = ::util::Logger::instance();           \
+        if (coinbot_logger_.enabled(level))                           \
+            coinbot_logger_.write(level, __VA_ARGS__);                \
+    } while (0)
+
+// 컴파일 제외 레벨: 인자는 타입 검사만 하고 평가/코드 생성은 하지 않는다 (unused 경고 방지)
+#define COINBOT_LOG_OFF_(level, ...)                                  \
+    do {                                                              \
+        if constexpr (false)                                          \
+            COINBOT_LOG_AT_(level, __VA_ARGS__);                      \
+    } while (0)
+
+#if COINBOT_LOG_MIN_LEVEL <= 0
+#define COINBOT_LOG_DEBUG(...) COINBOT_LOG_AT_(::util::LogLevel::DEBUG, __VA_ARGS__)
+#else
+#define COINBOT_LOG_DEBUG(...) COINBOT_LOG_OFF_(::util::LogLevel::DEBUG, __VA_ARGS__)
+#endif
+
+#if COINBOT_LOG_MIN_LEVEL <= 1
+#define COINBOT_LOG_INFO(...) COINBOT_LOG_AT_(::util::LogLevel::INFO, __VA_ARGS__)
+#else
+#define COINBOT_LOG_INFO(...) COINBOT_LOG_OFF_(::util::LogLevel::INFO, __VA_ARGS__)
+#endif
+
+#if COINBOT_LOG_MIN_LEVEL <= 2
+#define COINBOT_LOG_WARN(...) COINBOT_LOG_AT_(::util::LogLevel::WARN, __VA_ARGS__)
+#else
+#define COINBOT_LOG_WARN(...) COINBOT_LOG_OFF_(::util::LogLevel::WARN, __VA_ARGS__)
+#endif
+
+// ERROR는 컴파일 타임에 제거하지 않는다
+#define COINBOT_LOG_ERROR(...) COINBOT_LOG_AT_(::util::LogLevel::LV_ERROR, __VA_ARGS__)
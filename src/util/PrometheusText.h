@@ -0,0 +1,125 @@
+// util/PrometheusText.h
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "util/LatencyHistogram.h"
+
+namespace util
+{
+    /*
+     * PrometheusText - Prometheus text exposition format(0.0.4) 작성기
+     *
+     * - family(): # HELP / # TYPE 헤더 1회 출력 (같은 이름의 샘플 앞에 호출)
+     * - sample(): name{label="value",...} value 한 줄 출력
+     * - summary(): LatencyHistogram 스냅샷을 quantile/sum/count(초 단위)로 출력
+     * - 레이블 값의 \ " 개행은 규격대로 이스케이프
+     */
+    class PrometheusText final
+    {
+    public:
+        using Label = std::pair<std::string_view, std::string_view>;
+
+        void family(std::string_view name, std::string_view type, std::string_view help)
+        {
+            out_.append("# HELP ").append(name).append(" ").append(help).append("\n");
+            out_.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+        }
+
+        void sample(std::string_view name, std::initializer_list<Label> labels, double value)
+        {
+            writeName_(name, labels);
+            appendNumber_(value);
+        }
+
+        void sample(std::string_view name, std::initializer_list<Label> labels, std::uint64_t value)
+        {
+            writeName_(name, labels);
+            out_.append(std::to_string(value)).append("\n");
+        }
+
+        // ns 단위 히스토그램 → 초 단위 summary 샘플 (quantile 0.5/0.99/0.999 + _sum + _count)
+        void summary(std::string_view name, std::initializer_list<Label> labels,
+            const LatencyHistogram::Snapshot& snap)
+        {
+            static constexpr std::pair<const char*, double> kQuantiles[] = {
+                { "0.5", 0.50 }, { "0.99", 0.99 }, { "0.999", 0.999 }
+            };
+
+            for (const auto& [qs, q] : kQuantiles)
+            {
+                writeName_(name, labels, Label{ "quantile", qs });
+                appendNumber_(nsToSec_(snap.percentile(q)));
+            }
+
+            std::string n(name);
+            writeName_(n + "_sum", labels);
+            appendNumber_(nsToSec_(snap.sum));
+            writeName_(n + "_count", labels);
+            out_.append(std::to_string(snap.count)).append("\n");
+        }
+
+        const std::string& str() const noexcept { return out_; }
+        std::string release() noexcept { return std::move(out_); }
+
+    private:
+        static double nsToSec_(std::uint64_t ns) noexcept
+        {
+            return static_cast<double>(ns) / 1e9;
+        }
+
+        void writeName_(std::string_view name, std::initializer_list<Label> labels,
+            std::optional<Label> extra = std::nullopt)
+        {
+            out_.append(name);
+            if (labels.size() == 0 && !extra)
+            {
+                out_.push_back(' ');
+                return;
+            }
+
+            out_.push_back('{');
+            bool first = true;
+            auto put = [&](const Label& l)
+            {
+                if (!first) out_.push_back(',');
+                first = false;
+                out_.append(l.first).append("=\"");
+                appendEscaped_(l.second);
+                out_.push_back('"');
+            };
+            for (const auto& l : labels) put(l);
+            if (extra) put(*extra);
+            out_.append("} ");
+        }
+
+        void appendEscaped_(std::string_view v)
+        {
+            for (const char c : v)
+            {
+                switch (c)
+                {
+                case '\\': out_.append("\\\\"); break;
+                case '"':  out_.append("\\\""); break;
+                case '\n': out_.append("\\n");  break;
+                default:   out_.push_back(c);   break;
+                }
+            }
+        }
+
+        void appendNumber_(double v)
+        {
+            char buf[32];
+            const int n = std::snprintf(buf, sizeof(buf), "%.9g", v);
+            out_.append(buf, n > 0 ? static_cast<std::size_t>(n) : 0).append("\n");
+        }
+
+        std::string out_;
+    };
+}
@@ -0,0 +1,92 @@
+// util/Rcu.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace util
+{
+    /*
+     * RcuDomain - 읽기 위주 공유 포인터 교체용 epoch 기반 RCU
+     *
+     * - 읽기: ReadGuard 구간 안에서 load한 포인터는 구간이 끝날 때까지 해제되지 않음
+     *         (빈 reader 슬롯 1개 CAS + 해제 store, 락/할당 없음)
+     * - 쓰기: 포인터를 새 객체로 교체(exchange)한 뒤 synchronize() →
+     *         교체 이전에 시작된 읽기 구간이 모두 끝나야 반환 → 이후 옛 객체 해제
+     * - 포인터 load/exchange는 seq_cst로 할 것 (슬롯 기록 ↔ 포인터 읽기 순서 보장)
+     * - reader 슬롯(kMaxReaders)이 모두 차면 빈 슬롯이 날 때까지 spin
+     *   (라우팅 스레드 수는 WS 클라이언트 수 수준 ≪ 슬롯 수)
+     * - synchronize() 호출끼리는 호출자가 직렬화 (writer mutex)
+     */
+    class RcuDomain
+    {
+    public:
+        static constexpr std::size_t kMaxReaders = 64;
+
+        RcuDomain() = default;
+        RcuDomain(const RcuDomain&) = delete;
+        RcuDomain& operator=(const RcuDomain&) = delete;
+
+        class ReadGuard
+        {
+        public:
+            explicit ReadGuard(RcuDomain& domain) noexcept
+                : slot_(domain.enter_())
+            {}
+
+            ~ReadGuard() { slot_->store(0, std::memory_order_release); }
+
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+        private:
+            std::atomic<std::uint64_t>* slot_;
+        };
+
+        // grace period: 호출 이전에 시작된 모든 읽기 구간이 끝날 때까지 대기
+        void synchronize() noexcept
+        {
+            const std::uint64_t target = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+            for (auto& r : readers_)
+            {
+                for (;;)
+                {
+                    const std::uint64_t e = r.epoch.load(std::memory_order_seq_cst);
+                    if (e == 0 || e >= target) break;   // 비어 있거나 교체 이후에 들어온 reader
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+    private:
+        std::atomic<std::uint64_t>* enter_() noexcept
+        {
+            // 스레드마다 시작 슬롯을 달리해 CAS 경합 분산
+            thread_local const std::size_t hint =
+                std::hash<std::thread::id>{}(std::this_thread::get_id()) % kMaxReaders;
+
+            const std::uint64_t e = epoch_.load(std::memory_order_seq_cst);
+            for (std::size_t i = hint;; i = (i + 1) % kMaxReaders)
+            {
+                std::uint64_t expected = 0;
+                if (readers_[i].epoch.compare_exchange_weak(expected, e,
+                        std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return &readers_[i].epoch;
+            }
+        }
+
+        // reader 슬롯: 0 = 비어 있음, 그 외 = 진입 시점 epoch
+        struct alignas(64) ReaderSlot
+        {
+            std::atomic<std::uint64_t> epoch{ 0 };
+        };
+
+        std::atomic<std::uint64_t> epoch_{ 1 };
+        std::array<ReaderSlot, kMaxReaders> readers_{};
+    };
+}
@@ -8,6 +8,8 @@ streamlit/app.py — CoinBot 대시보드
   Tab 2: 백테스트
     - candle_rsi_backtest 모듈로 시뮬레이션 결과 표시
     - 실거래 signals 오버레이 (옵션)
+  Tab 3: 라이브
+    - 봇이 공유 메모리 상태 버스에 발행하는 마켓별 현재 상태 (SQLite 미사용, 2초 주기 갱신)
 
 실행: streamlit run streamlit/app.py  (repo root 기준)
 
@@ -40,6 +42,13 @@ try:
 except ImportError:
     _backtest = None
 
+# 라이브 상태 버스 바인딩 (공유 라이브러리 미빌드 시 라이브 탭만 비활성)
+try:
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    import statebus as _statebus
+except ImportError:
+    _statebus = None
+
 KST = ZoneInfo("Asia/Seoul")
 DEFAULT_DB_PATH = os.path.join(_REPO_ROOT, "db", "coinbot.db")
 
@@ -971,6 +980,79 @@ def render_backtest(
                 st.info("거래 내역 없음.")
 
 
+# ─── 라이브 탭 ─────────────────────────────────────────────────────────────────
+
+@st.cache_resource
+def _open_state_bus(shm_name: str):
+    """상태 버스 핸들 (세션 간 공유). 봇 미실행 시 None."""
+    return _statebus.StateBus.open(shm_name) if _statebus else None
+
+
+def _render_live_table(shm_name: str) -> None:
+    bus = _open_state_bus(shm_name)
+    if bus is None:
+        _open_state_bus.clear()     # 봇이 나중에 뜨면 다음 갱신에서 다시 연결
+        st.info("상태 버스에 연결할 수 없음. 봇 실행 여부와 libcoinbot_statebus_reader.so 빌드를 확인하세요.")
+        return
+
+    info = bus.info()
+    # 봇 재시작 시 이전 세그먼트는 unlink됨 → heartbeat 정체면 새 세그먼트로 재연결
+    if info["heartbeat_age_s"] > 10 and bus.reopen():
+        info = bus.info()
+
+    rows = bus.read_all()
+    c1, c2, c3 = st.columns(3)
+    c1.metric("봇 PID", info["writer_pid"])
+    c2.metric("마지막 발행", f"{info['heartbeat_age_s']:.1f}초 전")
+    c3.metric("마켓 수", len(rows))
+
+    if not rows:
+        st.info("발행된 마켓 없음.")
+        return
+
+    now_ms = int(datetime.now(tz=KST).timestamp() * 1000)
+    df = pd.DataFrame([{
+        "마켓":        r.market,
+        "전략 상태":   r.strategy_state,
+        "캔들 시각":   r.candle_ts or "–",
+        "종가":        r.candle_close,
+        "RSI":         r.rsi,
+        "변동성":      r.volatility,
+        "시장 적합":   r.market_ok,
+        "스프레드(bps)": ((r.best_ask - r.best_bid) / ((r.best_ask + r.best_bid) / 2) * 1e4
+                          if r.best_bid and r.best_ask else None),
+        "매수 호가 KRW": r.bid_depth_krw,
+        "매도 호가 KRW": r.ask_depth_krw,
+        "가용 KRW":    r.available_krw,
+        "예약 KRW":    r.reserved_krw,
+        "보유 수량":   r.coin_balance,
+        "평단가":      r.avg_entry_price,
+        "실현 손익":   r.realized_pnl,
+        "큐 깊이":     r.queue_depth,
+        "큐 drop":     r.queue_dropped,
+        "갱신(초 전)": max(0.0, (now_ms - r.updated_at_ms) / 1000.0),
+    } for r in rows])
+
+    st.dataframe(
+        df.style.format({
+            "종가": "{:,.2f}", "RSI": "{:.1f}", "변동성": "{:.4f}",
+            "스프레드(bps)": "{:.1f}", "매수 호가 KRW": "{:,.0f}", "매도 호가 KRW": "{:,.0f}",
+            "가용 KRW": "{:,.0f}", "예약 KRW": "{:,.0f}", "보유 수량": "{:.8f}",
+            "평단가": "{:,.2f}", "실현 손익": "{:,.0f}", "갱신(초 전)": "{:.1f}",
+        }, na_rep="–"),
+        use_container_width=True, hide_index=True,
+    )
+
+
+def render_live(shm_name: str) -> None:
+    """라이브 탭: 상태 버스 폴링 (fragment 지원 시 탭만 2초 주기 재실행)."""
+    if hasattr(st, "fragment"):
+        st.fragment(run_every=2)(_render_live_table)(shm_name)
+    else:
+        st.button("새로고침", key="live_refresh")     # 클릭 시 스크립트 재실행
+        _render_live_table(shm_name)
+
+
 # ─── 메인 ─────────────────────────────────────────────────────────────────────
 
 def main() -> None:
@@ -984,6 +1066,8 @@ def main() -> None:
         today      = date.today()
         start_date = st.date_input("시작일",  value=today - timedelta(days=30))
         end_date   = st.date_input("종료일",  value=today)
+        st.divider()
+        shm_name = st.text_input("상태 버스 이름", value=_statebus.DEFAULT_SHM_NAME if _statebus else "/coinbot_state")
 
     if not os.path.exists(db_path):
         st.error(f"DB 파일 없음: `{db_path}`\n봇을 한 번 실행해 DB를 먼저 생성하세요.")
@@ -999,7 +1083,7 @@ def main() -> None:
 
     markets = load_markets(db_path)
 
-    tab_analysis, tab_backtest = st.tabs(["분석", "백테스트"])
+    tab_analysis, tab_backtest, tab_live = st.tabs(["분석", "백테스트", "라이브"])
 
     # [레이아웃 개선 #1] 분석 탭 내부를 P&L / 전략 분석 서브탭으로 분리
     with tab_analysis:
@@ -1014,6 +1098,9 @@ def main() -> None:
     with tab_backtest:
         render_backtest(db_path, markets, start_ts, end_ts)
 
+    with tab_live:
+        render_live(shm_name)
+
 
 if __name__ == "__main__":
     main()
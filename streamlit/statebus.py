@@ -0,0 +1,231 @@
+"""
+streamlit/statebus.py — 라이브 상태 버스 Python 바인딩 (ctypes)
+
+봇이 POSIX 공유 메모리(/dev/shm/coinbot_state)에 발행하는 마켓별 라이브 상태를
+libcoinbot_statebus_reader.so(src/statebus/StateBusCApi.cpp)를 통해 읽는다.
+SQLite를 거치지 않으므로 봇의 WAL 쓰기와 경합하지 않고, 값은 발행 즉시 보인다.
+
+라이브러리 탐색 순서:
+  1. 환경 변수 COINBOT_STATEBUS_LIB (파일 경로)
+  2. out/build/*/src/statebus/libcoinbot_statebus_reader.so (CMakePresets 빌드 위치)
+
+사용:
+    bus = StateBus.open()          # 봇 미실행/라이브러리 없음 → None
+    if bus:
+        for m in bus.read_all(): ...
+"""
+
+from __future__ import annotations
+
+import ctypes
+import glob
+import os
+import time
+from dataclasses import dataclass
+
+_REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+DEFAULT_SHM_NAME = "/coinbot_state"
+LAYOUT_VERSION = 2      # src/statebus/StateBusLayout.h kVersion
+
+# RsiMeanReversionStrategy::State
+STRATEGY_STATES = {0: "Flat", 1: "PendingEntry", 2: "InPosition", 3: "PendingExit"}
+
+# statebus::MarketStateFlags
+FLAG_RSI_READY        = 1 << 0
+FLAG_VOLATILITY_READY = 1 << 1
+FLAG_MARKET_OK        = 1 << 2
+FLAG_CANDLE_VALID     = 1 << 3
+FLAG_REMOVED          = 1 << 4
+FLAG_ORDERBOOK_VALID  = 1 << 5
+
+
+class _MarketState(ctypes.Structure):
+    """statebus::MarketState와 동일 레이아웃 (필드 순서/타입 변경 시 함께 수정)."""
+    _fields_ = [
+        ("market",          ctypes.c_char * 24),
+        ("candle_ts",       ctypes.c_char * 32),
+        ("version",         ctypes.c_uint64),
+        ("updated_at_ms",   ctypes.c_int64),
+        ("strategy_state",  ctypes.c_uint32),
+        ("flags",           ctypes.c_uint32),
+        ("candle_open",     ctypes.c_double),
+        ("candle_high",     ctypes.c_double),
+        ("candle_low",      ctypes.c_double),
+        ("candle_close",    ctypes.c_double),
+        ("candle_volume",   ctypes.c_double),
+        ("rsi",             ctypes.c_double),
+        ("volatility",      ctypes.c_double),
+        ("trend_strength",  ctypes.c_double),
+        ("best_bid",        ctypes.c_double),
+        ("best_ask",        ctypes.c_double),
+        ("bid_depth_krw",   ctypes.c_double),
+        ("ask_depth_krw",   ctypes.c_double),
+        ("available_krw",   ctypes.c_double),
+        ("reserved_krw",    ctypes.c_double),
+        ("coin_balance",    ctypes.c_double),
+        ("avg_entry_price", ctypes.c_double),
+        ("initial_capital", ctypes.c_double),
+        ("realized_pnl",    ctypes.c_double),
+        ("queue_depth",     ctypes.c_uint64),
+        ("queue_dropped",   ctypes.c_uint64),
+    ]
+
+
+@dataclass(frozen=True)
+class MarketState:
+    market: str
+    version: int
+    updated_at_ms: int
+    strategy_state: str
+    candle_ts: str | None
+    candle_open: float | None
+    candle_high: float | None
+    candle_low: float | None
+    candle_close: float | None
+    candle_volume: float | None
+    rsi: float | None
+    volatility: float | None
+    trend_strength: float
+    market_ok: bool
+    removed: bool
+    best_bid: float | None
+    best_ask: float | None
+    bid_depth_krw: float | None
+    ask_depth_krw: float | None
+    available_krw: float
+    reserved_krw: float
+    coin_balance: float
+    avg_entry_price: float
+    initial_capital: float
+    realized_pnl: float
+    queue_depth: int
+    queue_dropped: int
+
+    @staticmethod
+    def _from_raw(raw: _MarketState) -> "MarketState":
+        has_candle = bool(raw.flags & FLAG_CANDLE_VALID)
+        has_book = bool(raw.flags & FLAG_ORDERBOOK_VALID)
+        return MarketState(
+            market=raw.market.decode("ascii", "replace"),
+            version=raw.version,
+            updated_at_ms=raw.updated_at_ms,
+            strategy_state=STRATEGY_STATES.get(raw.strategy_state, str(raw.strategy_state)),
+            candle_ts=raw.candle_ts.decode("ascii", "replace") if has_candle else None,
+            candle_open=raw.candle_open if has_candle else None,
+            candle_high=raw.candle_high if has_candle else None,
+            candle_low=raw.candle_low if has_candle else None,
+            candle_close=raw.candle_close if has_candle else None,
+            candle_volume=raw.candle_volume if has_candle else None,
+            rsi=raw.rsi if raw.flags & FLAG_RSI_READY else None,
+            volatility=raw.volatility if raw.flags & FLAG_VOLATILITY_READY else None,
+            trend_strength=raw.trend_strength,
+            market_ok=bool(raw.flags & FLAG_MARKET_OK),
+            removed=bool(raw.flags & FLAG_REMOVED),
+            best_bid=raw.best_bid if has_book else None,
+            best_ask=raw.best_ask if has_book else None,
+            bid_depth_krw=raw.bid_depth_krw if has_book else None,
+            ask_depth_krw=raw.ask_depth_krw if has_book else None,
+            available_krw=raw.available_krw,
+            reserved_krw=raw.reserved_krw,
+            coin_balance=raw.coin_balance,
+            avg_entry_price=raw.avg_entry_price,
+            initial_capital=raw.initial_capital,
+            realized_pnl=raw.realized_pnl,
+            queue_depth=raw.queue_depth,
+            queue_dropped=raw.queue_dropped,
+        )
+
+
+def _find_library() -> str | None:
+    env = os.environ.get("COINBOT_STATEBUS_LIB")
+    if env:
+        return env if os.path.exists(env) else None
+    pattern = os.path.join(_REPO_ROOT, "out", "build", "*", "src", "statebus",
+                           "libcoinbot_statebus_reader.so")
+    found = sorted(glob.glob(pattern), key=os.path.getmtime, reverse=True)
+    return found[0] if found else None
+
+
+_lib: ctypes.CDLL | None = None
+
+
+def _load() -> ctypes.CDLL | None:
+    global _lib
+    if _lib is not None:
+        return _lib
+
+    path = _find_library()
+    if path is None:
+        return None
+
+    lib = ctypes.CDLL(path)
+    lib.cbsb_layout_version.restype = ctypes.c_uint32
+    lib.cbsb_state_size.restype = ctypes.c_size_t
+    lib.cbsb_open.argtypes = [ctypes.c_char_p]
+    lib.cbsb_open.restype = ctypes.c_void_p
+    lib.cbsb_close.argtypes = [ctypes.c_void_p]
+    lib.cbsb_reopen.argtypes = [ctypes.c_void_p]
+    lib.cbsb_reopen.restype = ctypes.c_int
+    lib.cbsb_market_count.argtypes = [ctypes.c_void_p]
+    lib.cbsb_market_count.restype = ctypes.c_uint32
+    lib.cbsb_read.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_size_t]
+    lib.cbsb_read.restype = ctypes.c_int
+    lib.cbsb_info.argtypes = [ctypes.c_void_p] + [ctypes.POINTER(ctypes.c_int64)] * 3
+    lib.cbsb_info.restype = ctypes.c_int
+
+    # 빌드된 라이브러리와 이 모듈의 레이아웃이 다르면 사용하지 않음
+    if (lib.cbsb_layout_version() != LAYOUT_VERSION or
+            lib.cbsb_state_size() != ctypes.sizeof(_MarketState)):
+        return None
+
+    _lib = lib
+    return lib
+
+
+class StateBus:
+    """상태 버스 읽기 핸들. 봇 재시작 시 heartbeat가 멈추면 reopen()으로 새 세그먼트에 다시 연결."""
+
+    def __init__(self, lib: ctypes.CDLL, handle: int):
+        self._lib = lib
+        self._handle = handle
+
+    @classmethod
+    def open(cls, name: str = DEFAULT_SHM_NAME) -> "StateBus | None":
+        lib = _load()
+        if lib is None:
+            return None
+        handle = lib.cbsb_open(name.encode())
+        return cls(lib, handle) if handle else None
+
+    def close(self) -> None:
+        if self._handle:
+            self._lib.cbsb_close(self._handle)
+            self._handle = None
+
+    def __del__(self):
+        self.close()
+
+    def reopen(self) -> bool:
+        return bool(self._handle and self._lib.cbsb_reopen(self._handle))
+
+    def info(self) -> dict:
+        pid, started, heartbeat = ctypes.c_int64(), ctypes.c_int64(), ctypes.c_int64()
+        self._lib.cbsb_info(self._handle, ctypes.byref(pid), ctypes.byref(started), ctypes.byref(heartbeat))
+        return {
+            "writer_pid": pid.value,
+            "started_at_ms": started.value,
+            "heartbeat_ms": heartbeat.value,
+            "heartbeat_age_s": max(0.0, time.time() - heartbeat.value / 1000.0),
+        }
+
+    def read_all(self, include_removed: bool = False) -> list[MarketState]:
+        """발행된 마켓 상태 (기본: 런타임 제거된 마켓 제외)."""
+        out: list[MarketState] = []
+        raw = _MarketState()
+        for i in range(self._lib.cbsb_market_count(self._handle)):
+            if self._lib.cbsb_read(self._handle, i, ctypes.byref(raw), ctypes.sizeof(raw)):
+                state = MarketState._from_raw(raw)
+                if include_removed or not state.removed:
+                    out.append(state)
+        return out